@@ -0,0 +1,420 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+// This file is a fuzzer of the loading process of the library: the validation of the syntax, the
+// cleaning of the raw commands and their conversion into instances, over inputs in memory.
+
+// It can be built in two ways (configure with -DLIBOPENCIF_BUILD_FUZZER=ON):
+
+// - With Clang, it's linked with libFuzzer, that generates the inputs. The options of libFuzzer
+//   (like -runs=N or -max_len=N) and a corpus directory are given as usual.
+// - With any other compiler, it has its own driver. Every file given is run once, or the standard
+//   input if none is given, so it can be used with AFL ("afl-fuzz -i in -o out -- ./opencif-fuzzer @@").
+//   The option -runs=N also runs N inputs made by mutating the files given (with -seed=N and
+//   -max_len=N), so it can fuzz offline without any other tool.
+
+// In both cases, it measures the time spent with every input, and reports the throughput (bytes
+// per second) and the slowest inputs when it ends. If the environment variable
+// OPENCIF_FUZZ_SLOWEST has the path of a directory, the slowest inputs are written there (as
+// slowest-1.cif, slowest-2.cif, ...), to be used as a corpus of worst cases. The amount of inputs
+// kept is given by OPENCIF_FUZZ_SLOWEST_AMOUNT (10 by default).
+
+// To find memory errors, configure it with a sanitizer, for example:
+
+// $ cmake -DLIBOPENCIF_BUILD_FUZZER=ON -DCMAKE_CXX_FLAGS="-fsanitize=address,undefined" ..
+
+# include <algorithm>
+# include <chrono>
+# include <csignal>
+# include <cstdio>
+# include <cstdint>
+# include <cstdlib>
+# include <cstring>
+# include <fstream>
+# include <iostream>
+# include <random>
+# include <sstream>
+# include <string>
+# include <vector>
+
+# include "opencif.hh"
+
+namespace
+{
+   /*
+    * One of the slowest inputs: its contents and the seconds it took.
+    */
+   struct FuzzerInput
+   {
+      std::string content;
+      double seconds;
+   };
+   
+   /*
+    * Statistics of the inputs run, and the slowest inputs (from the slowest
+    * one).
+    */
+   struct FuzzerStatistics
+   {
+      unsigned long long int inputs;
+      unsigned long long int bytes;
+      double seconds;
+      std::vector< FuzzerInput > slowest;
+      unsigned long int slowest_amount;
+      std::string slowest_directory;
+   };
+   
+   void report ( void );
+   
+   FuzzerStatistics& statistics ( void )
+   {
+      static FuzzerStatistics fuzzer_statistics;
+      static bool initialized = false;
+      
+      if ( !initialized )
+      {
+         const char* directory = std::getenv ( "OPENCIF_FUZZ_SLOWEST" );
+         const char* amount = std::getenv ( "OPENCIF_FUZZ_SLOWEST_AMOUNT" );
+         
+         fuzzer_statistics.inputs = 0;
+         fuzzer_statistics.bytes = 0;
+         fuzzer_statistics.seconds = 0;
+         fuzzer_statistics.slowest_amount = ( amount != nullptr ) ? std::strtoul ( amount , nullptr , 10 ) : 10;
+         fuzzer_statistics.slowest_directory = ( directory != nullptr ) ? directory : "";
+         initialized = true;
+         
+         // libFuzzer ends the process with exit, so the report is written then.
+         std::atexit ( report );
+      }
+      
+      return ( fuzzer_statistics );
+   }
+   
+   /*
+    * Function to run the loading process over an input, the same way that
+    * File::loadFile does, with both load methods. The static helpers of File
+    * are also run with the whole input as a single command.
+    */
+   void load ( const std::string& text )
+   {
+      {
+         std::istringstream input ( text );
+         OpenCIF::File file;
+         
+         file.validateSyntax ( input , OpenCIF::File::ContinueOnError );
+         file.cleanCommands ();
+# ifdef LIBOPENCIF_COMPACT_COORDINATES
+         file.checkCoordinates ();
+# endif
+         file.convertCommands ();
+      }
+      
+      {
+         std::istringstream input ( text );
+         OpenCIF::File file;
+         
+         if ( file.validateSyntax ( input , OpenCIF::File::StopOnError ) == OpenCIF::File::AllOk )
+         {
+            file.cleanCommands ();
+            
+# ifdef LIBOPENCIF_COMPACT_COORDINATES
+            if ( file.checkCoordinates () == OpenCIF::File::AllOk )
+# endif
+            {
+               file.convertCommands ();
+            }
+         }
+      }
+      
+      if ( OpenCIF::File::isCommandValid ( text ) )
+      {
+         std::string command = OpenCIF::File::cleanCommand ( text );
+         
+# ifdef LIBOPENCIF_COMPACT_COORDINATES
+         if ( OpenCIF::File::fitsCoordinates ( command ) )
+# endif
+         {
+            delete OpenCIF::File::convertCommand ( command );
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to run an input, measuring the time it takes, and to keep it if
+    * it's one of the slowest.
+    */
+   void run ( const std::string& text )
+   {
+      FuzzerStatistics& fuzzer_statistics = statistics ();
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+      
+      load ( text );
+      
+      double seconds = std::chrono::duration< double > ( std::chrono::steady_clock::now () - start ).count ();
+      std::vector< FuzzerInput >& slowest = fuzzer_statistics.slowest;
+      
+      fuzzer_statistics.inputs++;
+      fuzzer_statistics.bytes += text.size ();
+      fuzzer_statistics.seconds += seconds;
+      
+      if ( fuzzer_statistics.slowest_amount > 0 &&
+           ( slowest.size () < fuzzer_statistics.slowest_amount || seconds > slowest.back ().seconds ) )
+      {
+         FuzzerInput input;
+         
+         input.content = text;
+         input.seconds = seconds;
+         
+         slowest.insert ( std::upper_bound ( slowest.begin () , slowest.end () , input ,
+                                             [] ( const FuzzerInput& a , const FuzzerInput& b ) { return ( a.seconds > b.seconds ); } ) ,
+                          input );
+         
+         if ( slowest.size () > fuzzer_statistics.slowest_amount )
+         {
+            slowest.pop_back ();
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to write the throughput and the slowest inputs, and to save
+    * them in the directory given, if any.
+    */
+   void report ( void )
+   {
+      FuzzerStatistics& fuzzer_statistics = statistics ();
+      
+      std::cerr << "opencif-fuzzer: " << fuzzer_statistics.inputs << " inputs, " << fuzzer_statistics.bytes << " bytes, "
+                << fuzzer_statistics.seconds << " s, "
+                << ( ( fuzzer_statistics.seconds > 0 ) ? fuzzer_statistics.bytes / fuzzer_statistics.seconds : 0 ) << " bytes/s" << std::endl;
+      
+      for ( unsigned long int i = 0; i < fuzzer_statistics.slowest.size (); i++ )
+      {
+         const FuzzerInput& input = fuzzer_statistics.slowest[ i ];
+         
+         std::cerr << "opencif-fuzzer: slowest " << ( i + 1 ) << ": " << input.content.size () << " bytes, "
+                   << input.seconds * 1e6 << " us, "
+                   << ( ( input.seconds > 0 ) ? input.content.size () / input.seconds : 0 ) << " bytes/s" << std::endl;
+         
+         if ( !fuzzer_statistics.slowest_directory.empty () )
+         {
+            std::ofstream output ( fuzzer_statistics.slowest_directory + "/slowest-" + std::to_string ( i + 1 ) + ".cif" , std::ios::binary );
+            
+            output << input.content;
+         }
+      }
+      
+      return;
+   }
+}
+
+/*
+ * Entry point for libFuzzer (and compatible engines).
+ */
+extern "C" int LLVMFuzzerTestOneInput ( const uint8_t* data , size_t size )
+{
+   run ( std::string ( reinterpret_cast< const char* > ( data ) , size ) );
+   
+   return ( 0 );
+}
+
+# ifndef LIBOPENCIF_LIBFUZZER
+
+namespace
+{
+   const std::string* current_input = nullptr;
+   
+   /*
+    * Function to write the input being run when the process crashes, to
+    * reproduce it later (with AddressSanitizer, use
+    * ASAN_OPTIONS=abort_on_error=1 to get here).
+    */
+   void crash ( int signal_number )
+   {
+      if ( current_input != nullptr )
+      {
+         std::FILE* output = std::fopen ( "opencif-fuzzer-crash.cif" , "wb" );
+         
+         if ( output != nullptr )
+         {
+            std::fwrite ( current_input->data () , 1 , current_input->size () , output );
+            std::fclose ( output );
+            std::fputs ( "opencif-fuzzer: The input that crashed was written to opencif-fuzzer-crash.cif\n" , stderr );
+         }
+      }
+      
+      std::signal ( signal_number , SIG_DFL );
+      std::raise ( signal_number );
+      
+      return;
+   }
+   
+   bool readInput ( std::istream& input , std::string& text )
+   {
+      std::ostringstream oss;
+      
+      oss << input.rdbuf ();
+      text = oss.str ();
+      
+      return ( !input.bad () );
+   }
+   
+   /*
+    * Function to change an input randomly: a char is replaced, inserted or
+    * removed, a block is removed or repeated, or a block of other input is
+    * inserted. The chars are taken mostly from the ones used by CIF.
+    */
+   void mutate ( std::string& text , const std::vector< std::string >& inputs , const unsigned long int& max_length , std::mt19937& random )
+   {
+      static const std::string alphabet = "0123456789-BPWRLCDSFTMXYE;,() \n";
+      unsigned long int changes = 1 + random () % 4;
+      
+      for ( unsigned long int i = 0; i < changes; i++ )
+      {
+         unsigned long int position = ( text.empty () ) ? 0 : random () % text.size ();
+         unsigned long int length = ( text.empty () ) ? 0 : 1 + random () % std::min< unsigned long int > ( text.size () - position , 64 );
+         char input_char = ( random () % 8 == 0 ) ? (char)( random () % 256 ) : alphabet[ random () % alphabet.size () ];
+         
+         switch ( random () % 6 )
+         {
+            case 0:
+               if ( !text.empty () )
+               {
+                  text[ position ] = input_char;
+               }
+               break;
+            
+            case 1:
+               text.insert ( position , 1 , input_char );
+               break;
+            
+            case 2:
+               text.erase ( position , 1 );
+               break;
+            
+            case 3:
+               text.erase ( position , length );
+               break;
+            
+            case 4:
+               text.insert ( position , text.substr ( position , length ) );
+               break;
+            
+            default:
+               {
+                  const std::string& other = inputs[ random () % inputs.size () ];
+                  unsigned long int other_position = ( other.empty () ) ? 0 : random () % other.size ();
+                  
+                  text.insert ( position , other , other_position , 1 + random () % 256 );
+               }
+               break;
+         }
+      }
+      
+      if ( text.size () > max_length )
+      {
+         text.resize ( max_length );
+      }
+      
+      return;
+   }
+}
+
+int main ( int argc , char* argv[] )
+{
+   std::vector< std::string > inputs;
+   unsigned long int runs = 0;
+   unsigned long int seed = 1;
+   unsigned long int max_length = 4096;
+   
+   for ( int i = 1; i < argc; i++ )
+   {
+      std::string argument = argv[ i ];
+      
+      if ( argument.compare ( 0 , 6 , "-runs=" ) == 0 )
+      {
+         runs = std::strtoul ( argument.c_str () + 6 , nullptr , 10 );
+      }
+      else if ( argument.compare ( 0 , 6 , "-seed=" ) == 0 )
+      {
+         seed = std::strtoul ( argument.c_str () + 6 , nullptr , 10 );
+      }
+      else if ( argument.compare ( 0 , 9 , "-max_len=" ) == 0 )
+      {
+         max_length = std::strtoul ( argument.c_str () + 9 , nullptr , 10 );
+      }
+      else
+      {
+         std::ifstream input ( argument.c_str () , std::ios::binary );
+         std::string text;
+         
+         if ( !input.is_open () || !readInput ( input , text ) )
+         {
+            std::cerr << "opencif-fuzzer: Can't read " << argument << std::endl;
+            
+            return ( 1 );
+         }
+         
+         inputs.push_back ( text );
+      }
+   }
+   
+   if ( inputs.empty () )
+   {
+      std::string text;
+      
+      readInput ( std::cin , text );
+      inputs.push_back ( text );
+   }
+   
+   std::signal ( SIGABRT , crash );
+   std::signal ( SIGSEGV , crash );
+   std::signal ( SIGFPE , crash );
+   std::signal ( SIGILL , crash );
+   
+   for ( unsigned long int i = 0; i < inputs.size (); i++ )
+   {
+      current_input = &inputs[ i ];
+      run ( inputs[ i ] );
+   }
+   
+   std::mt19937 random ( seed );
+   std::string text;
+   
+   current_input = &text;
+   
+   for ( unsigned long int i = 0; i < runs; i++ )
+   {
+      text = inputs[ random () % inputs.size () ];
+      
+      mutate ( text , inputs , max_length , random );
+      run ( text );
+   }
+   
+   return ( 0 );
+}
+
+# endif
@@ -0,0 +1,444 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "commandarray.hh"
+# include "../controlcommand/callcommand/callcommand.hh"
+# include "../controlcommand/definitiondeletecommand/definitiondeletecommand.hh"
+# include "../controlcommand/definitionendcommand/definitionendcommand.hh"
+# include "../controlcommand/definitionstartcommand/definitionstartcommand.hh"
+# include "../controlcommand/endcommand/endcommand.hh"
+# include "../layercommand/layercommand.hh"
+# include "../primitivecommand/pathbasedcommand/polygoncommand/polygoncommand.hh"
+# include "../primitivecommand/pathbasedcommand/wirecommand/wirecommand.hh"
+# include "../primitivecommand/positionbasedcommand/boxcommand/boxcommand.hh"
+# include "../primitivecommand/positionbasedcommand/roundflashcommand/roundflashcommand.hh"
+# include "../rawcontentcommand/commentcommand/commentcommand.hh"
+# include "../rawcontentcommand/userextensioncommand/userextensioncommand.hh"
+
+/*
+ * Default constructor. No commands.
+ */
+OpenCIF::CommandArray::CommandArray ( void )
+{
+}
+
+/*
+ * Non-default constructor. Convert a vector of commands of the legacy classes.
+ */
+OpenCIF::CommandArray::CommandArray ( const std::vector< OpenCIF::Command* >& commands )
+{
+   assign ( commands );
+}
+
+OpenCIF::CommandArray::~CommandArray ( void )
+{
+}
+
+/*
+ * Member function to replace the commands of the array with the conversion
+ * of a vector of commands of the legacy classes.
+ */
+void OpenCIF::CommandArray::assign ( const std::vector< OpenCIF::Command* >& commands )
+{
+   clear ();
+   array_entries.reserve ( commands.size () );
+   
+   for ( unsigned long int i = 0; i < commands.size (); i++ )
+   {
+      add ( commands[ i ] );
+   }
+   
+   return;
+}
+
+/*
+ * Member function to convert a command of the legacy classes and to append
+ * it to the array. Returns false (and appends nothing) if the command isn't
+ * of a final type (a plain Command or PrimitiveCommand, for example).
+ */
+bool OpenCIF::CommandArray::add ( const OpenCIF::Command* command )
+{
+   Entry entry;
+   
+   entry.type = command->type ();
+   
+   switch ( entry.type )
+   {
+      case OpenCIF::Command::Box:
+         {
+            const OpenCIF::BoxCommand* box = static_cast< const OpenCIF::BoxCommand* > ( command );
+            
+            entry.box.layer = box->getLayerID ();
+            entry.box.width = box->getSize ().getWidth ();
+            entry.box.height = box->getSize ().getHeight ();
+            entry.box.x = box->getPosition ().getX ();
+            entry.box.y = box->getPosition ().getY ();
+            entry.box.rotation_x = box->getRotation ().getX ();
+            entry.box.rotation_y = box->getRotation ().getY ();
+         }
+         break;
+      
+      case OpenCIF::Command::Polygon:
+         {
+            const OpenCIF::PolygonCommand* polygon = static_cast< const OpenCIF::PolygonCommand* > ( command );
+            
+            entry.polygon.layer = polygon->getLayerID ();
+            entry.polygon.points = addPoints ( polygon->getPoints () );
+         }
+         break;
+      
+      case OpenCIF::Command::Wire:
+         {
+            const OpenCIF::WireCommand* wire = static_cast< const OpenCIF::WireCommand* > ( command );
+            
+            entry.wire.layer = wire->getLayerID ();
+            entry.wire.width = wire->getWidth ();
+            entry.wire.points = addPoints ( wire->getPoints () );
+         }
+         break;
+      
+      case OpenCIF::Command::RoundFlash:
+         {
+            const OpenCIF::RoundFlashCommand* round_flash = static_cast< const OpenCIF::RoundFlashCommand* > ( command );
+            
+            entry.round_flash.layer = round_flash->getLayerID ();
+            entry.round_flash.diameter = round_flash->getDiameter ();
+            entry.round_flash.x = round_flash->getPosition ().getX ();
+            entry.round_flash.y = round_flash->getPosition ().getY ();
+         }
+         break;
+      
+      case OpenCIF::Command::Call:
+         {
+            const OpenCIF::CallCommand* call = static_cast< const OpenCIF::CallCommand* > ( command );
+            const std::vector< OpenCIF::Transformation >& transformations = call->getTransformations ();
+            
+            entry.call.id = call->getID ();
+            entry.call.transformations.first = array_transformations.size ();
+            entry.call.transformations.amount = transformations.size ();
+            
+            for ( unsigned long int i = 0; i < transformations.size (); i++ )
+            {
+               Transformation transformation;
+               
+               transformation.type = transformations[ i ].getType ();
+               transformation.x = transformations[ i ].getDisplacement ().getX ();
+               transformation.y = transformations[ i ].getDisplacement ().getY ();
+               
+               array_transformations.push_back ( transformation );
+            }
+         }
+         break;
+      
+      case OpenCIF::Command::DefinitionStart:
+         {
+            const OpenCIF::DefinitionStartCommand* start = static_cast< const OpenCIF::DefinitionStartCommand* > ( command );
+            
+            entry.definition_start.id = start->getID ();
+            entry.definition_start.a = start->getAB ().getNumerator ();
+            entry.definition_start.b = start->getAB ().getDenominator ();
+         }
+         break;
+      
+      case OpenCIF::Command::DefinitionDelete:
+         entry.definition_delete.id = static_cast< const OpenCIF::DefinitionDeleteCommand* > ( command )->getID ();
+         break;
+      
+      case OpenCIF::Command::Layer:
+         {
+            const OpenCIF::LayerCommand* layer = static_cast< const OpenCIF::LayerCommand* > ( command );
+            
+            entry.layer.id = layer->getID ();
+            entry.layer.name = addText ( layer->getName () );
+         }
+         break;
+      
+      case OpenCIF::Command::Comment:
+         entry.comment.content = addText ( static_cast< const OpenCIF::CommentCommand* > ( command )->getContent () );
+         break;
+      
+      case OpenCIF::Command::UserExtension:
+         entry.user_extension.content = addText ( static_cast< const OpenCIF::UserExtensionCommand* > ( command )->getContent () );
+         break;
+      
+      case OpenCIF::Command::DefinitionEnd:
+      case OpenCIF::Command::End:
+         break;
+      
+      default:
+         return ( false );
+   }
+   
+   array_entries.push_back ( entry );
+   
+   return ( true );
+}
+
+/*
+ * Member function to remove every command.
+ */
+void OpenCIF::CommandArray::clear ( void )
+{
+   array_entries.clear ();
+   array_points.clear ();
+   array_transformations.clear ();
+   array_text.clear ();
+   
+   return;
+}
+
+/*
+ * Member function to return the amount of commands.
+ */
+unsigned long int OpenCIF::CommandArray::size ( void ) const
+{
+   return ( array_entries.size () );
+}
+
+/*
+ * Member function to return a command. The member of the union to read is
+ * the one of its type.
+ */
+const OpenCIF::CommandArray::Entry& OpenCIF::CommandArray::getEntry ( const unsigned long int& index ) const
+{
+   return ( array_entries[ index ] );
+}
+
+OpenCIF::Command::CommandType OpenCIF::CommandArray::getType ( const unsigned long int& index ) const
+{
+   return ( array_entries[ index ].type );
+}
+
+/*
+ * Member function to return the first point of a span (of a polygon or a
+ * wire). The points of the span are contiguous.
+ */
+const OpenCIF::Point* OpenCIF::CommandArray::getPoints ( const Span& span ) const
+{
+   return ( array_points.data () + span.first );
+}
+
+/*
+ * Member function to return the first transformation of a span (of a call).
+ * The transformations of the span are contiguous.
+ */
+const OpenCIF::CommandArray::Transformation* OpenCIF::CommandArray::getTransformations ( const Span& span ) const
+{
+   return ( array_transformations.data () + span.first );
+}
+
+/*
+ * Member function to return the text of a span (the name of a layer, or the
+ * content of a comment or user extension).
+ */
+std::string OpenCIF::CommandArray::getText ( const Span& span ) const
+{
+   return ( array_text.substr ( span.first , span.amount ) );
+}
+
+/*
+ * Member function to return the memory used by the array (the capacity of
+ * its vectors).
+ */
+unsigned long int OpenCIF::CommandArray::memoryUsage ( void ) const
+{
+   return ( sizeof ( *this ) + array_entries.capacity () * sizeof ( Entry ) + array_points.capacity () * sizeof ( OpenCIF::Point ) +
+            array_transformations.capacity () * sizeof ( Transformation ) + array_text.capacity () );
+}
+
+/*
+ * Member function to convert a command back to the legacy classes. The
+ * caller takes the ownership of the command.
+ */
+OpenCIF::Command* OpenCIF::CommandArray::toCommand ( const unsigned long int& index ) const
+{
+   const Entry& entry = array_entries[ index ];
+   
+   switch ( entry.type )
+   {
+      case OpenCIF::Command::Box:
+         {
+            OpenCIF::BoxCommand* box = new OpenCIF::BoxCommand ();
+            
+            box->setLayerID ( entry.box.layer );
+            box->setSize ( OpenCIF::Size ( entry.box.width , entry.box.height ) );
+            box->setPosition ( OpenCIF::Point ( entry.box.x , entry.box.y ) );
+            box->setRotation ( OpenCIF::Point ( entry.box.rotation_x , entry.box.rotation_y ) );
+            
+            return ( box );
+         }
+      
+      case OpenCIF::Command::Polygon:
+         {
+            OpenCIF::PolygonCommand* polygon = new OpenCIF::PolygonCommand ();
+            const OpenCIF::Point* points = getPoints ( entry.polygon.points );
+            
+            polygon->setLayerID ( entry.polygon.layer );
+            polygon->setPoints ( std::vector< OpenCIF::Point > ( points , points + entry.polygon.points.amount ) );
+            
+            return ( polygon );
+         }
+      
+      case OpenCIF::Command::Wire:
+         {
+            OpenCIF::WireCommand* wire = new OpenCIF::WireCommand ();
+            const OpenCIF::Point* points = getPoints ( entry.wire.points );
+            
+            wire->setLayerID ( entry.wire.layer );
+            wire->setWidth ( entry.wire.width );
+            wire->setPoints ( std::vector< OpenCIF::Point > ( points , points + entry.wire.points.amount ) );
+            
+            return ( wire );
+         }
+      
+      case OpenCIF::Command::RoundFlash:
+         {
+            OpenCIF::RoundFlashCommand* round_flash = new OpenCIF::RoundFlashCommand ();
+            
+            round_flash->setLayerID ( entry.round_flash.layer );
+            round_flash->setDiameter ( entry.round_flash.diameter );
+            round_flash->setPosition ( OpenCIF::Point ( entry.round_flash.x , entry.round_flash.y ) );
+            
+            return ( round_flash );
+         }
+      
+      case OpenCIF::Command::Call:
+         {
+            OpenCIF::CallCommand* call = new OpenCIF::CallCommand ();
+            const Transformation* transformations = getTransformations ( entry.call.transformations );
+            std::vector< OpenCIF::Transformation > converted ( entry.call.transformations.amount );
+            
+            for ( unsigned long int i = 0; i < converted.size (); i++ )
+            {
+               converted[ i ].setType ( transformations[ i ].type );
+               converted[ i ].setDisplacement ( OpenCIF::Point ( transformations[ i ].x , transformations[ i ].y ) );
+            }
+            
+            call->setID ( entry.call.id );
+            call->setTransformations ( std::move ( converted ) );
+            
+            return ( call );
+         }
+      
+      case OpenCIF::Command::DefinitionStart:
+         {
+            OpenCIF::DefinitionStartCommand* start = new OpenCIF::DefinitionStartCommand ();
+            
+            start->setID ( entry.definition_start.id );
+            start->setAB ( OpenCIF::Fraction ( entry.definition_start.a , entry.definition_start.b ) );
+            
+            return ( start );
+         }
+      
+      case OpenCIF::Command::DefinitionDelete:
+         {
+            OpenCIF::DefinitionDeleteCommand* definition_delete = new OpenCIF::DefinitionDeleteCommand ();
+            
+            definition_delete->setID ( entry.definition_delete.id );
+            
+            return ( definition_delete );
+         }
+      
+      case OpenCIF::Command::DefinitionEnd:
+         return ( new OpenCIF::DefinitionEndCommand () );
+      
+      case OpenCIF::Command::Layer:
+         {
+            OpenCIF::LayerCommand* layer = new OpenCIF::LayerCommand ();
+            
+            layer->setID ( entry.layer.id );
+            layer->setName ( getText ( entry.layer.name ) );
+            
+            return ( layer );
+         }
+      
+      case OpenCIF::Command::Comment:
+         {
+            OpenCIF::CommentCommand* comment = new OpenCIF::CommentCommand ();
+            
+            comment->setContent ( getText ( entry.comment.content ) );
+            
+            return ( comment );
+         }
+      
+      case OpenCIF::Command::UserExtension:
+         {
+            OpenCIF::UserExtensionCommand* user_extension = new OpenCIF::UserExtensionCommand ();
+            
+            user_extension->setContent ( getText ( entry.user_extension.content ) );
+            
+            return ( user_extension );
+         }
+      
+      default:
+         return ( new OpenCIF::EndCommand () );
+   }
+}
+
+/*
+ * Member function to convert every command back to the legacy classes (for
+ * File::setCommands, for example).
+ */
+std::vector< std::unique_ptr< OpenCIF::Command > > OpenCIF::CommandArray::toCommands ( void ) const
+{
+   std::vector< std::unique_ptr< OpenCIF::Command > > commands;
+   
+   commands.reserve ( array_entries.size () );
+   
+   for ( unsigned long int i = 0; i < array_entries.size (); i++ )
+   {
+      commands.push_back ( std::unique_ptr< OpenCIF::Command > ( toCommand ( i ) ) );
+   }
+   
+   return ( commands );
+}
+
+/*
+ * Member function to append points to the shared vector, and to return
+ * where they are.
+ */
+OpenCIF::CommandArray::Span OpenCIF::CommandArray::addPoints ( const std::vector< OpenCIF::Point >& points )
+{
+   Span span;
+   
+   span.first = array_points.size ();
+   span.amount = points.size ();
+   array_points.insert ( array_points.end () , points.begin () , points.end () );
+   
+   return ( span );
+}
+
+/*
+ * Member function to append a text to the shared string, and to return
+ * where it is.
+ */
+OpenCIF::CommandArray::Span OpenCIF::CommandArray::addText ( const std::string& text )
+{
+   Span span;
+   
+   span.first = array_text.size ();
+   span.amount = text.size ();
+   array_text.append ( text );
+   
+   return ( span );
+}
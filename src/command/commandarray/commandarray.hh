@@ -0,0 +1,280 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_COMMANDARRAY_HH_
+# define LIBOPENCIF_COMMANDARRAY_HH_
+
+# include <memory>
+# include <string>
+# include <vector>
+
+# include "../command.hh"
+# include "../point/point.hh"
+# include "../transformation/transformation.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class stores commands as values. Every command is a small struct
+    * without virtual member functions (Box, Polygon, Call, ...), tagged with
+    * its type and kept inside a single vector, so going through the commands
+    * reads contiguous memory instead of following a pointer and a vtable for
+    * every command. The points of the polygons and wires, the transformations
+    * of the calls, and the texts of the layers, comments and user extensions
+    * are kept in three more vectors, shared by every command; the structs only
+    * store a Span (where their data starts, and its length).
+    *
+    * The commands are read with visit, that calls the operator () of a visitor
+    * with the struct of every command. The visitor is a template parameter,
+    * so the calls are resolved at compile time (and can be inlined); it must
+    * accept every struct (a template operator () can take the ones ignored).
+    *
+    * The commands of the legacy classes are converted with the constructor,
+    * assign or add, and converted back with toCommand and toCommands. The
+    * layer IDs are copied, so they still refer to the LayerTable of the file.
+    */
+   class CommandArray
+   {
+      public:
+         struct Span
+         {
+            unsigned long int first;
+            unsigned long int amount;
+         };
+         
+         struct Box
+         {
+            unsigned long int layer;
+            unsigned long int width;
+            unsigned long int height;
+            long int x;
+            long int y;
+            long int rotation_x;
+            long int rotation_y;
+         };
+         
+         struct Polygon
+         {
+            unsigned long int layer;
+            Span points;
+         };
+         
+         struct Wire
+         {
+            unsigned long int layer;
+            unsigned long int width;
+            Span points;
+         };
+         
+         struct RoundFlash
+         {
+            unsigned long int layer;
+            unsigned long int diameter;
+            long int x;
+            long int y;
+         };
+         
+         struct Call
+         {
+            unsigned long int id;
+            Span transformations;
+         };
+         
+         struct DefinitionStart
+         {
+            unsigned long int id;
+            unsigned long int a;
+            unsigned long int b;
+         };
+         
+         struct DefinitionDelete
+         {
+            unsigned long int id;
+         };
+         
+         struct DefinitionEnd
+         {
+         };
+         
+         struct Layer
+         {
+            unsigned long int id;
+            Span name;
+         };
+         
+         struct Comment
+         {
+            Span content;
+         };
+         
+         struct UserExtension
+         {
+            Span content;
+         };
+         
+         struct End
+         {
+         };
+         
+         struct Transformation
+         {
+            OpenCIF::Transformation::TransformationType type;
+            long int x; // The displacement, or the rotation.
+            long int y;
+         };
+         
+         struct Entry
+         {
+            OpenCIF::Command::CommandType type;
+            
+            union
+            {
+               Box box;
+               Polygon polygon;
+               Wire wire;
+               RoundFlash round_flash;
+               Call call;
+               DefinitionStart definition_start;
+               DefinitionDelete definition_delete;
+               DefinitionEnd definition_end;
+               Layer layer;
+               Comment comment;
+               UserExtension user_extension;
+               End end;
+            };
+         };
+      
+      public:
+         explicit CommandArray ( void );
+         explicit CommandArray ( const std::vector< OpenCIF::Command* >& commands );
+         virtual ~CommandArray ( void );
+         
+         void assign ( const std::vector< OpenCIF::Command* >& commands );
+         bool add ( const OpenCIF::Command* command );
+         void clear ( void );
+         
+         unsigned long int size ( void ) const;
+         const Entry& getEntry ( const unsigned long int& index ) const;
+         OpenCIF::Command::CommandType getType ( const unsigned long int& index ) const;
+         const OpenCIF::Point* getPoints ( const Span& span ) const;
+         const Transformation* getTransformations ( const Span& span ) const;
+         std::string getText ( const Span& span ) const;
+         unsigned long int memoryUsage ( void ) const;
+         
+         OpenCIF::Command* toCommand ( const unsigned long int& index ) const;
+         std::vector< std::unique_ptr< OpenCIF::Command > > toCommands ( void ) const;
+         
+         template < typename Visitor > void visit ( Visitor& visitor ) const;
+         template < typename Visitor > void visit ( const unsigned long int& begin , const unsigned long int& end , Visitor& visitor ) const;
+      
+      private:
+         Span addPoints ( const std::vector< OpenCIF::Point >& points );
+         Span addText ( const std::string& text );
+      
+      private:
+         std::vector< Entry > array_entries;
+         std::vector< OpenCIF::Point > array_points;
+         std::vector< Transformation > array_transformations;
+         std::string array_text;
+   };
+}
+
+/*
+ * Member function to call the visitor with every command, in order.
+ */
+template < typename Visitor > void OpenCIF::CommandArray::visit ( Visitor& visitor ) const
+{
+   visit ( 0 , array_entries.size () , visitor );
+   
+   return;
+}
+
+/*
+ * Member function to call the visitor with the commands from begin to end
+ * (not included). Different ranges can be visited by different threads.
+ */
+template < typename Visitor > void OpenCIF::CommandArray::visit ( const unsigned long int& begin , const unsigned long int& end , Visitor& visitor ) const
+{
+   for ( unsigned long int i = begin; i < end; i++ )
+   {
+      const Entry& entry = array_entries[ i ];
+      
+      switch ( entry.type )
+      {
+         case OpenCIF::Command::Box:
+            visitor ( entry.box );
+            break;
+         
+         case OpenCIF::Command::Polygon:
+            visitor ( entry.polygon );
+            break;
+         
+         case OpenCIF::Command::Wire:
+            visitor ( entry.wire );
+            break;
+         
+         case OpenCIF::Command::RoundFlash:
+            visitor ( entry.round_flash );
+            break;
+         
+         case OpenCIF::Command::Call:
+            visitor ( entry.call );
+            break;
+         
+         case OpenCIF::Command::DefinitionStart:
+            visitor ( entry.definition_start );
+            break;
+         
+         case OpenCIF::Command::DefinitionDelete:
+            visitor ( entry.definition_delete );
+            break;
+         
+         case OpenCIF::Command::DefinitionEnd:
+            visitor ( entry.definition_end );
+            break;
+         
+         case OpenCIF::Command::Layer:
+            visitor ( entry.layer );
+            break;
+         
+         case OpenCIF::Command::Comment:
+            visitor ( entry.comment );
+            break;
+         
+         case OpenCIF::Command::UserExtension:
+            visitor ( entry.user_extension );
+            break;
+         
+         case OpenCIF::Command::End:
+            visitor ( entry.end );
+            break;
+         
+         default:
+            break;
+      }
+   }
+   
+   return;
+}
+
+# endif
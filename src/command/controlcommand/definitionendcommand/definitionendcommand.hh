@@ -1,61 +1,61 @@
-/*
- * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
- * Form) file. The library also includes a finite state machine to validate
- * the contents, acording to the specifications found in the technical
- * report 2686, from february 11, 1980.
- * 
- * Copyright (C) 2014, Moises Chavez Martinez
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see <http://www.gnu.org/licenses/>.
- */  
-
-# ifndef LIBOPENCIF_DEFINITIONENDCOMMAND_HH_
-# define LIBOPENCIF_DEFINITIONENDCOMMAND_HH_
-
-# include <string>
-
-# include "../controlcommand.hh"
-
-namespace OpenCIF { class DefinitionEndCommand; }
-std::ostream& operator<< ( std::ostream& output_stream , OpenCIF::DefinitionEndCommand& command );
-std::istream& operator>> ( std::istream& input_stream , OpenCIF::DefinitionEndCommand& command );
-std::ostream& operator<< ( std::ostream& output_stream , OpenCIF::DefinitionEndCommand* command );
-std::istream& operator>> ( std::istream& input_stream , OpenCIF::DefinitionEndCommand* command );
-
-namespace OpenCIF
-{
-   class DefinitionEndCommand : public OpenCIF::ControlCommand
-   {
-      public:
-         explicit DefinitionEndCommand ( void );
-         explicit DefinitionEndCommand ( const std::string& str_command );
-         virtual ~DefinitionEndCommand ( void );
-         
-         friend std::ostream& (::operator<<) ( std::ostream& output_stream , DefinitionEndCommand& command );
-         friend std::istream& (::operator>>) ( std::istream& input_stream , DefinitionEndCommand& command );
-         friend std::ostream& (::operator<<) ( std::ostream& output_stream , DefinitionEndCommand* command );
-         friend std::istream& (::operator>>) ( std::istream& input_stream , DefinitionEndCommand* command );
-         
-      protected:
-         virtual void print ( std::ostream& output_stream );
-         virtual void read ( std::istream& input_stream );
-         
-      private:
-         // Turn these member functions into private, since this command doesn't need an ID
-         void setID ( const unsigned long int& new_id );
-         unsigned long int getID ( void ) const;
-   };
-}
-
-# endif
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */  
+
+# ifndef LIBOPENCIF_DEFINITIONENDCOMMAND_HH_
+# define LIBOPENCIF_DEFINITIONENDCOMMAND_HH_
+
+# include <string>
+
+# include "../controlcommand.hh"
+
+namespace OpenCIF { class DefinitionEndCommand; }
+std::ostream& operator<< ( std::ostream& output_stream , OpenCIF::DefinitionEndCommand& command );
+std::istream& operator>> ( std::istream& input_stream , OpenCIF::DefinitionEndCommand& command );
+std::ostream& operator<< ( std::ostream& output_stream , OpenCIF::DefinitionEndCommand* command );
+std::istream& operator>> ( std::istream& input_stream , OpenCIF::DefinitionEndCommand* command );
+
+namespace OpenCIF
+{
+   class DefinitionEndCommand : public OpenCIF::ControlCommand
+   {
+      public:
+         explicit DefinitionEndCommand ( void );
+         explicit DefinitionEndCommand ( const std::string& str_command );
+         virtual ~DefinitionEndCommand ( void );
+         
+         friend std::ostream& (::operator<<) ( std::ostream& output_stream , DefinitionEndCommand& command );
+         friend std::istream& (::operator>>) ( std::istream& input_stream , DefinitionEndCommand& command );
+         friend std::ostream& (::operator<<) ( std::ostream& output_stream , DefinitionEndCommand* command );
+         friend std::istream& (::operator>>) ( std::istream& input_stream , DefinitionEndCommand* command );
+         
+      protected:
+         virtual void print ( std::ostream& output_stream );
+         virtual void read ( std::istream& input_stream );
+         
+      private:
+         // Turn these member functions into private, since this command doesn't need an ID
+         void setID ( const unsigned long int& new_id );
+         unsigned long int getID ( void ) const;
+   };
+}
+
+# endif
@@ -1,58 +1,171 @@
-/*
- * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
- * Form) file. The library also includes a finite state machine to validate
- * the contents, acording to the specifications found in the technical
- * report 2686, from february 11, 1980.
- * 
- * Copyright (C) 2014, Moises Chavez Martinez
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see <http://www.gnu.org/licenses/>.
- */ 
-
-# include "pathbasedcommand.hh"
-
-/*
- * Default constructor. Nothing to do.
- */
-OpenCIF::PathBasedCommand::PathBasedCommand ( void )
-   : PrimitiveCommand ()
-{
-   command_type = PathBased;
-}
-
-/*
- * Destructor. Nothing to do.
- */
-OpenCIF::PathBasedCommand::~PathBasedCommand ( void )
-{
-}
-
-/*
- * This member function returns the points stored in the command.
- */
-std::vector< OpenCIF::Point > OpenCIF::PathBasedCommand::getPoints ( void ) const
-{
-   return ( command_points );
-}
-
-/*
- * This member function help to set the points for this command.
- */
-void OpenCIF::PathBasedCommand::setPoints ( const std::vector< OpenCIF::Point >& new_points )
-{
-   command_points = new_points;
-   
-   return;
-}
-
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+# include "pathbasedcommand.hh"
+
+# include <cstring>
+
+/*
+ * Default constructor. Nothing to do.
+ */
+OpenCIF::PathBasedCommand::PathBasedCommand ( void )
+   : PrimitiveCommand ()
+{
+   command_type = PathBased;
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::PathBasedCommand::~PathBasedCommand ( void )
+{
+}
+
+/*
+ * This member function returns the points stored in the command. No copy is
+ * done, the reference is valid while the command exists and its points are
+ * not modified.
+ */
+const std::vector< OpenCIF::Point >& OpenCIF::PathBasedCommand::getPoints ( void ) const
+{
+   return ( command_points );
+}
+
+/*
+ * This member function help to set the points for this command.
+ */
+void OpenCIF::PathBasedCommand::setPoints ( const std::vector< OpenCIF::Point >& new_points )
+{
+   command_points = new_points;
+   
+   return;
+}
+
+/*
+ * This member function help to set the points for this command, moving the
+ * vector received (no copy of the points is done).
+ */
+void OpenCIF::PathBasedCommand::setPoints ( std::vector< OpenCIF::Point >&& new_points )
+{
+   command_points = std::move ( new_points );
+   
+   return;
+}
+
+/*
+ * This member function returns the amount of points stored in the command.
+ */
+unsigned long int OpenCIF::PathBasedCommand::getPointAmount ( void ) const
+{
+   return ( command_points.size () );
+}
+
+/*
+ * This member function returns a single point of the command, without copying
+ * the whole vector. The index is not checked.
+ */
+const OpenCIF::Point& OpenCIF::PathBasedCommand::getPoint ( const unsigned long int& index ) const
+{
+   return ( command_points[ index ] );
+}
+
+/*
+ * This member function reads the next integer value found in a string, from
+ * "position" to "end". Any char that is not a digit or a dash ('-') is
+ * skipped, so the command letters and the separators are ignored. Once the
+ * value is read, "position" points to the char that follows it.
+ * 
+ * Returns false if there are no more values in the string.
+ */
+bool OpenCIF::PathBasedCommand::readValue ( const char*& position , const char* end , long int& value )
+{
+   while ( position != end && !( ( *position >= '0' && *position <= '9' ) || *position == '-' ) )
+   {
+      position++;
+   }
+   
+   if ( position == end )
+   {
+      return ( false );
+   }
+   
+   bool negative = ( *position == '-' );
+   unsigned long int magnitude = 0;
+   
+   if ( negative )
+   {
+      position++;
+   }
+   
+   while ( position != end && *position >= '0' && *position <= '9' )
+   {
+      magnitude = magnitude * 10 + (unsigned long int)( *position - '0' );
+      position++;
+   }
+   
+   value = ( negative ) ? -(long int)magnitude : (long int)magnitude;
+   
+   return ( true );
+}
+
+/*
+ * This member function reads the points of the command from a string, like
+ * the ones generated by File::cleanCommand ("P 0 0 10 0 10 10 ;"). The points
+ * stored previously are replaced. The reading stops at the first semicolon.
+ * 
+ * Instead of creating a string stream for every value, the string is read in
+ * two passes. The first one only counts the values (a simple loop over the
+ * chars, that the compiler can vectorize), so the vector of points is
+ * reserved only once. The second one decodes the values.
+ */
+void OpenCIF::PathBasedCommand::readPoints ( const char* position , const char* end )
+{
+   const char* semicolon = (const char*)std::memchr ( position , ';' , end - position );
+   unsigned long int values = 0;
+   
+   if ( semicolon != 0 )
+   {
+      end = semicolon;
+   }
+   
+   // A value starts in every char that is part of a value, when the previous one is not.
+   for ( const char* current = position; current != end; current++ )
+   {
+      bool is_value = ( ( *current >= '0' && *current <= '9' ) || *current == '-' );
+      bool previous_is_value = ( current != position &&
+                                 ( ( current[ -1 ] >= '0' && current[ -1 ] <= '9' ) || current[ -1 ] == '-' ) );
+      
+      values += ( is_value && !previous_is_value ) ? 1 : 0;
+   }
+   
+   command_points.clear ();
+   command_points.reserve ( values / 2 );
+   
+   long int x , y;
+   
+   while ( readValue ( position , end , x ) && readValue ( position , end , y ) )
+   {
+      command_points.push_back ( OpenCIF::Point ( x , y ) );
+   }
+   
+   return;
+}
@@ -1,39 +1,59 @@
-/*
- * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
- * Form) file. The library also includes a finite state machine to validate
- * the contents, acording to the specifications found in the technical
- * report 2686, from february 11, 1980.
- * 
- * Copyright (C) 2014, Moises Chavez Martinez
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see <http://www.gnu.org/licenses/>.
- */
-
-# include "primitivecommand.hh"
-
-/*
- * Default constructor. Nothing to do.
- */
-OpenCIF::PrimitiveCommand::PrimitiveCommand ( void )
-   : Command ()
-{
-   command_type = Primitive;
-}
-
-/*
- * Destructor.
- */
-OpenCIF::PrimitiveCommand::~PrimitiveCommand ( void )
-{
-}
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+# include "primitivecommand.hh"
+
+/*
+ * Default constructor. Nothing to do.
+ */
+OpenCIF::PrimitiveCommand::PrimitiveCommand ( void )
+   : Command ()
+{
+   command_type = Primitive;
+   primitive_layer_id = OpenCIF::LayerTable::NoLayer;
+}
+
+/*
+ * Destructor.
+ */
+OpenCIF::PrimitiveCommand::~PrimitiveCommand ( void )
+{
+}
+
+/*
+ * Member function to return the ID of the layer of the primitive. If the
+ * primitive has no layer, LayerTable::NoLayer is returned.
+ */
+unsigned long int OpenCIF::PrimitiveCommand::getLayerID ( void ) const
+{
+   return ( primitive_layer_id );
+}
+
+/*
+ * Member function to set the ID of the layer of the primitive.
+ */
+void OpenCIF::PrimitiveCommand::setLayerID ( const unsigned long int& new_layer_id )
+{
+   primitive_layer_id = new_layer_id;
+   
+   return;
+}
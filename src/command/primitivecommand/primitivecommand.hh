@@ -1,38 +1,44 @@
-/*
- * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
- * Form) file. The library also includes a finite state machine to validate
- * the contents, acording to the specifications found in the technical
- * report 2686, from february 11, 1980.
- * 
- * Copyright (C) 2014, Moises Chavez Martinez
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see <http://www.gnu.org/licenses/>.
- */
-
-# ifndef LIBOPENCIF_PRIMITIVECOMMAND_HH_
-# define LIBOPENCIF_PRIMITIVECOMMAND_HH_
-
-# include "../command.hh"
-
-namespace OpenCIF
-{
-   class PrimitiveCommand : public OpenCIF::Command
-   {
-      public:
-         explicit PrimitiveCommand ( void );
-         virtual ~PrimitiveCommand ( void );
-   };
-}
-
-# endif
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+# ifndef LIBOPENCIF_PRIMITIVECOMMAND_HH_
+# define LIBOPENCIF_PRIMITIVECOMMAND_HH_
+
+# include "../command.hh"
+# include "../../layertable/layertable.hh"
+
+namespace OpenCIF
+{
+   class PrimitiveCommand : public OpenCIF::Command
+   {
+      public:
+         explicit PrimitiveCommand ( void );
+         virtual ~PrimitiveCommand ( void );
+         void setLayerID ( const unsigned long int& new_layer_id );
+         unsigned long int getLayerID ( void ) const;
+         
+      protected:
+         unsigned long int primitive_layer_id; // ID of the layer (in the LayerTable of the file) where the primitive is drawn.
+   };
+}
+
+# endif
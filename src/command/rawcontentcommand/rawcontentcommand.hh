@@ -1,45 +1,47 @@
-/*
- * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
- * Form) file. The library also includes a finite state machine to validate
- * the contents, acording to the specifications found in the technical
- * report 2686, from february 11, 1980.
- * 
- * Copyright (C) 2014, Moises Chavez Martinez
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see <http://www.gnu.org/licenses/>.
- */  
-
-# ifndef LIBOPENCIF_RAWCONTENTCOMMAND_HH_
-# define LIBOPENCIF_RAWCONTENTCOMMAND_HH_
-
-# include <string>
-
-# include "../command.hh"
-
-namespace OpenCIF
-{
-   class RawContentCommand : public OpenCIF::Command
-   {
-      public:
-         explicit RawContentCommand ( void );
-         virtual ~RawContentCommand ( void );
-         void setContent ( const std::string& new_contents );
-         std::string getContent ( void ) const;
-         
-      protected:
-         std::string command_content;
-   };
-}
-
-# endif
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */  
+
+# ifndef LIBOPENCIF_RAWCONTENTCOMMAND_HH_
+# define LIBOPENCIF_RAWCONTENTCOMMAND_HH_
+
+# include <string>
+# include <utility>
+
+# include "../command.hh"
+
+namespace OpenCIF
+{
+   class RawContentCommand : public OpenCIF::Command
+   {
+      public:
+         explicit RawContentCommand ( void );
+         virtual ~RawContentCommand ( void );
+         void setContent ( const std::string& new_contents );
+         void setContent ( std::string&& new_contents );
+         const std::string& getContent ( void ) const;
+         
+      protected:
+         std::string command_content;
+   };
+}
+
+# endif
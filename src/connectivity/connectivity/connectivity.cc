@@ -0,0 +1,477 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <algorithm>
+# include <map>
+# include <mutex>
+# include <sstream>
+# include <string>
+# include <utility>
+
+# include "connectivity.hh"
+# include "../../command/layercommand/layercommand.hh"
+# include "../../command/rawcontentcommand/userextensioncommand/userextensioncommand.hh"
+# include "../../geometry/flattener/flattener.hh"
+# include "../../geometry/spatialindex/spatialindex.hh"
+# include "../../geometry/transform/transform.hh"
+# include "../../hierarchy/hierarchy/hierarchy.hh"
+# include "../../layertable/layertable.hh"
+# include "../../threadpool/threadpool.hh"
+
+namespace
+{
+   /*
+    * Label found in a "94" user extension. The layer is resolved using the
+    * names of the layers after reading every command.
+    */
+   struct ConnectivityLabel
+   {
+      std::string name;
+      OpenCIF::Point position;
+      std::string layer_name;
+      unsigned long int layer_id;
+   };
+   
+   /*
+    * Function to read a label ("94 name x y [layer]"). Returns false if the
+    * user extension is another one, or it's not complete.
+    */
+   bool readLabel ( const std::string& content , ConnectivityLabel& label )
+   {
+      std::istringstream input_stream ( content );
+      std::string code;
+      long int x = 0;
+      long int y = 0;
+      
+      if ( !( input_stream >> code >> label.name >> x >> y ) || code != "94" )
+      {
+         return ( false );
+      }
+      
+      label.position = OpenCIF::Point ( x , y );
+      
+      if ( !( input_stream >> label.layer_name ) )
+      {
+         label.layer_name.clear ();
+      }
+      
+      return ( true );
+   }
+   
+   /*
+    * Function to add the labels of a symbol (and of the symbols it calls)
+    * placed using a transformation.
+    */
+   void placeLabels ( const OpenCIF::Hierarchy& hierarchy , const std::vector< std::vector< ConnectivityLabel > >& labels ,
+                      const std::vector< bool >& has_labels , const OpenCIF::Symbol& symbol , const unsigned long int& symbol_index ,
+                      const OpenCIF::Transform& transform , std::vector< ConnectivityLabel >& placed )
+   {
+      for ( unsigned long int i = 0; i < labels[ symbol_index ].size (); i++ )
+      {
+         placed.push_back ( labels[ symbol_index ][ i ] );
+         placed.back ().position = transform.apply ( placed.back ().position );
+      }
+      
+      const std::vector< OpenCIF::Instance >& instances = symbol.getInstances ();
+      
+      for ( unsigned long int i = 0; i < instances.size (); i++ )
+      {
+         if ( has_labels[ instances[ i ].getSymbol () ] )
+         {
+            placeLabels ( hierarchy , labels , has_labels , hierarchy.getSymbol ( instances[ i ].getSymbol () ) , instances[ i ].getSymbol () ,
+                          transform * instances[ i ].getTransform () , placed );
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to find the labels of a list of commands, placed in the
+    * coordinates of the file.
+    */
+   std::vector< ConnectivityLabel > findLabels ( const std::vector< OpenCIF::Command* >& commands )
+   {
+      OpenCIF::Hierarchy hierarchy ( commands );
+      std::map< unsigned long int , unsigned long int > symbol_begins;
+      std::map< std::string , unsigned long int > layer_ids;
+      
+      // The labels outside the definitions are kept after the labels of the symbols.
+      unsigned long int top = hierarchy.getSymbolAmount ();
+      std::vector< std::vector< ConnectivityLabel > > labels ( top + 1 );
+      unsigned long int current_symbol = top;
+      unsigned long int current_layer = OpenCIF::LayerTable::NoLayer;
+      unsigned long int outer_layer = OpenCIF::LayerTable::NoLayer;
+      
+      for ( unsigned long int i = 0; i < top; i++ )
+      {
+         symbol_begins[ hierarchy.getSymbol ( i ).getBegin () ] = i;
+      }
+      
+      for ( unsigned long int i = 0; i < commands.size (); i++ )
+      {
+         switch ( commands[ i ]->type () )
+         {
+            case OpenCIF::Command::DefinitionStart:
+               current_symbol = symbol_begins.count ( i ) ? symbol_begins[ i ] : top;
+               outer_layer = current_layer;
+               current_layer = OpenCIF::LayerTable::NoLayer;
+               break;
+            
+            case OpenCIF::Command::DefinitionEnd:
+               current_symbol = top;
+               current_layer = outer_layer;
+               break;
+            
+            case OpenCIF::Command::Layer:
+            {
+               OpenCIF::LayerCommand* layer = static_cast< OpenCIF::LayerCommand* > ( commands[ i ] );
+               
+               current_layer = layer->getID ();
+               layer_ids[ layer->getName () ] = layer->getID ();
+               break;
+            }
+            
+            case OpenCIF::Command::UserExtension:
+            {
+               ConnectivityLabel label;
+               
+               if ( readLabel ( static_cast< OpenCIF::UserExtensionCommand* > ( commands[ i ] )->getContent () , label ) )
+               {
+                  label.layer_id = current_layer;
+                  labels[ current_symbol ].push_back ( label );
+               }
+               break;
+            }
+            
+            default:
+               break;
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < labels.size (); i++ )
+      {
+         for ( unsigned long int j = 0; j < labels[ i ].size (); j++ )
+         {
+            if ( !labels[ i ][ j ].layer_name.empty () )
+            {
+               std::map< std::string , unsigned long int >::const_iterator found = layer_ids.find ( labels[ i ][ j ].layer_name );
+               
+               labels[ i ][ j ].layer_id = ( found != layer_ids.end () ) ? found->second : OpenCIF::LayerTable::NoLayer;
+            }
+         }
+      }
+      
+      // Only the symbols with labels (or calling symbols with labels) are followed.
+      std::vector< unsigned long int > order = hierarchy.getOrder ();
+      std::vector< bool > has_labels ( top , false );
+      
+      for ( unsigned long int i = 0; i < order.size (); i++ )
+      {
+         const std::vector< OpenCIF::Instance >& instances = hierarchy.getSymbol ( order[ i ] ).getInstances ();
+         
+         has_labels[ order[ i ] ] = !labels[ order[ i ] ].empty ();
+         
+         for ( unsigned long int j = 0; j < instances.size () && !has_labels[ order[ i ] ]; j++ )
+         {
+            has_labels[ order[ i ] ] = has_labels[ instances[ j ].getSymbol () ];
+         }
+      }
+      
+      std::vector< ConnectivityLabel > placed;
+      
+      placeLabels ( hierarchy , labels , has_labels , hierarchy.getTop () , top , OpenCIF::Transform () , placed );
+      
+      return ( placed );
+   }
+   
+   unsigned long int findRoot ( std::vector< unsigned long int >& parents , unsigned long int item )
+   {
+      while ( parents[ item ] != item )
+      {
+         parents[ item ] = parents[ parents[ item ] ];
+         item = parents[ item ];
+      }
+      
+      return ( item );
+   }
+   
+   /*
+    * Function to find the net of every shape. The shapes are all in layers
+    * of the stack.
+    */
+   void connect ( const OpenCIF::LayerStack& stack , const std::vector< OpenCIF::Shape >& shapes , const OpenCIF::SpatialIndex& index ,
+                  OpenCIF::ThreadPool& pool , std::vector< unsigned long int >& nets , unsigned long int& net_amount )
+   {
+      // The layers are replaced by dense indexes, to check the connections using a table.
+      std::vector< unsigned long int > layers = stack.getLayers ();
+      std::vector< unsigned long int > shape_slots ( shapes.size () );
+      std::vector< char > connected ( layers.size () * layers.size () );
+      
+      for ( unsigned long int i = 0; i < layers.size (); i++ )
+      {
+         for ( unsigned long int j = 0; j < layers.size (); j++ )
+         {
+            connected[ i * layers.size () + j ] = stack.connects ( layers[ i ] , layers[ j ] );
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < shapes.size (); i++ )
+      {
+         shape_slots[ i ] = std::lower_bound ( layers.begin () , layers.end () , shapes[ i ].getLayerID () ) - layers.begin ();
+      }
+      
+      std::vector< std::pair< unsigned long int , unsigned long int > > pairs;
+      std::mutex pairs_mutex;
+      
+      pool.parallelFor ( index.getTileAmount () , [ & ] ( unsigned long int first_tile , unsigned long int last_tile )
+      {
+         std::vector< std::pair< unsigned long int , unsigned long int > > found;
+         std::vector< unsigned long int > items;
+         
+         for ( unsigned long int tile = first_tile; tile < last_tile; tile++ )
+         {
+            items.clear ();
+            index.getTileItems ( tile , items );
+            
+            std::sort ( items.begin () , items.end () , [ & ] ( unsigned long int first , unsigned long int second )
+            {
+               return ( shapes[ first ].getBounds ().getLeft () < shapes[ second ].getBounds ().getLeft () );
+            } );
+            
+            for ( unsigned long int i = 0; i < items.size (); i++ )
+            {
+               const OpenCIF::Shape& first = shapes[ items[ i ] ];
+               
+               for ( unsigned long int j = i + 1; j < items.size (); j++ )
+               {
+                  const OpenCIF::Shape& second = shapes[ items[ j ] ];
+                  
+                  if ( second.getBounds ().getLeft () > first.getBounds ().getRight () )
+                  {
+                     break;
+                  }
+                  
+                  if ( !first.getBounds ().intersects ( second.getBounds () ) ||
+                       !connected[ shape_slots[ items[ i ] ] * layers.size () + shape_slots[ items[ j ] ] ] )
+                  {
+                     continue;
+                  }
+                  
+                  // The pair is checked only by the tile with the lower left corner of the intersection.
+                  OpenCIF::Point corner ( std::max ( first.getBounds ().getLeft () , second.getBounds ().getLeft () ) ,
+                                          std::max ( first.getBounds ().getBottom () , second.getBounds ().getBottom () ) );
+                  
+                  if ( index.findTile ( corner ) == tile && first.touches ( second ) )
+                  {
+                     found.push_back ( std::make_pair ( items[ i ] , items[ j ] ) );
+                  }
+               }
+            }
+         }
+         
+         std::lock_guard< std::mutex > lock ( pairs_mutex );
+         
+         pairs.insert ( pairs.end () , found.begin () , found.end () );
+      } );
+      
+      // Every net is represented by its first shape.
+      std::vector< unsigned long int > parents ( shapes.size () );
+      
+      for ( unsigned long int i = 0; i < parents.size (); i++ )
+      {
+         parents[ i ] = i;
+      }
+      
+      for ( unsigned long int i = 0; i < pairs.size (); i++ )
+      {
+         unsigned long int first = findRoot ( parents , pairs[ i ].first );
+         unsigned long int second = findRoot ( parents , pairs[ i ].second );
+         
+         if ( first != second )
+         {
+            parents[ std::max ( first , second ) ] = std::min ( first , second );
+         }
+      }
+      
+      nets.assign ( shapes.size () , OpenCIF::NetList::NoNet );
+      net_amount = 0;
+      
+      for ( unsigned long int i = 0; i < shapes.size (); i++ )
+      {
+         unsigned long int root = findRoot ( parents , i );
+         
+         nets[ i ] = ( root == i ) ? net_amount++ : nets[ root ];
+      }
+      
+      return;
+   }
+}
+
+/*
+ * Default constructor. An empty stack, the default expander, and the amount
+ * of threads chosen using the hardware.
+ */
+OpenCIF::Connectivity::Connectivity ( void )
+   : connectivity_thread_amount ( 0 )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Connectivity::~Connectivity ( void )
+{
+}
+
+void OpenCIF::Connectivity::setLayerStack ( const OpenCIF::LayerStack& new_layer_stack )
+{
+   connectivity_layer_stack = new_layer_stack;
+   
+   return;
+}
+
+void OpenCIF::Connectivity::setExpander ( const OpenCIF::Expander& new_expander )
+{
+   connectivity_expander = new_expander;
+   
+   return;
+}
+
+/*
+ * Member function to set the amount of threads used. With 0, the amount of
+ * threads is chosen using the hardware.
+ */
+void OpenCIF::Connectivity::setThreadAmount ( const unsigned long int& new_thread_amount )
+{
+   connectivity_thread_amount = new_thread_amount;
+   
+   return;
+}
+
+const OpenCIF::LayerStack& OpenCIF::Connectivity::getLayerStack ( void ) const
+{
+   return ( connectivity_layer_stack );
+}
+
+const OpenCIF::Expander& OpenCIF::Connectivity::getExpander ( void ) const
+{
+   return ( connectivity_expander );
+}
+
+unsigned long int OpenCIF::Connectivity::getThreadAmount ( void ) const
+{
+   return ( connectivity_thread_amount );
+}
+
+/*
+ * Member function to find the nets of a list of commands. The shapes of the
+ * result are the shapes of the layers of the stack, in the order they are
+ * drawn.
+ */
+OpenCIF::NetList OpenCIF::Connectivity::extract ( const std::vector< OpenCIF::Command* >& commands ) const
+{
+   OpenCIF::Flattener flattener;
+   std::vector< OpenCIF::Shape > shapes;
+   
+   flattener.setExpander ( connectivity_expander );
+   shapes = flattener.flatten ( commands );
+   shapes.erase ( std::remove_if ( shapes.begin () , shapes.end () , [ this ] ( const OpenCIF::Shape& shape )
+   {
+      return ( !connectivity_layer_stack.isUsed ( shape.getLayerID () ) );
+   } ) , shapes.end () );
+   
+   OpenCIF::NetList netlist;
+   OpenCIF::SpatialIndex index;
+   OpenCIF::ThreadPool pool ( connectivity_thread_amount );
+   std::vector< unsigned long int > nets;
+   unsigned long int net_amount = 0;
+   
+   index.build ( shapes );
+   connect ( connectivity_layer_stack , shapes , index , pool , nets , net_amount );
+   
+   // The first label placed on a net gives its name.
+   std::vector< ConnectivityLabel > labels = findLabels ( commands );
+   std::vector< unsigned long int > candidates;
+   
+   netlist.setNets ( std::vector< unsigned long int > ( nets ) , net_amount );
+   
+   for ( unsigned long int i = 0; i < labels.size (); i++ )
+   {
+      bool any_conductor = !connectivity_layer_stack.isUsed ( labels[ i ].layer_id );
+      unsigned long int shape = OpenCIF::NetList::NoNet;
+      
+      candidates.clear ();
+      index.query ( labels[ i ].position , candidates );
+      
+      for ( unsigned long int j = 0; j < candidates.size (); j++ )
+      {
+         unsigned long int layer_id = shapes[ candidates[ j ] ].getLayerID ();
+         
+         if ( ( any_conductor ? connectivity_layer_stack.isConductor ( layer_id ) : layer_id == labels[ i ].layer_id ) &&
+              candidates[ j ] < shape && shapes[ candidates[ j ] ].contains ( labels[ i ].position ) )
+         {
+            shape = candidates[ j ];
+         }
+      }
+      
+      if ( shape != OpenCIF::NetList::NoNet && netlist.getName ( nets[ shape ] ).empty () )
+      {
+         netlist.setName ( nets[ shape ] , labels[ i ].name );
+      }
+   }
+   
+   netlist.setShapes ( std::move ( shapes ) );
+   
+   return ( netlist );
+}
+
+/*
+ * Member function to find the nets of a list of shapes (without names). The
+ * shapes outside the layers of the stack are not included in the result.
+ */
+OpenCIF::NetList OpenCIF::Connectivity::extract ( const std::vector< OpenCIF::Shape >& shapes ) const
+{
+   std::vector< OpenCIF::Shape > stack_shapes;
+   
+   for ( unsigned long int i = 0; i < shapes.size (); i++ )
+   {
+      if ( connectivity_layer_stack.isUsed ( shapes[ i ].getLayerID () ) )
+      {
+         stack_shapes.push_back ( shapes[ i ] );
+      }
+   }
+   
+   OpenCIF::NetList netlist;
+   OpenCIF::SpatialIndex index;
+   OpenCIF::ThreadPool pool ( connectivity_thread_amount );
+   std::vector< unsigned long int > nets;
+   unsigned long int net_amount = 0;
+   
+   index.build ( stack_shapes );
+   connect ( connectivity_layer_stack , stack_shapes , index , pool , nets , net_amount );
+   netlist.setNets ( std::move ( nets ) , net_amount );
+   netlist.setShapes ( std::move ( stack_shapes ) );
+   
+   return ( netlist );
+}
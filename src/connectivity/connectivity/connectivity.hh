@@ -0,0 +1,75 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_CONNECTIVITY_HH_
+# define LIBOPENCIF_CONNECTIVITY_HH_
+
+# include <vector>
+
+# include "../layerstack/layerstack.hh"
+# include "../netlist/netlist.hh"
+# include "../../command/command.hh"
+# include "../../geometry/shape/shape.hh"
+# include "../../geometry/expander/expander.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class finds the nets of a design: the groups of shapes connected
+    * through the layers of a stack. Two shapes are connected if they touch
+    * (or overlap) and their layers are the same, or one of them is a via
+    * that connects the layer of the other one.
+    *
+    * The design is flattened, and the shapes of the stack are kept in a
+    * spatial index. The tiles of the index are swept in parallel to find the
+    * pairs of shapes that touch, and the pairs are joined using a union-find.
+    *
+    * The labels given with the "94" user extension ("94 name x y [layer]")
+    * name the net of the shape they are placed on. Labels inside symbols are
+    * placed with every call. If a label has no layer, the layer selected when
+    * it's found is used, and if that layer isn't in the stack, any conductor.
+    */
+   class Connectivity
+   {
+      public:
+         explicit Connectivity ( void );
+         virtual ~Connectivity ( void );
+         
+         void setLayerStack ( const OpenCIF::LayerStack& new_layer_stack );
+         void setExpander ( const OpenCIF::Expander& new_expander );
+         void setThreadAmount ( const unsigned long int& new_thread_amount );
+         const OpenCIF::LayerStack& getLayerStack ( void ) const;
+         const OpenCIF::Expander& getExpander ( void ) const;
+         unsigned long int getThreadAmount ( void ) const;
+         
+         OpenCIF::NetList extract ( const std::vector< OpenCIF::Command* >& commands ) const;
+         OpenCIF::NetList extract ( const std::vector< OpenCIF::Shape >& shapes ) const;
+      
+      private:
+         OpenCIF::LayerStack connectivity_layer_stack;
+         OpenCIF::Expander connectivity_expander;
+         unsigned long int connectivity_thread_amount;
+   };
+}
+
+# endif
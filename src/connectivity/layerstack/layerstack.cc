@@ -0,0 +1,115 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <algorithm>
+
+# include "layerstack.hh"
+
+/*
+ * Default constructor. An empty stack.
+ */
+OpenCIF::LayerStack::LayerStack ( void )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::LayerStack::~LayerStack ( void )
+{
+}
+
+void OpenCIF::LayerStack::addConductor ( const unsigned long int& layer_id )
+{
+   stack_conductors.insert ( layer_id );
+   
+   return;
+}
+
+/*
+ * Member function to add a via layer. The layers connected by the via are
+ * added as conductors.
+ */
+void OpenCIF::LayerStack::addVia ( const unsigned long int& via_layer_id , const unsigned long int& lower_layer_id ,
+                                   const unsigned long int& upper_layer_id )
+{
+   stack_vias.insert ( via_layer_id );
+   stack_conductors.insert ( lower_layer_id );
+   stack_conductors.insert ( upper_layer_id );
+   stack_connections.insert ( std::make_pair ( std::min ( via_layer_id , lower_layer_id ) , std::max ( via_layer_id , lower_layer_id ) ) );
+   stack_connections.insert ( std::make_pair ( std::min ( via_layer_id , upper_layer_id ) , std::max ( via_layer_id , upper_layer_id ) ) );
+   
+   return;
+}
+
+void OpenCIF::LayerStack::clear ( void )
+{
+   stack_conductors.clear ();
+   stack_vias.clear ();
+   stack_connections.clear ();
+   
+   return;
+}
+
+bool OpenCIF::LayerStack::isUsed ( const unsigned long int& layer_id ) const
+{
+   return ( isConductor ( layer_id ) || isVia ( layer_id ) );
+}
+
+bool OpenCIF::LayerStack::isConductor ( const unsigned long int& layer_id ) const
+{
+   return ( stack_conductors.count ( layer_id ) > 0 );
+}
+
+bool OpenCIF::LayerStack::isVia ( const unsigned long int& layer_id ) const
+{
+   return ( stack_vias.count ( layer_id ) > 0 );
+}
+
+/*
+ * Member function to know if shapes of two layers are connected when they
+ * touch: shapes of the same layer, and vias with the layers they connect.
+ */
+bool OpenCIF::LayerStack::connects ( const unsigned long int& first_layer_id , const unsigned long int& second_layer_id ) const
+{
+   if ( first_layer_id == second_layer_id )
+   {
+      return ( isUsed ( first_layer_id ) );
+   }
+   
+   return ( stack_connections.count ( std::make_pair ( std::min ( first_layer_id , second_layer_id ) ,
+                                                       std::max ( first_layer_id , second_layer_id ) ) ) > 0 );
+}
+
+/*
+ * Member function to return every layer of the stack (conductors and vias),
+ * sorted by ID.
+ */
+std::vector< unsigned long int > OpenCIF::LayerStack::getLayers ( void ) const
+{
+   std::set< unsigned long int > layers ( stack_conductors );
+   
+   layers.insert ( stack_vias.begin () , stack_vias.end () );
+   
+   return ( std::vector< unsigned long int > ( layers.begin () , layers.end () ) );
+}
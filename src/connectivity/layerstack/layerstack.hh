@@ -0,0 +1,64 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_LAYERSTACK_HH_
+# define LIBOPENCIF_LAYERSTACK_HH_
+
+# include <set>
+# include <utility>
+# include <vector>
+
+namespace OpenCIF
+{
+   /*
+    * This class describes how the layers of a process are connected: the
+    * conducting layers (metals, polysilicon, diffusion), and the via (or
+    * contact) layers, that connect a pair of conducting layers where they
+    * overlap.
+    *
+    * The layers are given using the IDs of the layer table of the file.
+    */
+   class LayerStack
+   {
+      public:
+         explicit LayerStack ( void );
+         virtual ~LayerStack ( void );
+         
+         void addConductor ( const unsigned long int& layer_id );
+         void addVia ( const unsigned long int& via_layer_id , const unsigned long int& lower_layer_id , const unsigned long int& upper_layer_id );
+         void clear ( void );
+         
+         bool isUsed ( const unsigned long int& layer_id ) const;
+         bool isConductor ( const unsigned long int& layer_id ) const;
+         bool isVia ( const unsigned long int& layer_id ) const;
+         bool connects ( const unsigned long int& first_layer_id , const unsigned long int& second_layer_id ) const;
+         std::vector< unsigned long int > getLayers ( void ) const;
+      
+      private:
+         std::set< unsigned long int > stack_conductors;
+         std::set< unsigned long int > stack_vias;
+         std::set< std::pair< unsigned long int , unsigned long int > > stack_connections;
+   };
+}
+
+# endif
@@ -0,0 +1,134 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "netlist.hh"
+
+/*
+ * Net returned when a name is not found.
+ */
+const unsigned long int OpenCIF::NetList::NoNet = (unsigned long int)( -1 );
+
+/*
+ * Default constructor. An empty list, without nets.
+ */
+OpenCIF::NetList::NetList ( void )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::NetList::~NetList ( void )
+{
+}
+
+void OpenCIF::NetList::setShapes ( std::vector< OpenCIF::Shape >&& new_shapes )
+{
+   netlist_shapes = std::move ( new_shapes );
+   
+   return;
+}
+
+/*
+ * Member function to set the net of every shape (in the same order as the
+ * shapes). The names of the nets are removed.
+ */
+void OpenCIF::NetList::setNets ( std::vector< unsigned long int >&& new_nets , const unsigned long int& new_net_amount )
+{
+   netlist_nets = std::move ( new_nets );
+   netlist_names.assign ( new_net_amount , std::string () );
+   netlist_named_nets.clear ();
+   
+   return;
+}
+
+/*
+ * Member function to give a name to a net. If the net had a name, it's
+ * replaced.
+ */
+void OpenCIF::NetList::setName ( const unsigned long int& net , const std::string& new_name )
+{
+   if ( !netlist_names[ net ].empty () )
+   {
+      netlist_named_nets.erase ( netlist_names[ net ] );
+   }
+   
+   netlist_names[ net ] = new_name;
+   netlist_named_nets[ new_name ] = net;
+   
+   return;
+}
+
+const std::vector< OpenCIF::Shape >& OpenCIF::NetList::getShapes ( void ) const
+{
+   return ( netlist_shapes );
+}
+
+const std::vector< unsigned long int >& OpenCIF::NetList::getNets ( void ) const
+{
+   return ( netlist_nets );
+}
+
+unsigned long int OpenCIF::NetList::getNet ( const unsigned long int& shape ) const
+{
+   return ( netlist_nets[ shape ] );
+}
+
+unsigned long int OpenCIF::NetList::getNetAmount ( void ) const
+{
+   return ( netlist_names.size () );
+}
+
+/*
+ * Member function to return the indexes of the shapes of a net.
+ */
+std::vector< unsigned long int > OpenCIF::NetList::getNetShapes ( const unsigned long int& net ) const
+{
+   std::vector< unsigned long int > shapes;
+   
+   for ( unsigned long int i = 0; i < netlist_nets.size (); i++ )
+   {
+      if ( netlist_nets[ i ] == net )
+      {
+         shapes.push_back ( i );
+      }
+   }
+   
+   return ( shapes );
+}
+
+/*
+ * Member function to return the name of a net, or an empty string if it
+ * has no name.
+ */
+const std::string& OpenCIF::NetList::getName ( const unsigned long int& net ) const
+{
+   return ( netlist_names[ net ] );
+}
+
+unsigned long int OpenCIF::NetList::findNet ( const std::string& name ) const
+{
+   std::map< std::string , unsigned long int >::const_iterator found = netlist_named_nets.find ( name );
+   
+   return ( ( found != netlist_named_nets.end () ) ? found->second : NoNet );
+}
@@ -0,0 +1,70 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_NETLIST_HH_
+# define LIBOPENCIF_NETLIST_HH_
+
+# include <map>
+# include <string>
+# include <vector>
+
+# include "../../geometry/shape/shape.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class keeps the result of a connectivity extraction: the shapes of
+    * the layers of the stack, and the net of every shape. The nets are
+    * numbered from 0, in the order of their first shape. A net can have a
+    * name, taken from a label.
+    */
+   class NetList
+   {
+      public:
+         static const unsigned long int NoNet;
+      
+      public:
+         explicit NetList ( void );
+         virtual ~NetList ( void );
+         
+         void setShapes ( std::vector< OpenCIF::Shape >&& new_shapes );
+         void setNets ( std::vector< unsigned long int >&& new_nets , const unsigned long int& new_net_amount );
+         void setName ( const unsigned long int& net , const std::string& new_name );
+         
+         const std::vector< OpenCIF::Shape >& getShapes ( void ) const;
+         const std::vector< unsigned long int >& getNets ( void ) const;
+         unsigned long int getNet ( const unsigned long int& shape ) const;
+         unsigned long int getNetAmount ( void ) const;
+         std::vector< unsigned long int > getNetShapes ( const unsigned long int& net ) const;
+         const std::string& getName ( const unsigned long int& net ) const;
+         unsigned long int findNet ( const std::string& name ) const;
+      
+      private:
+         std::vector< OpenCIF::Shape > netlist_shapes;
+         std::vector< unsigned long int > netlist_nets;
+         std::vector< std::string > netlist_names;
+         std::map< std::string , unsigned long int > netlist_named_nets;
+   };
+}
+
+# endif
@@ -0,0 +1,791 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <algorithm>
+# include <cmath>
+# include <map>
+# include <utility>
+
+# include "density.hh"
+# include "../../geometry/boolean/boolean.hh"
+# include "../../command/primitivecommand/primitivecommand.hh"
+# include "../../threadpool/threadpool.hh"
+
+namespace
+{
+   /*
+    * Function to divide rounding towards minus infinity (the divisor is
+    * positive).
+    */
+   long int floorDivide ( const long int& value , const long int& divisor )
+   {
+      long int quotient = value / divisor;
+      
+      return ( ( value % divisor != 0 && value < 0 ) ? quotient - 1 : quotient );
+   }
+   
+   unsigned long int greatestCommonDivisor ( unsigned long int first , unsigned long int second )
+   {
+      while ( second != 0 )
+      {
+         unsigned long int rest = first % second;
+         
+         first = second;
+         second = rest;
+      }
+      
+      return ( first );
+   }
+   
+   /*
+    * Area covered inside every cell of a symbol, per layer measured. The
+    * cells are indexed by their lower left corner divided by the side.
+    */
+   struct DensityGrid
+   {
+      long int first_column;
+      long int first_row;
+      long int columns;
+      long int rows;
+      std::vector< std::vector< double > > areas;
+      
+      DensityGrid ( void )
+         : first_column ( 0 ) , first_row ( 0 ) , columns ( 0 ) , rows ( 0 )
+      {
+      }
+   };
+   
+   /*
+    * State of a single computation.
+    */
+   struct DensityContext
+   {
+      const std::vector< OpenCIF::Command* >& commands;
+      const OpenCIF::Hierarchy& hierarchy;
+      const OpenCIF::Expander& expander;
+      long int cell;
+      std::vector< unsigned long int > layers;
+      std::map< unsigned long int , unsigned long int > slots;
+      std::vector< DensityGrid > grids;
+      
+      DensityContext ( const std::vector< OpenCIF::Command* >& new_commands , const OpenCIF::Hierarchy& new_hierarchy ,
+                       const OpenCIF::Expander& new_expander , const long int& new_cell )
+         : commands ( new_commands ) , hierarchy ( new_hierarchy ) , expander ( new_expander ) , cell ( new_cell ) ,
+           grids ( new_hierarchy.getSymbolAmount () )
+      {
+      }
+   };
+   
+   /*
+    * Function to return the first and last cells (both included) touched by
+    * a rectangle.
+    */
+   OpenCIF::Rectangle cellRange ( const DensityContext& context , const OpenCIF::Rectangle& rectangle )
+   {
+      return ( OpenCIF::Rectangle ( floorDivide ( rectangle.getLeft () , context.cell ) ,
+                                    floorDivide ( rectangle.getBottom () , context.cell ) ,
+                                    floorDivide ( std::max ( rectangle.getRight () - 1 , rectangle.getLeft () ) , context.cell ) ,
+                                    floorDivide ( std::max ( rectangle.getTop () - 1 , rectangle.getBottom () ) , context.cell ) ) );
+   }
+   
+   OpenCIF::Rectangle cellRectangle ( const DensityContext& context , const long int& column , const long int& row )
+   {
+      return ( OpenCIF::Rectangle ( column * context.cell , row * context.cell , ( column + 1 ) * context.cell , ( row + 1 ) * context.cell ) );
+   }
+   
+   /*
+    * Function to know if a placement maps cells into cells.
+    */
+   bool isAligned ( const DensityContext& context , const OpenCIF::Transform& transform )
+   {
+      if ( !transform.isOrthogonal () || !transform.isInteger () )
+      {
+         return ( false );
+      }
+      
+      if ( std::fabs ( transform.getA () ) + std::fabs ( transform.getB () ) != 1 || std::fabs ( transform.getC () ) + std::fabs ( transform.getD () ) != 1 )
+      {
+         return ( false );
+      }
+      
+      return ( std::fmod ( transform.getDX () , context.cell ) == 0 && std::fmod ( transform.getDY () , context.cell ) == 0 );
+   }
+   
+   /*
+    * Function to expand the primitives of a symbol placed using a
+    * transformation, keeping the layers measured.
+    */
+   void expandPrimitives ( const DensityContext& context , const OpenCIF::Symbol& symbol , const OpenCIF::Transform& transform ,
+                           std::vector< std::vector< OpenCIF::Shape > >& shapes )
+   {
+      const std::vector< unsigned long int >& primitives = symbol.getPrimitives ();
+      std::vector< OpenCIF::Shape > expanded;
+      
+      for ( unsigned long int i = 0; i < primitives.size (); i++ )
+      {
+         expanded.clear ();
+         context.expander.expand ( context.commands[ primitives[ i ] ] , expanded );
+         
+         for ( unsigned long int j = 0; j < expanded.size (); j++ )
+         {
+            std::map< unsigned long int , unsigned long int >::const_iterator slot = context.slots.find ( expanded[ j ].getLayerID () );
+            
+            if ( slot != context.slots.end () )
+            {
+               shapes[ slot->second ].push_back ( transform.isIdentity () ? std::move ( expanded[ j ] ) : transform.apply ( expanded[ j ] ) );
+            }
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to expand the primitives of a symbol, and of the symbols it
+    * calls.
+    */
+   void collect ( const DensityContext& context , const OpenCIF::Symbol& symbol , const OpenCIF::Transform& transform ,
+                  std::vector< std::vector< OpenCIF::Shape > >& shapes )
+   {
+      const std::vector< OpenCIF::Instance >& instances = symbol.getInstances ();
+      
+      expandPrimitives ( context , symbol , transform , shapes );
+      
+      for ( unsigned long int i = 0; i < instances.size (); i++ )
+      {
+         collect ( context , context.hierarchy.getSymbol ( instances[ i ].getSymbol () ) , transform * instances[ i ].getTransform () , shapes );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to expand the primitives of a symbol placed using a
+    * transformation, and of the symbols it calls, that touch a window. The
+    * called symbols are skipped using the extent of their cells.
+    */
+   void collectWindow ( const DensityContext& context , const OpenCIF::Symbol& symbol , const OpenCIF::Transform& transform ,
+                        const OpenCIF::Rectangle& window , std::vector< std::vector< OpenCIF::Shape > >& shapes )
+   {
+      const std::vector< OpenCIF::Instance >& instances = symbol.getInstances ();
+      std::vector< std::vector< OpenCIF::Shape > > expanded ( shapes.size () );
+      
+      expandPrimitives ( context , symbol , transform , expanded );
+      
+      for ( unsigned long int slot = 0; slot < expanded.size (); slot++ )
+      {
+         for ( unsigned long int i = 0; i < expanded[ slot ].size (); i++ )
+         {
+            if ( !expanded[ slot ][ i ].getBounds ().intersection ( window ).isEmpty () )
+            {
+               shapes[ slot ].push_back ( std::move ( expanded[ slot ][ i ] ) );
+            }
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < instances.size (); i++ )
+      {
+         const DensityGrid& called = context.grids[ instances[ i ].getSymbol () ];
+         OpenCIF::Transform placement = transform * instances[ i ].getTransform ();
+         
+         if ( called.columns == 0 )
+         {
+            continue;
+         }
+         
+         OpenCIF::Rectangle called_extent ( called.first_column * context.cell , called.first_row * context.cell ,
+                                            ( called.first_column + called.columns ) * context.cell ,
+                                            ( called.first_row + called.rows ) * context.cell );
+         
+         if ( !placement.apply ( called_extent ).intersection ( window ).isEmpty () )
+         {
+            collectWindow ( context , context.hierarchy.getSymbol ( instances[ i ].getSymbol () ) , placement , window , shapes );
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to compute the area of a polygon clipped to a rectangle
+    * (Sutherland-Hodgman).
+    */
+   double clippedArea ( const std::vector< OpenCIF::Point >& points , const OpenCIF::Rectangle& rectangle )
+   {
+      std::vector< std::pair< double , double > > polygon;
+      std::vector< std::pair< double , double > > clipped;
+      
+      for ( unsigned long int i = 0; i < points.size (); i++ )
+      {
+         polygon.push_back ( std::make_pair ( (double)( points[ i ].getX () ) , (double)( points[ i ].getY () ) ) );
+      }
+      
+      for ( int side = 0; side < 4 && !polygon.empty (); side++ )
+      {
+         // The sides are left, right, bottom and top: the coordinate checked, and the sign of the inside.
+         bool vertical = ( side < 2 );
+         double limit = ( side == 0 ) ? rectangle.getLeft () : ( side == 1 ) ? rectangle.getRight () : ( side == 2 ) ? rectangle.getBottom () : rectangle.getTop ();
+         double sign = ( side == 0 || side == 2 ) ? 1 : -1;
+         
+         clipped.clear ();
+         
+         for ( unsigned long int i = 0; i < polygon.size (); i++ )
+         {
+            const std::pair< double , double >& current = polygon[ i ];
+            const std::pair< double , double >& next = polygon[ ( i + 1 ) % polygon.size () ];
+            double current_distance = sign * ( ( vertical ? current.first : current.second ) - limit );
+            double next_distance = sign * ( ( vertical ? next.first : next.second ) - limit );
+            
+            if ( current_distance >= 0 )
+            {
+               clipped.push_back ( current );
+            }
+            
+            if ( ( current_distance >= 0 ) != ( next_distance >= 0 ) )
+            {
+               double t = current_distance / ( current_distance - next_distance );
+               
+               clipped.push_back ( std::make_pair ( current.first + t * ( next.first - current.first ) , current.second + t * ( next.second - current.second ) ) );
+            }
+         }
+         
+         polygon.swap ( clipped );
+      }
+      
+      double area = 0;
+      
+      for ( unsigned long int i = 0; i < polygon.size (); i++ )
+      {
+         const std::pair< double , double >& current = polygon[ i ];
+         const std::pair< double , double >& next = polygon[ ( i + 1 ) % polygon.size () ];
+         
+         area += current.first * next.second - next.first * current.second;
+      }
+      
+      return ( std::fabs ( area ) / 2 );
+   }
+   
+   /*
+    * Function to add the area of a shape to the cells it touches.
+    */
+   void addArea ( const DensityContext& context , const OpenCIF::Shape& shape , DensityGrid& grid , const unsigned long int& slot )
+   {
+      OpenCIF::Rectangle range = cellRange ( context , shape.getBounds () );
+      std::vector< double >& areas = grid.areas[ slot ];
+      
+      for ( long int row = range.getBottom (); row <= range.getTop (); row++ )
+      {
+         for ( long int column = range.getLeft (); column <= range.getRight (); column++ )
+         {
+            OpenCIF::Rectangle cell = cellRectangle ( context , column , row );
+            double area = 0;
+            
+            if ( shape.isRectangle () )
+            {
+               OpenCIF::Rectangle inside = shape.getBounds ().intersection ( cell );
+               
+               area = inside.isEmpty () ? 0 : (double)( inside.getArea () );
+            }
+            else
+            {
+               area = clippedArea ( shape.getPoints () , cell );
+            }
+            
+            areas[ ( row - grid.first_row ) * grid.columns + ( column - grid.first_column ) ] += area;
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to compute the cells of a symbol, once the cells of the symbols
+    * it calls are known.
+    */
+   void computeGrid ( const DensityContext& context , const OpenCIF::Symbol& symbol , DensityGrid& grid , OpenCIF::ThreadPool& pool )
+   {
+      const std::vector< OpenCIF::Instance >& instances = symbol.getInstances ();
+      std::vector< std::vector< OpenCIF::Shape > > shapes ( context.layers.size () );
+      std::vector< const OpenCIF::Instance* > aligned;
+      OpenCIF::Rectangle extent;
+      
+      expandPrimitives ( context , symbol , OpenCIF::Transform () , shapes );
+      
+      for ( unsigned long int i = 0; i < instances.size (); i++ )
+      {
+         const DensityGrid& called = context.grids[ instances[ i ].getSymbol () ];
+         
+         if ( isAligned ( context , instances[ i ].getTransform () ) )
+         {
+            if ( called.columns > 0 )
+            {
+               OpenCIF::Rectangle called_extent ( called.first_column * context.cell , called.first_row * context.cell ,
+                                                  ( called.first_column + called.columns ) * context.cell ,
+                                                  ( called.first_row + called.rows ) * context.cell );
+               
+               extent.add ( cellRange ( context , instances[ i ].getTransform ().apply ( called_extent ) ) );
+               aligned.push_back ( &instances[ i ] );
+            }
+         }
+         else
+         {
+            collect ( context , context.hierarchy.getSymbol ( instances[ i ].getSymbol () ) , instances[ i ].getTransform () , shapes );
+         }
+      }
+      
+      for ( unsigned long int slot = 0; slot < shapes.size (); slot++ )
+      {
+         for ( unsigned long int i = 0; i < shapes[ slot ].size (); i++ )
+         {
+            extent.add ( cellRange ( context , shapes[ slot ][ i ].getBounds () ) );
+         }
+      }
+      
+      if ( extent.isEmpty () )
+      {
+         return;
+      }
+      
+      grid.first_column = extent.getLeft ();
+      grid.first_row = extent.getBottom ();
+      grid.columns = extent.getRight () - extent.getLeft () + 1;
+      grid.rows = extent.getTop () - extent.getBottom () + 1;
+      grid.areas.assign ( context.layers.size () , std::vector< double > ( grid.columns * grid.rows , 0 ) );
+      
+      OpenCIF::Boolean boolean;
+      std::vector< OpenCIF::Shape > nothing;
+      
+      for ( unsigned long int slot = 0; slot < shapes.size (); slot++ )
+      {
+         if ( shapes[ slot ].empty () )
+         {
+            continue;
+         }
+         
+         std::vector< OpenCIF::Shape > merged = boolean.compute ( shapes[ slot ] , OpenCIF::Boolean::Union , nothing , context.layers[ slot ] , pool );
+         
+         for ( unsigned long int i = 0; i < merged.size (); i++ )
+         {
+            addArea ( context , merged[ i ] , grid , slot );
+         }
+      }
+      
+      // The cells where more than one source (the merged shapes of the symbol, or a placement added by
+      // cells) has area can count the same area twice, so they are marked, and computed again exactly.
+      std::vector< std::vector< unsigned char > > sources ( grid.areas.size () , std::vector< unsigned char > ( grid.areas[ 0 ].size () , 0 ) );
+      
+      for ( unsigned long int slot = 0; slot < grid.areas.size (); slot++ )
+      {
+         for ( unsigned long int i = 0; i < grid.areas[ slot ].size (); i++ )
+         {
+            sources[ slot ][ i ] = ( grid.areas[ slot ][ i ] > 0 ) ? 1 : 0;
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < aligned.size (); i++ )
+      {
+         const DensityGrid& called = context.grids[ aligned[ i ]->getSymbol () ];
+         const OpenCIF::Transform& transform = aligned[ i ]->getTransform ();
+         
+         for ( long int row = 0; row < called.rows; row++ )
+         {
+            for ( long int column = 0; column < called.columns; column++ )
+            {
+               OpenCIF::Rectangle image = transform.apply ( cellRectangle ( context , called.first_column + column , called.first_row + row ) );
+               long int index = ( floorDivide ( image.getBottom () , context.cell ) - grid.first_row ) * grid.columns +
+                                ( floorDivide ( image.getLeft () , context.cell ) - grid.first_column );
+               
+               for ( unsigned long int slot = 0; slot < called.areas.size (); slot++ )
+               {
+                  double area = called.areas[ slot ][ row * called.columns + column ];
+                  
+                  if ( area > 0 )
+                  {
+                     grid.areas[ slot ][ index ] += area;
+                     sources[ slot ][ index ] = std::min ( sources[ slot ][ index ] + 1 , 2 );
+                  }
+               }
+            }
+         }
+      }
+      
+      std::vector< std::vector< OpenCIF::Shape > > local ( context.layers.size () );
+      
+      for ( long int row = 0; row < grid.rows; row++ )
+      {
+         for ( long int column = 0; column < grid.columns; column++ )
+         {
+            long int index = row * grid.columns + column;
+            OpenCIF::Rectangle cell = cellRectangle ( context , grid.first_column + column , grid.first_row + row );
+            bool shared = false;
+            
+            for ( unsigned long int slot = 0; slot < sources.size () && !shared; slot++ )
+            {
+               shared = ( sources[ slot ][ index ] > 1 );
+            }
+            
+            if ( !shared )
+            {
+               continue;
+            }
+            
+            for ( unsigned long int slot = 0; slot < local.size (); slot++ )
+            {
+               local[ slot ].clear ();
+            }
+            
+            collectWindow ( context , symbol , OpenCIF::Transform () , cell , local );
+            
+            for ( unsigned long int slot = 0; slot < local.size (); slot++ )
+            {
+               if ( sources[ slot ][ index ] < 2 )
+               {
+                  continue;
+               }
+               
+               std::vector< OpenCIF::Shape > merged = boolean.compute ( local[ slot ] , OpenCIF::Boolean::Union , nothing , context.layers[ slot ] );
+               double area = 0;
+               
+               for ( unsigned long int i = 0; i < merged.size (); i++ )
+               {
+                  if ( merged[ i ].isRectangle () )
+                  {
+                     OpenCIF::Rectangle inside = merged[ i ].getBounds ().intersection ( cell );
+                     
+                     area += inside.isEmpty () ? 0 : (double)( inside.getArea () );
+                  }
+                  else
+                  {
+                     area += clippedArea ( merged[ i ].getPoints () , cell );
+                  }
+               }
+               
+               grid.areas[ slot ][ index ] = area;
+            }
+         }
+      }
+      
+      // Rounding can't leave more than the whole cell.
+      double cell_area = (double)( context.cell ) * (double)( context.cell );
+      
+      for ( unsigned long int slot = 0; slot < grid.areas.size (); slot++ )
+      {
+         for ( unsigned long int i = 0; i < grid.areas[ slot ].size (); i++ )
+         {
+            grid.areas[ slot ][ i ] = std::min ( grid.areas[ slot ][ i ] , cell_area );
+         }
+      }
+      
+      return;
+   }
+}
+
+/*
+ * Default constructor. Windows of 10000 units (100 micrometers, using the
+ * default units of CIF), every 5000 units, over the whole design, for every
+ * layer used.
+ */
+OpenCIF::Density::Density ( void )
+   : density_window_size ( 10000 ) , density_step ( 5000 ) , density_thread_amount ( 0 )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Density::~Density ( void )
+{
+}
+
+void OpenCIF::Density::setWindowSize ( const unsigned long int& new_window_size )
+{
+   density_window_size = new_window_size;
+   
+   return;
+}
+
+void OpenCIF::Density::setStep ( const unsigned long int& new_step )
+{
+   density_step = new_step;
+   
+   return;
+}
+
+/*
+ * Member function to set the region covered by the windows. An empty
+ * rectangle means the bounding box of the design.
+ */
+void OpenCIF::Density::setRegion ( const OpenCIF::Rectangle& new_region )
+{
+   density_region = new_region;
+   
+   return;
+}
+
+/*
+ * Member function to set the layers measured (a map per layer, in the same
+ * order). An empty list means every layer used by a primitive.
+ */
+void OpenCIF::Density::setLayers ( const std::vector< unsigned long int >& new_layers )
+{
+   density_layers = new_layers;
+   
+   return;
+}
+
+void OpenCIF::Density::setExpander ( const OpenCIF::Expander& new_expander )
+{
+   density_expander = new_expander;
+   
+   return;
+}
+
+/*
+ * Member function to set the amount of threads used. With 0, the amount of
+ * threads is chosen using the hardware.
+ */
+void OpenCIF::Density::setThreadAmount ( const unsigned long int& new_thread_amount )
+{
+   density_thread_amount = new_thread_amount;
+   
+   return;
+}
+
+unsigned long int OpenCIF::Density::getWindowSize ( void ) const
+{
+   return ( density_window_size );
+}
+
+unsigned long int OpenCIF::Density::getStep ( void ) const
+{
+   return ( density_step );
+}
+
+const OpenCIF::Rectangle& OpenCIF::Density::getRegion ( void ) const
+{
+   return ( density_region );
+}
+
+const std::vector< unsigned long int >& OpenCIF::Density::getLayers ( void ) const
+{
+   return ( density_layers );
+}
+
+const OpenCIF::Expander& OpenCIF::Density::getExpander ( void ) const
+{
+   return ( density_expander );
+}
+
+unsigned long int OpenCIF::Density::getThreadAmount ( void ) const
+{
+   return ( density_thread_amount );
+}
+
+/*
+ * Member function to compute the density maps of a list of commands.
+ */
+std::vector< OpenCIF::DensityMap > OpenCIF::Density::compute ( const std::vector< OpenCIF::Command* >& commands ) const
+{
+   return ( compute ( commands , OpenCIF::Hierarchy ( commands ) ) );
+}
+
+/*
+ * Member function to compute the density maps of a list of commands, using
+ * a hierarchy already built for them. If the size of the windows or the step
+ * is 0, no map is returned.
+ */
+std::vector< OpenCIF::DensityMap > OpenCIF::Density::compute ( const std::vector< OpenCIF::Command* >& commands ,
+                                                               const OpenCIF::Hierarchy& hierarchy ) const
+{
+   std::vector< OpenCIF::DensityMap > maps;
+   
+   if ( density_window_size == 0 || density_step == 0 )
+   {
+      return ( maps );
+   }
+   
+   DensityContext context ( commands , hierarchy , density_expander , greatestCommonDivisor ( density_window_size , density_step ) );
+   
+   context.layers = density_layers;
+   
+   if ( context.layers.empty () )
+   {
+      std::map< unsigned long int , bool > used;
+      
+      for ( unsigned long int i = 0; i < commands.size (); i++ )
+      {
+         switch ( commands[ i ]->type () )
+         {
+            case OpenCIF::Command::Box:
+            case OpenCIF::Command::Polygon:
+            case OpenCIF::Command::Wire:
+            case OpenCIF::Command::RoundFlash:
+               used[ static_cast< OpenCIF::PrimitiveCommand* > ( commands[ i ] )->getLayerID () ] = true;
+               break;
+            
+            default:
+               break;
+         }
+      }
+      
+      for ( std::map< unsigned long int , bool >::const_iterator layer = used.begin (); layer != used.end (); layer++ )
+      {
+         context.layers.push_back ( layer->first );
+      }
+   }
+   
+   for ( unsigned long int slot = 0; slot < context.layers.size (); slot++ )
+   {
+      context.slots[ context.layers[ slot ] ] = slot;
+   }
+   
+   // The symbols are grouped by depth (the symbols that call nothing have depth 0), so a group only needs the groups before it.
+   std::vector< unsigned long int > order = hierarchy.getOrder ();
+   std::vector< unsigned long int > depths ( hierarchy.getSymbolAmount () , 0 );
+   std::vector< std::vector< unsigned long int > > groups;
+   
+   for ( unsigned long int i = 0; i < order.size (); i++ )
+   {
+      const std::vector< OpenCIF::Instance >& instances = hierarchy.getSymbol ( order[ i ] ).getInstances ();
+      unsigned long int depth = 0;
+      
+      for ( unsigned long int j = 0; j < instances.size (); j++ )
+      {
+         depth = std::max ( depth , depths[ instances[ j ].getSymbol () ] + 1 );
+      }
+      
+      depths[ order[ i ] ] = depth;
+      
+      if ( groups.size () <= depth )
+      {
+         groups.resize ( depth + 1 );
+      }
+      
+      groups[ depth ].push_back ( order[ i ] );
+   }
+   
+   OpenCIF::ThreadPool pool ( density_thread_amount );
+   
+   for ( unsigned long int i = 0; i < groups.size (); i++ )
+   {
+      const std::vector< unsigned long int >& group = groups[ i ];
+      
+      if ( group.size () == 1 || pool.getThreadAmount () == 1 )
+      {
+         for ( unsigned long int j = 0; j < group.size (); j++ )
+         {
+            computeGrid ( context , hierarchy.getSymbol ( group[ j ] ) , context.grids[ group[ j ] ] , pool );
+         }
+         
+         continue;
+      }
+      
+      // Every block of symbols uses its own pool with a single thread, since a task can't wait for the tasks of its pool.
+      pool.parallelFor ( group.size () , [ & ] ( unsigned long int begin , unsigned long int end )
+      {
+         OpenCIF::ThreadPool single_pool ( 1 );
+         
+         for ( unsigned long int j = begin; j < end; j++ )
+         {
+            computeGrid ( context , hierarchy.getSymbol ( group[ j ] ) , context.grids[ group[ j ] ] , single_pool );
+         }
+      } );
+   }
+   
+   DensityGrid top;
+   
+   computeGrid ( context , hierarchy.getTop () , top , pool );
+   
+   // The windows start at the cell of the lower left corner of the region.
+   OpenCIF::Rectangle region = density_region;
+   
+   if ( region.isEmpty () && top.columns > 0 )
+   {
+      region = cellRectangle ( context , top.first_column , top.first_row );
+      region.add ( cellRectangle ( context , top.first_column + top.columns - 1 , top.first_row + top.rows - 1 ) );
+   }
+   
+   long int window = density_window_size;
+   long int step = density_step;
+   long int columns = 0;
+   long int rows = 0;
+   OpenCIF::Point origin;
+   
+   if ( !region.isEmpty () )
+   {
+      origin = OpenCIF::Point ( floorDivide ( region.getLeft () , context.cell ) * context.cell ,
+                                floorDivide ( region.getBottom () , context.cell ) * context.cell );
+      
+      long int width = region.getRight () - origin.getX ();
+      long int height = region.getTop () - origin.getY ();
+      
+      columns = ( width <= window ) ? 1 : 1 + ( width - window + step - 1 ) / step;
+      rows = ( height <= window ) ? 1 : 1 + ( height - window + step - 1 ) / step;
+   }
+   
+   long int window_cells = window / context.cell;
+   long int step_cells = step / context.cell;
+   long int first_column = origin.getX () / context.cell - top.first_column;
+   long int first_row = origin.getY () / context.cell - top.first_row;
+   double window_area = (double)( window ) * (double)( window );
+   std::vector< double > sums ( ( top.columns + 1 ) * ( top.rows + 1 ) );
+   
+   for ( unsigned long int slot = 0; slot < context.layers.size (); slot++ )
+   {
+      OpenCIF::DensityMap map ( context.layers[ slot ] , origin , window , step , columns , rows );
+      
+      // Sums of the cells below and to the left of every corner, to add the cells of a window in constant time.
+      if ( top.columns > 0 )
+      {
+         for ( long int row = 0; row < top.rows; row++ )
+         {
+            for ( long int column = 0; column < top.columns; column++ )
+            {
+               sums[ ( row + 1 ) * ( top.columns + 1 ) + column + 1 ] = top.areas[ slot ][ row * top.columns + column ] +
+                                                                        sums[ row * ( top.columns + 1 ) + column + 1 ] +
+                                                                        sums[ ( row + 1 ) * ( top.columns + 1 ) + column ] -
+                                                                        sums[ row * ( top.columns + 1 ) + column ];
+            }
+         }
+      }
+      
+      for ( long int row = 0; row < rows; row++ )
+      {
+         for ( long int column = 0; column < columns; column++ )
+         {
+            long int left = std::max ( 0L , std::min ( top.columns , first_column + column * step_cells ) );
+            long int right = std::max ( 0L , std::min ( top.columns , first_column + column * step_cells + window_cells ) );
+            long int bottom = std::max ( 0L , std::min ( top.rows , first_row + row * step_cells ) );
+            long int upper = std::max ( 0L , std::min ( top.rows , first_row + row * step_cells + window_cells ) );
+            double area = sums[ upper * ( top.columns + 1 ) + right ] - sums[ bottom * ( top.columns + 1 ) + right ] -
+                          sums[ upper * ( top.columns + 1 ) + left ] + sums[ bottom * ( top.columns + 1 ) + left ];
+            
+            map.setValue ( column , row , area / window_area );
+         }
+      }
+      
+      maps.push_back ( map );
+   }
+   
+   return ( maps );
+}
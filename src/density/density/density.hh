@@ -0,0 +1,92 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_DENSITY_HH_
+# define LIBOPENCIF_DENSITY_HH_
+
+# include <vector>
+
+# include "../densitymap/densitymap.hh"
+# include "../../command/command.hh"
+# include "../../geometry/rectangle/rectangle.hh"
+# include "../../geometry/expander/expander.hh"
+# include "../../hierarchy/hierarchy/hierarchy.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class computes the density of the layers of a design, inside square
+    * windows placed every "step" units (a density map per layer).
+    *
+    * The plane is cut into square cells, with the greatest common divisor of
+    * the size of the windows and the step as side, and the area covered
+    * inside every cell is computed once per symbol (in the coordinates of its
+    * definition). When a symbol is placed using a transformation that maps
+    * cells into cells (rotations by multiples of 90 degrees, mirrorings, no
+    * scale, and displacements multiple of the cell), the cells of the symbol
+    * are added to the cells of the caller, without visiting its contents
+    * again. Any other placement is flattened, and computed exactly.
+    *
+    * The shapes of a symbol are merged before measuring them, so shapes that
+    * overlap inside a symbol are counted once. The cells where more than one
+    * source has area (the merged shapes of the symbol, and every placement
+    * added by cells) could count an overlap twice, so those cells are
+    * computed again exactly, merging the shapes flattened around them. Cells
+    * that abut only pay for this along their shared border.
+    *
+    * The symbols with the same depth in the hierarchy are computed in
+    * parallel.
+    */
+   class Density
+   {
+      public:
+         explicit Density ( void );
+         virtual ~Density ( void );
+         
+         void setWindowSize ( const unsigned long int& new_window_size );
+         void setStep ( const unsigned long int& new_step );
+         void setRegion ( const OpenCIF::Rectangle& new_region );
+         void setLayers ( const std::vector< unsigned long int >& new_layers );
+         void setExpander ( const OpenCIF::Expander& new_expander );
+         void setThreadAmount ( const unsigned long int& new_thread_amount );
+         unsigned long int getWindowSize ( void ) const;
+         unsigned long int getStep ( void ) const;
+         const OpenCIF::Rectangle& getRegion ( void ) const;
+         const std::vector< unsigned long int >& getLayers ( void ) const;
+         const OpenCIF::Expander& getExpander ( void ) const;
+         unsigned long int getThreadAmount ( void ) const;
+         
+         std::vector< OpenCIF::DensityMap > compute ( const std::vector< OpenCIF::Command* >& commands ) const;
+         std::vector< OpenCIF::DensityMap > compute ( const std::vector< OpenCIF::Command* >& commands , const OpenCIF::Hierarchy& hierarchy ) const;
+      
+      private:
+         unsigned long int density_window_size;
+         unsigned long int density_step;
+         OpenCIF::Rectangle density_region;
+         std::vector< unsigned long int > density_layers;
+         OpenCIF::Expander density_expander;
+         unsigned long int density_thread_amount;
+   };
+}
+
+# endif
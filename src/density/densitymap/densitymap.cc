@@ -0,0 +1,132 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <algorithm>
+
+# include "densitymap.hh"
+# include "../../layertable/layertable.hh"
+
+/*
+ * Default constructor. An empty map, without windows.
+ */
+OpenCIF::DensityMap::DensityMap ( void )
+   : map_layer_id ( OpenCIF::LayerTable::NoLayer ) , map_window_size ( 0 ) , map_step ( 0 ) , map_columns ( 0 ) , map_rows ( 0 )
+{
+}
+
+/*
+ * Non-default constructor. Every window starts with density 0.
+ */
+OpenCIF::DensityMap::DensityMap ( const unsigned long int& new_layer_id , const OpenCIF::Point& new_origin , const unsigned long int& new_window_size ,
+                                  const unsigned long int& new_step , const unsigned long int& new_columns , const unsigned long int& new_rows )
+   : map_layer_id ( new_layer_id ) , map_origin ( new_origin ) , map_window_size ( new_window_size ) , map_step ( new_step ) ,
+     map_columns ( new_columns ) , map_rows ( new_rows ) , map_values ( new_columns * new_rows , 0 )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::DensityMap::~DensityMap ( void )
+{
+}
+
+unsigned long int OpenCIF::DensityMap::getLayerID ( void ) const
+{
+   return ( map_layer_id );
+}
+
+const OpenCIF::Point& OpenCIF::DensityMap::getOrigin ( void ) const
+{
+   return ( map_origin );
+}
+
+unsigned long int OpenCIF::DensityMap::getWindowSize ( void ) const
+{
+   return ( map_window_size );
+}
+
+unsigned long int OpenCIF::DensityMap::getStep ( void ) const
+{
+   return ( map_step );
+}
+
+unsigned long int OpenCIF::DensityMap::getColumns ( void ) const
+{
+   return ( map_columns );
+}
+
+unsigned long int OpenCIF::DensityMap::getRows ( void ) const
+{
+   return ( map_rows );
+}
+
+void OpenCIF::DensityMap::setValue ( const unsigned long int& column , const unsigned long int& row , const double& value )
+{
+   map_values[ row * map_columns + column ] = value;
+   
+   return;
+}
+
+double OpenCIF::DensityMap::getValue ( const unsigned long int& column , const unsigned long int& row ) const
+{
+   return ( map_values[ row * map_columns + column ] );
+}
+
+/*
+ * Member function to return the densities, row by row, starting with the
+ * lowest row.
+ */
+const std::vector< double >& OpenCIF::DensityMap::getValues ( void ) const
+{
+   return ( map_values );
+}
+
+double OpenCIF::DensityMap::getMinimum ( void ) const
+{
+   return ( map_values.empty () ? 0 : *std::min_element ( map_values.begin () , map_values.end () ) );
+}
+
+double OpenCIF::DensityMap::getMaximum ( void ) const
+{
+   return ( map_values.empty () ? 0 : *std::max_element ( map_values.begin () , map_values.end () ) );
+}
+
+/*
+ * Operator to print the matrix, a row per line, starting with the highest
+ * row (so it looks like the layout).
+ */
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::DensityMap& map )
+{
+   for ( unsigned long int row = map.map_rows; row > 0; row-- )
+   {
+      for ( unsigned long int column = 0; column < map.map_columns; column++ )
+      {
+         output_stream << ( ( column > 0 ) ? " " : "" ) << map.getValue ( column , row - 1 );
+      }
+      
+      output_stream << std::endl;
+   }
+   
+   return ( output_stream );
+}
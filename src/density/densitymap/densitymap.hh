@@ -0,0 +1,81 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_DENSITYMAP_HH_
+# define LIBOPENCIF_DENSITYMAP_HH_
+
+# include <iostream>
+# include <vector>
+
+# include "../../command/point/point.hh"
+
+namespace OpenCIF { class DensityMap; }
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::DensityMap& map );
+
+namespace OpenCIF
+{
+   /*
+    * This class keeps the density of a layer (the fraction of the area
+    * covered, from 0 to 1) inside a matrix of square windows. The window at
+    * column i and row j has its lower left corner at:
+    *
+    *    ( origin x + i * step , origin y + j * step )
+    *
+    * The windows overlap if the step is smaller than the size of the window.
+    * The row 0 is the lowest one.
+    */
+   class DensityMap
+   {
+      public:
+         explicit DensityMap ( void );
+         explicit DensityMap ( const unsigned long int& new_layer_id , const OpenCIF::Point& new_origin , const unsigned long int& new_window_size ,
+                               const unsigned long int& new_step , const unsigned long int& new_columns , const unsigned long int& new_rows );
+         virtual ~DensityMap ( void );
+         
+         unsigned long int getLayerID ( void ) const;
+         const OpenCIF::Point& getOrigin ( void ) const;
+         unsigned long int getWindowSize ( void ) const;
+         unsigned long int getStep ( void ) const;
+         unsigned long int getColumns ( void ) const;
+         unsigned long int getRows ( void ) const;
+         
+         void setValue ( const unsigned long int& column , const unsigned long int& row , const double& value );
+         double getValue ( const unsigned long int& column , const unsigned long int& row ) const;
+         const std::vector< double >& getValues ( void ) const;
+         double getMinimum ( void ) const;
+         double getMaximum ( void ) const;
+         
+         friend std::ostream& (::operator<<) ( std::ostream& output_stream , const DensityMap& map );
+      
+      private:
+         unsigned long int map_layer_id;
+         OpenCIF::Point map_origin;
+         unsigned long int map_window_size;
+         unsigned long int map_step;
+         unsigned long int map_columns;
+         unsigned long int map_rows;
+         std::vector< double > map_values;
+   };
+}
+
+# endif
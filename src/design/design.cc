@@ -0,0 +1,308 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "design.hh"
+# include "../threadpool/threadpool.hh"
+
+/*
+ * Non-default constructor. The design takes the ownership of the commands,
+ * builds the hierarchy, and computes the bounding boxes and the spatial
+ * indexes of every symbol. The primitives are expanded (to get their
+ * bounding boxes) and the indexes are built in parallel.
+ */
+OpenCIF::Design::Design ( std::vector< std::unique_ptr< OpenCIF::Command > >&& new_commands , const OpenCIF::LayerTable& new_layers ,
+                          const std::vector< std::string >& new_messages , const OpenCIF::Expander& new_expander ,
+                          const unsigned long int& thread_amount )
+   : design_layers ( new_layers ) ,
+     design_messages ( new_messages ) ,
+     design_expander ( new_expander )
+{
+   design_commands.reserve ( new_commands.size () );
+   
+   for ( unsigned long int i = 0; i < new_commands.size (); i++ )
+   {
+      design_commands.push_back ( new_commands[ i ].release () );
+   }
+   
+   new_commands.clear ();
+   design_hierarchy.build ( design_commands );
+   
+   unsigned long int symbol_amount = design_hierarchy.getSymbolAmount ();
+   std::vector< std::vector< OpenCIF::Rectangle > > items ( symbol_amount + 1 );
+   OpenCIF::ThreadPool pool ( thread_amount );
+   
+   design_bounds.assign ( symbol_amount + 1 , OpenCIF::Rectangle () );
+   design_indexes.resize ( symbol_amount + 1 );
+   
+   // The bounding boxes of the primitives of every symbol.
+   pool.parallelFor ( symbol_amount + 1 , [ & ] ( unsigned long int begin , unsigned long int end )
+   {
+      std::vector< OpenCIF::Shape > shapes;
+      
+      for ( unsigned long int i = begin; i < end; i++ )
+      {
+         const OpenCIF::Symbol& symbol = ( i < symbol_amount ) ? design_hierarchy.getSymbol ( i ) : design_hierarchy.getTop ();
+         const std::vector< unsigned long int >& primitives = symbol.getPrimitives ();
+         
+         items[ i ].reserve ( primitives.size () + symbol.getInstances ().size () );
+         
+         for ( unsigned long int j = 0; j < primitives.size (); j++ )
+         {
+            OpenCIF::Rectangle bounds;
+            
+            shapes.clear ();
+            design_expander.expand ( design_commands[ primitives[ j ] ] , shapes );
+            
+            for ( unsigned long int k = 0; k < shapes.size (); k++ )
+            {
+               bounds.add ( shapes[ k ].getBounds () );
+            }
+            
+            items[ i ].push_back ( bounds );
+            design_bounds[ i ].add ( bounds );
+         }
+      }
+   } );
+   
+   // The bounding boxes of the instances, from the symbols that call no
+   // other symbol to the top.
+   std::vector< unsigned long int > order = design_hierarchy.getOrder ();
+   
+   order.push_back ( symbol_amount );
+   
+   for ( unsigned long int i = 0; i < order.size (); i++ )
+   {
+      const OpenCIF::Symbol& symbol = ( order[ i ] < symbol_amount ) ? design_hierarchy.getSymbol ( order[ i ] ) : design_hierarchy.getTop ();
+      const std::vector< OpenCIF::Instance >& instances = symbol.getInstances ();
+      const std::vector< OpenCIF::InstanceArray >& arrays = symbol.getArrays ();
+      unsigned long int next_array = 0;
+      
+      for ( unsigned long int j = 0; j < instances.size (); j++ )
+      {
+         const OpenCIF::Rectangle& called = design_bounds[ instances[ j ].getSymbol () ];
+         OpenCIF::Rectangle bounds;
+         
+         if ( !called.isEmpty () )
+         {
+            bounds = instances[ j ].getTransform ().apply ( called );
+         }
+         
+         // An array is a single item, its first instance, with the bounding box of every element.
+         if ( next_array < arrays.size () && arrays[ next_array ].getFirst () == j )
+         {
+            bounds = arrays[ next_array ].getBounds ( bounds );
+            items[ order[ i ] ].push_back ( bounds );
+            items[ order[ i ] ].resize ( items[ order[ i ] ].size () + arrays[ next_array ].getSize () - 1 , OpenCIF::Rectangle () );
+            j += arrays[ next_array ].getSize () - 1;
+            next_array++;
+         }
+         else
+         {
+            items[ order[ i ] ].push_back ( bounds );
+         }
+         
+         design_bounds[ order[ i ] ].add ( bounds );
+      }
+   }
+   
+   pool.parallelFor ( symbol_amount + 1 , [ & ] ( unsigned long int begin , unsigned long int end )
+   {
+      for ( unsigned long int i = begin; i < end; i++ )
+      {
+         design_indexes[ i ].build ( items[ i ] );
+      }
+   } );
+}
+
+/*
+ * Destructor. Delete the commands.
+ */
+OpenCIF::Design::~Design ( void )
+{
+   for ( unsigned long int i = 0; i < design_commands.size (); i++ )
+   {
+      delete design_commands[ i ];
+   }
+}
+
+/*
+ * Member function to return the commands of the design. They must not be
+ * changed.
+ */
+const std::vector< OpenCIF::Command* >& OpenCIF::Design::getCommands ( void ) const
+{
+   return ( design_commands );
+}
+
+/*
+ * Member function to return the table of layers. The IDs stored in the
+ * commands refer to this table.
+ */
+const OpenCIF::LayerTable& OpenCIF::Design::getLayers ( void ) const
+{
+   return ( design_layers );
+}
+
+/*
+ * Member function to return the messages generated when the file was loaded.
+ */
+const std::vector< std::string >& OpenCIF::Design::getMessages ( void ) const
+{
+   return ( design_messages );
+}
+
+/*
+ * Member function to return the expander used to get the bounding boxes.
+ */
+const OpenCIF::Expander& OpenCIF::Design::getExpander ( void ) const
+{
+   return ( design_expander );
+}
+
+/*
+ * Member function to return the hierarchy of the symbols of the design.
+ */
+const OpenCIF::Hierarchy& OpenCIF::Design::getHierarchy ( void ) const
+{
+   return ( design_hierarchy );
+}
+
+/*
+ * Member function to find the symbol defined with an ID, after the last
+ * command. Returns Hierarchy::NoSymbol if it is not defined.
+ */
+unsigned long int OpenCIF::Design::findID ( const unsigned long int& id ) const
+{
+   return ( design_hierarchy.findID ( id ) );
+}
+
+/*
+ * Member function to find the last symbol defined with a name. Returns
+ * Hierarchy::NoSymbol if there is none.
+ */
+unsigned long int OpenCIF::Design::findName ( const std::string& name ) const
+{
+   return ( design_hierarchy.findName ( name ) );
+}
+
+/*
+ * Member function to return the bounding box of everything a symbol draws
+ * (in the coordinates of the symbol, including its scale).
+ */
+const OpenCIF::Rectangle& OpenCIF::Design::getBounds ( const unsigned long int& symbol ) const
+{
+   return ( design_bounds[ symbol ] );
+}
+
+/*
+ * Member function to return the bounding box of everything the design draws.
+ */
+const OpenCIF::Rectangle& OpenCIF::Design::getTopBounds ( void ) const
+{
+   return ( design_bounds.back () );
+}
+
+/*
+ * Member function to return the spatial index of a symbol.
+ */
+const OpenCIF::SpatialIndex& OpenCIF::Design::getIndex ( const unsigned long int& symbol ) const
+{
+   return ( design_indexes[ symbol ] );
+}
+
+/*
+ * Member function to return the spatial index of the commands outside the
+ * definitions.
+ */
+const OpenCIF::SpatialIndex& OpenCIF::Design::getTopIndex ( void ) const
+{
+   return ( design_indexes.back () );
+}
+
+/*
+ * Member function to append the primitives (indexes of commands) and the
+ * instances (indexes in Symbol::getInstances) of a symbol whose bounding
+ * boxes intersect a window, given in the coordinates of the symbol.
+ */
+void OpenCIF::Design::query ( const unsigned long int& symbol , const OpenCIF::Rectangle& window ,
+                              std::vector< unsigned long int >& primitives , std::vector< unsigned long int >& instances ) const
+{
+   split ( design_hierarchy.getSymbol ( symbol ) , design_indexes[ symbol ] , window , primitives , instances );
+   
+   return;
+}
+
+/*
+ * Member function to append the primitives and the instances outside the
+ * definitions whose bounding boxes intersect a window.
+ */
+void OpenCIF::Design::queryTop ( const OpenCIF::Rectangle& window ,
+                                 std::vector< unsigned long int >& primitives , std::vector< unsigned long int >& instances ) const
+{
+   split ( design_hierarchy.getTop () , design_indexes.back () , window , primitives , instances );
+   
+   return;
+}
+
+/*
+ * Member function to query an index, and to split the items found into
+ * primitives and instances.
+ */
+void OpenCIF::Design::split ( const OpenCIF::Symbol& symbol , const OpenCIF::SpatialIndex& index , const OpenCIF::Rectangle& window ,
+                              std::vector< unsigned long int >& primitives , std::vector< unsigned long int >& instances ) const
+{
+   const std::vector< unsigned long int >& symbol_primitives = symbol.getPrimitives ();
+   std::vector< unsigned long int > items;
+   
+   index.query ( window , items );
+   
+   for ( unsigned long int i = 0; i < items.size (); i++ )
+   {
+      if ( items[ i ] < symbol_primitives.size () )
+      {
+         primitives.push_back ( symbol_primitives[ items[ i ] ] );
+         
+         continue;
+      }
+      
+      unsigned long int instance = items[ i ] - symbol_primitives.size ();
+      unsigned long int array = symbol.findArray ( instance );
+      
+      if ( array == OpenCIF::Symbol::NoArray )
+      {
+         instances.push_back ( instance );
+      }
+      else
+      {
+         const OpenCIF::Instance& first = symbol.getInstances ()[ instance ];
+         const OpenCIF::Rectangle& called = design_bounds[ first.getSymbol () ];
+         
+         if ( !called.isEmpty () )
+         {
+            symbol.getArrays ()[ array ].query ( first.getTransform ().apply ( called ) , window , instances );
+         }
+      }
+   }
+   
+   return;
+}
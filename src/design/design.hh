@@ -0,0 +1,106 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_DESIGN_HH_
+# define LIBOPENCIF_DESIGN_HH_
+
+# include <memory>
+# include <string>
+# include <vector>
+
+# include "../command/command.hh"
+# include "../layertable/layertable.hh"
+# include "../hierarchy/hierarchy/hierarchy.hh"
+# include "../geometry/expander/expander.hh"
+# include "../geometry/rectangle/rectangle.hh"
+# include "../geometry/spatialindex/spatialindex.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class is a loaded design that doesn't change: the commands of a
+    * file, its table of layers and messages, the hierarchy of its symbols,
+    * and a spatial index of every symbol. Everything is computed when the
+    * instance is created, and every member function is constant and only
+    * reads, so any amount of threads can query the same instance at the same
+    * time without locks. A File gives a design using File::createDesign.
+    *
+    * The commands are owned (and deleted) by the design. They are given as
+    * a vector of pointers to be used with the other classes of the library,
+    * but they must not be changed.
+    *
+    * The spatial index of a symbol (or of the top, the commands outside the
+    * definitions) has an item for every primitive, with the bounding box of
+    * its shapes, and an item for every instance, with the bounding box of
+    * the symbol called, placed. The items are numbered with the primitives
+    * first and the instances after, in the order given by the Symbol class;
+    * the query member functions split them. The instances of an array (see
+    * InstanceArray) are a single item, the first one, with the bounding box
+    * of the whole array (the others are empty), and the query finds the
+    * elements inside the window arithmetically.
+    */
+   class Design
+   {
+      public:
+         explicit Design ( std::vector< std::unique_ptr< OpenCIF::Command > >&& new_commands , const OpenCIF::LayerTable& new_layers ,
+                           const std::vector< std::string >& new_messages , const OpenCIF::Expander& new_expander ,
+                           const unsigned long int& thread_amount = 0 );
+         virtual ~Design ( void );
+         
+         Design ( const Design& design ) = delete;
+         Design& operator= ( const Design& design ) = delete;
+         
+         const std::vector< OpenCIF::Command* >& getCommands ( void ) const;
+         const OpenCIF::LayerTable& getLayers ( void ) const;
+         const std::vector< std::string >& getMessages ( void ) const;
+         const OpenCIF::Expander& getExpander ( void ) const;
+         const OpenCIF::Hierarchy& getHierarchy ( void ) const;
+         
+         unsigned long int findID ( const unsigned long int& id ) const;
+         unsigned long int findName ( const std::string& name ) const;
+         
+         const OpenCIF::Rectangle& getBounds ( const unsigned long int& symbol ) const;
+         const OpenCIF::Rectangle& getTopBounds ( void ) const;
+         const OpenCIF::SpatialIndex& getIndex ( const unsigned long int& symbol ) const;
+         const OpenCIF::SpatialIndex& getTopIndex ( void ) const;
+         void query ( const unsigned long int& symbol , const OpenCIF::Rectangle& window ,
+                      std::vector< unsigned long int >& primitives , std::vector< unsigned long int >& instances ) const;
+         void queryTop ( const OpenCIF::Rectangle& window ,
+                         std::vector< unsigned long int >& primitives , std::vector< unsigned long int >& instances ) const;
+      
+      private:
+         void split ( const OpenCIF::Symbol& symbol , const OpenCIF::SpatialIndex& index , const OpenCIF::Rectangle& window ,
+                      std::vector< unsigned long int >& primitives , std::vector< unsigned long int >& instances ) const;
+      
+      private:
+         std::vector< OpenCIF::Command* > design_commands;
+         OpenCIF::LayerTable design_layers;
+         std::vector< std::string > design_messages;
+         OpenCIF::Expander design_expander;
+         OpenCIF::Hierarchy design_hierarchy;
+         std::vector< OpenCIF::Rectangle > design_bounds; // Every symbol, and the top as the last one.
+         std::vector< OpenCIF::SpatialIndex > design_indexes; // Every symbol, and the top as the last one.
+   };
+}
+
+# endif
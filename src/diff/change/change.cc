@@ -0,0 +1,110 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "change.hh"
+# include "../../hierarchy/symbol/symbol.hh"
+# include "../../hierarchy/hierarchy/hierarchy.hh"
+
+/*
+ * Default constructor. A symbol added, without symbols nor commands.
+ */
+OpenCIF::Change::Change ( void )
+   : change_type ( AddedSymbol ) ,
+     change_left_symbol ( OpenCIF::Hierarchy::NoSymbol ) ,
+     change_right_symbol ( OpenCIF::Hierarchy::NoSymbol ) ,
+     change_left_command ( OpenCIF::Symbol::NoCommand ) ,
+     change_right_command ( OpenCIF::Symbol::NoCommand )
+{
+}
+
+OpenCIF::Change::Change ( const ChangeType& new_type , const unsigned long int& new_left_symbol , const unsigned long int& new_right_symbol ,
+                          const unsigned long int& new_left_command , const unsigned long int& new_right_command )
+   : change_type ( new_type ) ,
+     change_left_symbol ( new_left_symbol ) ,
+     change_right_symbol ( new_right_symbol ) ,
+     change_left_command ( new_left_command ) ,
+     change_right_command ( new_right_command )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Change::~Change ( void )
+{
+}
+
+OpenCIF::Change::ChangeType OpenCIF::Change::getType ( void ) const
+{
+   return ( change_type );
+}
+
+unsigned long int OpenCIF::Change::getLeftSymbol ( void ) const
+{
+   return ( change_left_symbol );
+}
+
+unsigned long int OpenCIF::Change::getRightSymbol ( void ) const
+{
+   return ( change_right_symbol );
+}
+
+unsigned long int OpenCIF::Change::getLeftCommand ( void ) const
+{
+   return ( change_left_command );
+}
+
+unsigned long int OpenCIF::Change::getRightCommand ( void ) const
+{
+   return ( change_right_command );
+}
+
+/*
+ * Operator to write the type of the change, and then the symbol and the
+ * command of both designs ("-" for none).
+ */
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Change& change )
+{
+   static const char* names[] = { "AddedSymbol" , "RemovedSymbol" , "ChangedScale" , "AddedShape" , "RemovedShape" ,
+                                  "MovedShape" , "AddedCall" , "RemovedCall" , "ChangedCall" };
+   const unsigned long int values[] = { change.change_left_symbol , change.change_left_command ,
+                                        change.change_right_symbol , change.change_right_command };
+   
+   output_stream << names[ change.change_type ];
+   
+   for ( unsigned long int i = 0; i < 4; i++ )
+   {
+      output_stream << ( ( i % 2 == 0 ) ? " " : ":" );
+      
+      if ( values[ i ] == OpenCIF::Hierarchy::NoSymbol || values[ i ] == OpenCIF::Symbol::NoCommand )
+      {
+         output_stream << "-";
+      }
+      else
+      {
+         output_stream << values[ i ];
+      }
+   }
+   
+   return ( output_stream );
+}
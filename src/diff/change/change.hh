@@ -0,0 +1,86 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_CHANGE_HH_
+# define LIBOPENCIF_CHANGE_HH_
+
+# include <iostream>
+
+namespace OpenCIF { class Change; }
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Change& change );
+
+namespace OpenCIF
+{
+   /*
+    * This class represents a difference between two designs (the left one,
+    * usually the old one, and the right one), found by the Differ class: its
+    * type, the symbols where it was found (indexes in the hierarchies of both
+    * designs, Hierarchy::NoSymbol for a symbol that doesn't exist in one of
+    * them, and the amount of symbols for the top), and the commands that
+    * differ (indexes in the lists of commands of both designs, or
+    * Symbol::NoCommand).
+    *
+    * A moved shape has the same layer and form in both designs, but another
+    * position. A changed call calls the same symbol with other
+    * transformations.
+    */
+   class Change
+   {
+      public:
+         enum ChangeType
+         {
+            AddedSymbol = 0 ,
+            RemovedSymbol ,
+            ChangedScale ,
+            AddedShape ,
+            RemovedShape ,
+            MovedShape ,
+            AddedCall ,
+            RemovedCall ,
+            ChangedCall
+         };
+      
+      public:
+         explicit Change ( void );
+         explicit Change ( const ChangeType& new_type , const unsigned long int& new_left_symbol , const unsigned long int& new_right_symbol ,
+                           const unsigned long int& new_left_command , const unsigned long int& new_right_command );
+         virtual ~Change ( void );
+         
+         ChangeType getType ( void ) const;
+         unsigned long int getLeftSymbol ( void ) const;
+         unsigned long int getRightSymbol ( void ) const;
+         unsigned long int getLeftCommand ( void ) const;
+         unsigned long int getRightCommand ( void ) const;
+         
+         friend std::ostream& (::operator<<) ( std::ostream& output_stream , const Change& change );
+      
+      private:
+         ChangeType change_type;
+         unsigned long int change_left_symbol;
+         unsigned long int change_right_symbol;
+         unsigned long int change_left_command;
+         unsigned long int change_right_command;
+   };
+}
+
+# endif
@@ -0,0 +1,580 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <cstdlib>
+# include <cstring>
+# include <functional>
+# include <string>
+# include <unordered_map>
+
+# include "differ.hh"
+# include "../../command/controlcommand/callcommand/callcommand.hh"
+# include "../../command/primitivecommand/pathbasedcommand/wirecommand/wirecommand.hh"
+# include "../../command/primitivecommand/positionbasedcommand/boxcommand/boxcommand.hh"
+# include "../../command/primitivecommand/positionbasedcommand/roundflashcommand/roundflashcommand.hh"
+# include "../../geometry/transform/transform.hh"
+# include "../../threadpool/threadpool.hh"
+
+namespace
+{
+   /*
+    * A design being compared: its commands, layers and hierarchy, the key
+    * used to match every symbol (and the top, as the last one), and the hash
+    * of the contents of every symbol.
+    */
+   struct DifferSide
+   {
+      const std::vector< OpenCIF::Command* >* commands;
+      const OpenCIF::LayerTable* layers;
+      const OpenCIF::Hierarchy* hierarchy;
+      std::vector< std::string > names;
+      std::vector< unsigned long long int > hashes;
+   };
+   
+   /*
+    * Function to add a number to a key, byte by byte.
+    */
+   void add ( std::string& key , const long long int& value )
+   {
+      char bytes[ sizeof ( value ) ];
+      
+      std::memcpy ( bytes , &value , sizeof ( value ) );
+      key.append ( bytes , sizeof ( value ) );
+      
+      return;
+   }
+   
+   void add ( std::string& key , const double& value )
+   {
+      char bytes[ sizeof ( value ) ];
+      
+      // Both zeros are the same.
+      double number = ( value == 0 ) ? 0.0 : value;
+      
+      std::memcpy ( bytes , &number , sizeof ( number ) );
+      key.append ( bytes , sizeof ( number ) );
+      
+      return;
+   }
+   
+   /*
+    * Function to add a text to a key, after its length (so the texts
+    * followed by other values can't be confused).
+    */
+   void add ( std::string& key , const std::string& text )
+   {
+      add ( key , (long long int)( text.size () ) );
+      key.append ( text );
+      
+      return;
+   }
+   
+   /*
+    * Function to add the points of a path to a key. Without the position,
+    * the points are relative to the first one.
+    */
+   void add ( std::string& key , const std::vector< OpenCIF::Point >& points , const bool& position )
+   {
+      long long int x = ( position || points.empty () ) ? 0 : points[ 0 ].getX ();
+      long long int y = ( position || points.empty () ) ? 0 : points[ 0 ].getY ();
+      
+      for ( unsigned long int i = 0; i < points.size (); i++ )
+      {
+         add ( key , points[ i ].getX () - x );
+         add ( key , points[ i ].getY () - y );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to mix the bits of a hash (the finalizer of SplitMix64), so the
+    * sum of the hashes of many keys doesn't cancel.
+    */
+   unsigned long long int mix ( unsigned long long int value )
+   {
+      value = ( value ^ ( value >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+      value = ( value ^ ( value >> 27 ) ) * 0x94D049BB133111EBULL;
+      
+      return ( value ^ ( value >> 31 ) );
+   }
+   
+   /*
+    * Function to return a symbol of a hierarchy, or the top for the index
+    * after the last symbol.
+    */
+   const OpenCIF::Symbol& symbolAt ( const OpenCIF::Hierarchy& hierarchy , const unsigned long int& index )
+   {
+      return ( ( index < hierarchy.getSymbolAmount () ) ? hierarchy.getSymbol ( index ) : hierarchy.getTop () );
+   }
+   
+   /*
+    * Function to find the key of a primitive: its type, the name of its layer
+    * and its geometry, with or without its position.
+    */
+   std::string shapeKey ( const DifferSide& side , const OpenCIF::Command* command , const bool& position )
+   {
+      const OpenCIF::PrimitiveCommand* primitive = static_cast< const OpenCIF::PrimitiveCommand* > ( command );
+      std::string key;
+      
+      add ( key , (long long int)( command->type () ) );
+      add ( key , ( primitive->getLayerID () < side.layers->size () ) ? side.layers->getName ( primitive->getLayerID () ) : std::string () );
+      
+      switch ( command->type () )
+      {
+         case OpenCIF::Command::Box:
+         {
+            const OpenCIF::BoxCommand* box = static_cast< const OpenCIF::BoxCommand* > ( command );
+            
+            add ( key , (long long int)( box->getSize ().getWidth () ) );
+            add ( key , (long long int)( box->getSize ().getHeight () ) );
+            add ( key , (long long int)( box->getRotation ().getX () ) );
+            add ( key , (long long int)( box->getRotation ().getY () ) );
+            
+            if ( position )
+            {
+               add ( key , (long long int)( box->getPosition ().getX () ) );
+               add ( key , (long long int)( box->getPosition ().getY () ) );
+            }
+            
+            break;
+         }
+         
+         case OpenCIF::Command::RoundFlash:
+         {
+            const OpenCIF::RoundFlashCommand* flash = static_cast< const OpenCIF::RoundFlashCommand* > ( command );
+            
+            add ( key , (long long int)( flash->getDiameter () ) );
+            
+            if ( position )
+            {
+               add ( key , (long long int)( flash->getPosition ().getX () ) );
+               add ( key , (long long int)( flash->getPosition ().getY () ) );
+            }
+            
+            break;
+         }
+         
+         case OpenCIF::Command::Wire:
+            add ( key , (long long int)( static_cast< const OpenCIF::WireCommand* > ( command )->getWidth () ) );
+            add ( key , static_cast< const OpenCIF::PathBasedCommand* > ( command )->getPoints () , position );
+            break;
+         
+         case OpenCIF::Command::Polygon:
+            add ( key , static_cast< const OpenCIF::PathBasedCommand* > ( command )->getPoints () , position );
+            break;
+         
+         default:
+            break;
+      }
+      
+      return ( key );
+   }
+   
+   /*
+    * Function to find the key of a call: the key of the symbol called and,
+    * if asked, its transformations.
+    */
+   std::string callKey ( const DifferSide& side , const OpenCIF::Instance& instance , const bool& transform )
+   {
+      std::string key;
+      
+      add ( key , side.names[ instance.getSymbol () ] );
+      
+      // The transformations of the call, without the scale of the symbol
+      // called (a change of the scale is found in the symbol).
+      if ( transform )
+      {
+         const OpenCIF::CallCommand* call = static_cast< const OpenCIF::CallCommand* > ( ( *side.commands )[ instance.getCommand () ] );
+         OpenCIF::Transform placement = call->getTransform ();
+         
+         add ( key , placement.getA () );
+         add ( key , placement.getB () );
+         add ( key , placement.getC () );
+         add ( key , placement.getD () );
+         add ( key , placement.getDX () );
+         add ( key , placement.getDY () );
+      }
+      
+      return ( key );
+   }
+   
+   std::string scaleKey ( const OpenCIF::Symbol& symbol )
+   {
+      std::string key;
+      
+      add ( key , symbol.getScale ().getA () );
+      add ( key , symbol.getScale ().getD () );
+      
+      return ( key );
+   }
+   
+   /*
+    * Function to find the keys used to match the symbols of a design, and to
+    * compute the hashes of their contents (in parallel).
+    */
+   void prepare ( DifferSide& side , OpenCIF::ThreadPool& pool )
+   {
+      const OpenCIF::Hierarchy& hierarchy = *side.hierarchy;
+      unsigned long int amount = hierarchy.getSymbolAmount ();
+      
+      side.names.resize ( amount + 1 );
+      side.hashes.assign ( amount + 1 , 0 );
+      
+      for ( unsigned long int i = 0; i < amount; i++ )
+      {
+         const OpenCIF::Symbol& symbol = hierarchy.getSymbol ( i );
+         
+         side.names[ i ] = symbol.getName ().empty () ? ( "I" + std::to_string ( symbol.getID () ) ) : ( "N" + symbol.getName () );
+      }
+      
+      side.names[ amount ] = "T";
+      
+      pool.parallelFor ( amount + 1 , [ & ] ( unsigned long int begin , unsigned long int end )
+      {
+         std::hash< std::string > hash;
+         
+         for ( unsigned long int i = begin; i < end; i++ )
+         {
+            const OpenCIF::Symbol& symbol = symbolAt ( hierarchy , i );
+            const std::vector< unsigned long int >& primitives = symbol.getPrimitives ();
+            const std::vector< OpenCIF::Instance >& instances = symbol.getInstances ();
+            unsigned long long int value = mix ( hash ( scaleKey ( symbol ) ) ^ 0x5CA1EULL );
+            
+            for ( unsigned long int j = 0; j < primitives.size (); j++ )
+            {
+               value += mix ( hash ( shapeKey ( side , ( *side.commands )[ primitives[ j ] ] , true ) ) );
+            }
+            
+            for ( unsigned long int j = 0; j < instances.size (); j++ )
+            {
+               value += mix ( hash ( callKey ( side , instances[ j ] , true ) ) ^ 0xCA11ULL );
+            }
+            
+            side.hashes[ i ] = value;
+         }
+      } );
+      
+      return;
+   }
+   
+   /*
+    * Function to compare two multisets of items (primitives or calls), given
+    * by their exact keys, their loose keys (without the position or the
+    * transformation) and their commands. An item without an exact match is
+    * paired with an item of the other side with the same loose key (a
+    * changed item), or else it was added or removed.
+    */
+   void match ( const std::vector< std::string >& left_exact , const std::vector< std::string >& left_loose ,
+                const std::vector< unsigned long int >& left_commands ,
+                const std::vector< std::string >& right_exact , const std::vector< std::string >& right_loose ,
+                const std::vector< unsigned long int >& right_commands ,
+                const OpenCIF::Change::ChangeType& added , const OpenCIF::Change::ChangeType& removed , const OpenCIF::Change::ChangeType& changed ,
+                const unsigned long int& left_symbol , const unsigned long int& right_symbol , std::vector< OpenCIF::Change >& changes )
+   {
+      std::unordered_map< std::string , std::vector< unsigned long int > > exact;
+      std::unordered_map< std::string , std::vector< unsigned long int > > loose;
+      std::vector< bool > left_matched ( left_exact.size () , false );
+      std::vector< unsigned long int > right_unmatched;
+      
+      // The items with the same key are taken from the first one.
+      for ( unsigned long int i = left_exact.size (); i-- > 0; )
+      {
+         exact[ left_exact[ i ] ].push_back ( i );
+      }
+      
+      for ( unsigned long int i = 0; i < right_exact.size (); i++ )
+      {
+         std::unordered_map< std::string , std::vector< unsigned long int > >::iterator found = exact.find ( right_exact[ i ] );
+         
+         if ( found != exact.end () && !found->second.empty () )
+         {
+            left_matched[ found->second.back () ] = true;
+            found->second.pop_back ();
+         }
+         else
+         {
+            right_unmatched.push_back ( i );
+         }
+      }
+      
+      for ( unsigned long int i = left_exact.size (); i-- > 0; )
+      {
+         if ( !left_matched[ i ] )
+         {
+            loose[ left_loose[ i ] ].push_back ( i );
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < right_unmatched.size (); i++ )
+      {
+         unsigned long int item = right_unmatched[ i ];
+         std::unordered_map< std::string , std::vector< unsigned long int > >::iterator found = loose.find ( right_loose[ item ] );
+         
+         if ( found != loose.end () && !found->second.empty () )
+         {
+            left_matched[ found->second.back () ] = true;
+            changes.push_back ( OpenCIF::Change ( changed , left_symbol , right_symbol , left_commands[ found->second.back () ] , right_commands[ item ] ) );
+            found->second.pop_back ();
+         }
+         else
+         {
+            changes.push_back ( OpenCIF::Change ( added , left_symbol , right_symbol , OpenCIF::Symbol::NoCommand , right_commands[ item ] ) );
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < left_exact.size (); i++ )
+      {
+         if ( !left_matched[ i ] )
+         {
+            changes.push_back ( OpenCIF::Change ( removed , left_symbol , right_symbol , left_commands[ i ] , OpenCIF::Symbol::NoCommand ) );
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to compare the contents of two matched symbols.
+    */
+   void compareSymbols ( const DifferSide& left , const unsigned long int& left_index , const DifferSide& right , const unsigned long int& right_index ,
+                         std::vector< OpenCIF::Change >& changes )
+   {
+      const DifferSide* sides[] = { &left , &right };
+      const unsigned long int indexes[] = { left_index , right_index };
+      std::vector< std::string > exact[ 2 ];
+      std::vector< std::string > loose[ 2 ];
+      std::vector< unsigned long int > commands[ 2 ];
+      
+      if ( scaleKey ( symbolAt ( *left.hierarchy , left_index ) ) != scaleKey ( symbolAt ( *right.hierarchy , right_index ) ) )
+      {
+         changes.push_back ( OpenCIF::Change ( OpenCIF::Change::ChangedScale , left_index , right_index ,
+                                               symbolAt ( *left.hierarchy , left_index ).getBegin () ,
+                                               symbolAt ( *right.hierarchy , right_index ).getBegin () ) );
+      }
+      
+      for ( unsigned long int side = 0; side < 2; side++ )
+      {
+         const std::vector< unsigned long int >& primitives = symbolAt ( *sides[ side ]->hierarchy , indexes[ side ] ).getPrimitives ();
+         
+         for ( unsigned long int i = 0; i < primitives.size (); i++ )
+         {
+            const OpenCIF::Command* command = ( *sides[ side ]->commands )[ primitives[ i ] ];
+            
+            exact[ side ].push_back ( shapeKey ( *sides[ side ] , command , true ) );
+            loose[ side ].push_back ( shapeKey ( *sides[ side ] , command , false ) );
+         }
+         
+         commands[ side ] = primitives;
+      }
+      
+      match ( exact[ 0 ] , loose[ 0 ] , commands[ 0 ] , exact[ 1 ] , loose[ 1 ] , commands[ 1 ] ,
+              OpenCIF::Change::AddedShape , OpenCIF::Change::RemovedShape , OpenCIF::Change::MovedShape , left_index , right_index , changes );
+      
+      for ( unsigned long int side = 0; side < 2; side++ )
+      {
+         const std::vector< OpenCIF::Instance >& instances = symbolAt ( *sides[ side ]->hierarchy , indexes[ side ] ).getInstances ();
+         
+         exact[ side ].clear ();
+         loose[ side ].clear ();
+         commands[ side ].clear ();
+         
+         for ( unsigned long int i = 0; i < instances.size (); i++ )
+         {
+            exact[ side ].push_back ( callKey ( *sides[ side ] , instances[ i ] , true ) );
+            loose[ side ].push_back ( callKey ( *sides[ side ] , instances[ i ] , false ) );
+            commands[ side ].push_back ( instances[ i ].getCommand () );
+         }
+      }
+      
+      match ( exact[ 0 ] , loose[ 0 ] , commands[ 0 ] , exact[ 1 ] , loose[ 1 ] , commands[ 1 ] ,
+              OpenCIF::Change::AddedCall , OpenCIF::Change::RemovedCall , OpenCIF::Change::ChangedCall , left_index , right_index , changes );
+      
+      return;
+   }
+}
+
+/*
+ * Default constructor. One thread per core.
+ */
+OpenCIF::Differ::Differ ( void )
+   : differ_thread_amount ( 0 ) ,
+     differ_compared_symbols ( 0 ) ,
+     differ_skipped_symbols ( 0 )
+{
+}
+
+OpenCIF::Differ::~Differ ( void )
+{
+}
+
+/*
+ * Member function to set the amount of threads used to compute the hashes
+ * (0 means one per core).
+ */
+void OpenCIF::Differ::setThreadAmount ( const unsigned long int& new_thread_amount )
+{
+   differ_thread_amount = new_thread_amount;
+   
+   return;
+}
+
+unsigned long int OpenCIF::Differ::getThreadAmount ( void ) const
+{
+   return ( differ_thread_amount );
+}
+
+/*
+ * Member function to compare two loaded files. Returns the amount of
+ * changes found.
+ */
+unsigned long int OpenCIF::Differ::compare ( const OpenCIF::File& left , const OpenCIF::File& right )
+{
+   return ( compare ( left.getCommands () , left.getLayers () , right.getCommands () , right.getLayers () ) );
+}
+
+/*
+ * Member function to compare two lists of commands, with the tables of
+ * layers their IDs refer to. Returns the amount of changes found.
+ */
+unsigned long int OpenCIF::Differ::compare ( const std::vector< OpenCIF::Command* >& left_commands , const OpenCIF::LayerTable& left_layers ,
+                                             const std::vector< OpenCIF::Command* >& right_commands , const OpenCIF::LayerTable& right_layers )
+{
+   OpenCIF::ThreadPool pool ( differ_thread_amount );
+   DifferSide left;
+   DifferSide right;
+   
+   differ_changes.clear ();
+   differ_compared_symbols = 0;
+   differ_skipped_symbols = 0;
+   differ_left_hierarchy.build ( left_commands );
+   differ_right_hierarchy.build ( right_commands );
+   
+   left.commands = &left_commands;
+   left.layers = &left_layers;
+   left.hierarchy = &differ_left_hierarchy;
+   right.commands = &right_commands;
+   right.layers = &right_layers;
+   right.hierarchy = &differ_right_hierarchy;
+   
+   prepare ( left , pool );
+   prepare ( right , pool );
+   
+   // When a key is used by more than one symbol (an ID defined again), the
+   // last one is the one matched, like the calls find it.
+   std::unordered_map< std::string , unsigned long int > left_keys;
+   std::unordered_map< std::string , unsigned long int > right_keys;
+   std::vector< bool > right_matched ( right.names.size () , false );
+   
+   for ( unsigned long int i = 0; i < left.names.size (); i++ )
+   {
+      left_keys[ left.names[ i ] ] = i;
+   }
+   
+   for ( unsigned long int i = 0; i < right.names.size (); i++ )
+   {
+      right_keys[ right.names[ i ] ] = i;
+   }
+   
+   for ( unsigned long int i = 0; i < left.names.size (); i++ )
+   {
+      if ( left_keys[ left.names[ i ] ] != i )
+      {
+         continue;
+      }
+      
+      std::unordered_map< std::string , unsigned long int >::const_iterator found = right_keys.find ( left.names[ i ] );
+      
+      if ( found == right_keys.end () )
+      {
+         differ_changes.push_back ( OpenCIF::Change ( OpenCIF::Change::RemovedSymbol , i , OpenCIF::Hierarchy::NoSymbol ,
+                                                      symbolAt ( differ_left_hierarchy , i ).getBegin () , OpenCIF::Symbol::NoCommand ) );
+         continue;
+      }
+      
+      right_matched[ found->second ] = true;
+      
+      if ( left.hashes[ i ] == right.hashes[ found->second ] )
+      {
+         differ_skipped_symbols++;
+         continue;
+      }
+      
+      differ_compared_symbols++;
+      compareSymbols ( left , i , right , found->second , differ_changes );
+   }
+   
+   for ( unsigned long int i = 0; i < right.names.size (); i++ )
+   {
+      if ( !right_matched[ i ] && right_keys[ right.names[ i ] ] == i )
+      {
+         differ_changes.push_back ( OpenCIF::Change ( OpenCIF::Change::AddedSymbol , OpenCIF::Hierarchy::NoSymbol , i ,
+                                                      OpenCIF::Symbol::NoCommand , symbolAt ( differ_right_hierarchy , i ).getBegin () ) );
+      }
+   }
+   
+   return ( differ_changes.size () );
+}
+
+/*
+ * Member function to return the changes found by the last comparison.
+ */
+const std::vector< OpenCIF::Change >& OpenCIF::Differ::getChanges ( void ) const
+{
+   return ( differ_changes );
+}
+
+/*
+ * Member function to return the hierarchy of the left design. The symbols of
+ * the changes are indexes in it.
+ */
+const OpenCIF::Hierarchy& OpenCIF::Differ::getLeftHierarchy ( void ) const
+{
+   return ( differ_left_hierarchy );
+}
+
+/*
+ * Member function to return the hierarchy of the right design.
+ */
+const OpenCIF::Hierarchy& OpenCIF::Differ::getRightHierarchy ( void ) const
+{
+   return ( differ_right_hierarchy );
+}
+
+/*
+ * Member function to return the amount of matched symbols whose contents
+ * were compared, since their hashes were different.
+ */
+unsigned long int OpenCIF::Differ::getComparedSymbols ( void ) const
+{
+   return ( differ_compared_symbols );
+}
+
+/*
+ * Member function to return the amount of matched symbols skipped, since
+ * their hashes were the same.
+ */
+unsigned long int OpenCIF::Differ::getSkippedSymbols ( void ) const
+{
+   return ( differ_skipped_symbols );
+}
@@ -0,0 +1,92 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_DIFFER_HH_
+# define LIBOPENCIF_DIFFER_HH_
+
+# include <vector>
+
+# include "../change/change.hh"
+# include "../../command/command.hh"
+# include "../../file/file.hh"
+# include "../../hierarchy/hierarchy/hierarchy.hh"
+# include "../../layertable/layertable.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class compares two designs (the left one, usually the old one, and
+    * the right one) symbol by symbol, and finds what changed:
+    *
+    * - The symbols are matched by their name (the "9" user extension) or, if
+    *   they have none, by their ID. The top (the commands outside the
+    *   definitions) is matched with the top. A symbol without match was added
+    *   or removed.
+    * - Every symbol gets a hash of its contents, that doesn't depend on the
+    *   order of its commands: its scale, its primitives (by the name of their
+    *   layer, so the layer tables don't need to be the same) and its calls
+    *   (by the name or the ID of the symbol called, so a symbol that changes
+    *   doesn't change the symbols that call it). The hashes are computed in
+    *   parallel. The matched symbols with the same hash are skipped.
+    * - The primitives and the calls of the other symbols are compared as
+    *   multisets: a primitive without an equal one in the other design was
+    *   added or removed, unless there is one with the same layer and form in
+    *   another position, and then it was moved. A call without an equal one
+    *   was added or removed, unless there is one to the same symbol with other
+    *   transformations, and then it was changed.
+    *
+    * Two symbols with the same hash are taken as equal without comparing
+    * them (the hashes have 64 bits). The changes of every symbol are
+    * together, in the order of the symbols of the left design, and then the
+    * symbols added.
+    */
+   class Differ
+   {
+      public:
+         explicit Differ ( void );
+         virtual ~Differ ( void );
+         
+         void setThreadAmount ( const unsigned long int& new_thread_amount );
+         unsigned long int getThreadAmount ( void ) const;
+         
+         unsigned long int compare ( const OpenCIF::File& left , const OpenCIF::File& right );
+         unsigned long int compare ( const std::vector< OpenCIF::Command* >& left_commands , const OpenCIF::LayerTable& left_layers ,
+                                     const std::vector< OpenCIF::Command* >& right_commands , const OpenCIF::LayerTable& right_layers );
+         
+         const std::vector< OpenCIF::Change >& getChanges ( void ) const;
+         const OpenCIF::Hierarchy& getLeftHierarchy ( void ) const;
+         const OpenCIF::Hierarchy& getRightHierarchy ( void ) const;
+         unsigned long int getComparedSymbols ( void ) const;
+         unsigned long int getSkippedSymbols ( void ) const;
+      
+      private:
+         unsigned long int differ_thread_amount;
+         std::vector< OpenCIF::Change > differ_changes;
+         OpenCIF::Hierarchy differ_left_hierarchy;
+         OpenCIF::Hierarchy differ_right_hierarchy;
+         unsigned long int differ_compared_symbols;
+         unsigned long int differ_skipped_symbols;
+   };
+}
+
+# endif
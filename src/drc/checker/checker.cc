@@ -0,0 +1,1125 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <algorithm>
+# include <cmath>
+# include <map>
+# include <mutex>
+# include <set>
+# include <utility>
+
+# include "checker.hh"
+# include "../../geometry/boolean/boolean.hh"
+# include "../../geometry/rectangle/rectangle.hh"
+# include "../../geometry/spatialindex/spatialindex.hh"
+# include "../../geometry/transform/transform.hh"
+# include "../../threadpool/threadpool.hh"
+
+namespace
+{
+   /*
+    * Border of a merged layer. The inside of the layer is on the left of the
+    * segment (going from the first point to the second one).
+    */
+   struct CheckerEdge
+   {
+      OpenCIF::Point first;
+      OpenCIF::Point second;
+      unsigned long int layer_id;
+   };
+   
+   /*
+    * Shapes of a symbol (its own primitives, expanded), the bounding box of
+    * everything it draws, and its markers, in the coordinates of the
+    * definition.
+    */
+   struct CheckerSymbol
+   {
+      std::vector< OpenCIF::Shape > shapes;
+      OpenCIF::Rectangle bounds;
+      std::vector< OpenCIF::Marker > markers;
+   };
+   
+   /*
+    * State of a single check.
+    */
+   struct CheckerContext
+   {
+      const std::vector< OpenCIF::Rule >& rules;
+      const OpenCIF::Expander& expander;
+      std::set< unsigned long int > layers;
+      long int halo;
+      std::vector< CheckerSymbol > symbols;
+      
+      CheckerContext ( const std::vector< OpenCIF::Rule >& new_rules , const OpenCIF::Expander& new_expander )
+         : rules ( new_rules ) , expander ( new_expander ) , halo ( 1 )
+      {
+         for ( unsigned long int i = 0; i < rules.size (); i++ )
+         {
+            layers.insert ( rules[ i ].getLayerID () );
+            
+            if ( rules[ i ].getType () != OpenCIF::Rule::Width )
+            {
+               layers.insert ( rules[ i ].getOtherLayerID () );
+            }
+            
+            halo = std::max ( halo , (long int)( rules[ i ].getValue () ) );
+         }
+      }
+   };
+   
+   OpenCIF::Rectangle grow ( const OpenCIF::Rectangle& rectangle , const long int& amount )
+   {
+      if ( rectangle.isEmpty () )
+      {
+         return ( rectangle );
+      }
+      
+      return ( OpenCIF::Rectangle ( rectangle.getLeft () - amount , rectangle.getBottom () - amount ,
+                                    rectangle.getRight () + amount , rectangle.getTop () + amount ) );
+   }
+   
+   long long int cross ( const OpenCIF::Point& first , const OpenCIF::Point& second , const OpenCIF::Point& point )
+   {
+      return ( (long long int)( second.getX () - first.getX () ) * (long long int)( point.getY () - first.getY () ) -
+               (long long int)( second.getY () - first.getY () ) * (long long int)( point.getX () - first.getX () ) );
+   }
+   
+   long long int dot ( const CheckerEdge& first , const CheckerEdge& second )
+   {
+      return ( (long long int)( first.second.getX () - first.first.getX () ) * (long long int)( second.second.getX () - second.first.getX () ) +
+               (long long int)( first.second.getY () - first.first.getY () ) * (long long int)( second.second.getY () - second.first.getY () ) );
+   }
+   
+   /*
+    * Function to know if a border is on one side of the line of another
+    * border: inside the layer (sign 1) or outside (sign -1). A border on the
+    * same line is not on any side.
+    */
+   bool onSide ( const CheckerEdge& edge , const CheckerEdge& other , const int& sign )
+   {
+      long long int first = sign * cross ( edge.first , edge.second , other.first );
+      long long int second = sign * cross ( edge.first , edge.second , other.second );
+      
+      return ( first >= 0 && second >= 0 && ( first > 0 || second > 0 ) );
+   }
+   
+   /*
+    * Function to return the distance from a point to a segment, and the
+    * nearest point of the segment.
+    */
+   double pointDistance ( const double& x , const double& y , const OpenCIF::Point& first , const OpenCIF::Point& second ,
+                          std::pair< double , double >& nearest )
+   {
+      double dx = second.getX () - first.getX ();
+      double dy = second.getY () - first.getY ();
+      double length = dx * dx + dy * dy;
+      double t = ( length > 0 ) ? ( ( x - first.getX () ) * dx + ( y - first.getY () ) * dy ) / length : 0;
+      
+      t = std::max ( 0.0 , std::min ( 1.0 , t ) );
+      nearest = std::make_pair ( first.getX () + t * dx , first.getY () + t * dy );
+      
+      return ( std::hypot ( x - nearest.first , y - nearest.second ) );
+   }
+   
+   double pointDistance ( const OpenCIF::Point& point , const OpenCIF::Point& first , const OpenCIF::Point& second ,
+                          std::pair< double , double >& nearest )
+   {
+      return ( pointDistance ( point.getX () , point.getY () , first , second , nearest ) );
+   }
+   
+   /*
+    * Function to return the distance between two borders (that don't cross),
+    * and the nearest points of both.
+    */
+   double edgeDistance ( const CheckerEdge& first , const CheckerEdge& second , std::pair< double , double >& first_point ,
+                         std::pair< double , double >& second_point )
+   {
+      std::pair< double , double > nearest;
+      double best = pointDistance ( first.first , second.first , second.second , nearest );
+      
+      first_point = std::make_pair ( (double)( first.first.getX () ) , (double)( first.first.getY () ) );
+      second_point = nearest;
+      
+      double distance = pointDistance ( first.second , second.first , second.second , nearest );
+      
+      if ( distance < best )
+      {
+         best = distance;
+         first_point = std::make_pair ( (double)( first.second.getX () ) , (double)( first.second.getY () ) );
+         second_point = nearest;
+      }
+      
+      distance = pointDistance ( second.first , first.first , first.second , nearest );
+      
+      if ( distance < best )
+      {
+         best = distance;
+         first_point = nearest;
+         second_point = std::make_pair ( (double)( second.first.getX () ) , (double)( second.first.getY () ) );
+      }
+      
+      distance = pointDistance ( second.second , first.first , first.second , nearest );
+      
+      if ( distance < best )
+      {
+         best = distance;
+         first_point = nearest;
+         second_point = std::make_pair ( (double)( second.second.getX () ) , (double)( second.second.getY () ) );
+      }
+      
+      return ( best );
+   }
+   
+   /*
+    * Function to add to a rectangle the part of a border nearer than a value
+    * to another border. The distance to the other border is convex along the
+    * border, so the part is found by bisection on both sides of the nearest
+    * point.
+    */
+   void addNear ( const CheckerEdge& edge , const CheckerEdge& other , const std::pair< double , double >& nearest , const double& value ,
+                  OpenCIF::Rectangle& rectangle )
+   {
+      double dx = edge.second.getX () - edge.first.getX ();
+      double dy = edge.second.getY () - edge.first.getY ();
+      double middle = ( ( nearest.first - edge.first.getX () ) * dx + ( nearest.second - edge.first.getY () ) * dy ) / ( dx * dx + dy * dy );
+      double limits[ 2 ] = { 0 , 1 };
+      std::pair< double , double > unused;
+      
+      middle = std::max ( 0.0 , std::min ( 1.0 , middle ) );
+      
+      for ( int i = 0; i < 2; i++ )
+      {
+         double near = middle;
+         double far = limits[ i ];
+         
+         if ( pointDistance ( edge.first.getX () + far * dx , edge.first.getY () + far * dy , other.first , other.second , unused ) >= value )
+         {
+            for ( int j = 0; j < 32; j++ )
+            {
+               double half = ( near + far ) / 2;
+               
+               if ( pointDistance ( edge.first.getX () + half * dx , edge.first.getY () + half * dy , other.first , other.second , unused ) < value )
+               {
+                  near = half;
+               }
+               else
+               {
+                  far = half;
+               }
+            }
+            
+            limits[ i ] = near;
+         }
+         
+         rectangle.add ( OpenCIF::Point ( std::lround ( edge.first.getX () + limits[ i ] * dx ) , std::lround ( edge.first.getY () + limits[ i ] * dy ) ) );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to return the place of a violation between two borders: the
+    * region between them if they are parallel and horizontal (or vertical),
+    * and the box of the parts of both nearer than the value of the rule
+    * otherwise (it doesn't depend on the order of the borders, so a placed
+    * symbol has the same markers as its flattened shapes).
+    */
+   OpenCIF::Rectangle markerRectangle ( const CheckerEdge& first , const CheckerEdge& second , const std::pair< double , double >& first_point ,
+                                        const std::pair< double , double >& second_point , const double& value )
+   {
+      bool first_horizontal = ( first.first.getY () == first.second.getY () );
+      bool second_horizontal = ( second.first.getY () == second.second.getY () );
+      bool first_vertical = ( first.first.getX () == first.second.getX () );
+      bool second_vertical = ( second.first.getX () == second.second.getX () );
+      
+      if ( first_horizontal && second_horizontal )
+      {
+         long int left = std::max ( std::min ( first.first.getX () , first.second.getX () ) , std::min ( second.first.getX () , second.second.getX () ) );
+         long int right = std::min ( std::max ( first.first.getX () , first.second.getX () ) , std::max ( second.first.getX () , second.second.getX () ) );
+         
+         if ( left <= right )
+         {
+            return ( OpenCIF::Rectangle ( left , std::min ( first.first.getY () , second.first.getY () ) ,
+                                          right , std::max ( first.first.getY () , second.first.getY () ) ) );
+         }
+      }
+      
+      if ( first_vertical && second_vertical )
+      {
+         long int bottom = std::max ( std::min ( first.first.getY () , first.second.getY () ) , std::min ( second.first.getY () , second.second.getY () ) );
+         long int top = std::min ( std::max ( first.first.getY () , first.second.getY () ) , std::max ( second.first.getY () , second.second.getY () ) );
+         
+         if ( bottom <= top )
+         {
+            return ( OpenCIF::Rectangle ( std::min ( first.first.getX () , second.first.getX () ) , bottom ,
+                                          std::max ( first.first.getX () , second.first.getX () ) , top ) );
+         }
+      }
+      
+      // Otherwise, the parts of both borders nearer than the rule to the other one.
+      OpenCIF::Rectangle rectangle;
+      
+      addNear ( first , second , first_point , value , rectangle );
+      addNear ( second , first , second_point , value , rectangle );
+      
+      return ( rectangle );
+   }
+   
+   /*
+    * Function to join the horizontal (or vertical) borders found on the same
+    * line: the borders of two pieces of the merged layer that touch cancel
+    * each other. Every event is a position on the line, and the change of
+    * the amount of borders going forward (positive) or backward (negative).
+    */
+   void joinLine ( const long int& line , std::vector< std::pair< long int , int > >& events , const bool& horizontal ,
+                   const unsigned long int& layer_id , std::vector< CheckerEdge >& edges )
+   {
+      std::sort ( events.begin () , events.end () );
+      
+      int amount = 0;
+      long int begin = 0;
+      int direction = 0;
+      
+      for ( unsigned long int i = 0; i < events.size (); i++ )
+      {
+         amount += events[ i ].second;
+         
+         // Once every event of a position is added, the border can start or end there.
+         if ( i + 1 < events.size () && events[ i + 1 ].first == events[ i ].first )
+         {
+            continue;
+         }
+         
+         int new_direction = ( amount > 0 ) - ( amount < 0 );
+         
+         if ( new_direction == direction )
+         {
+            continue;
+         }
+         
+         if ( direction != 0 && events[ i ].first > begin )
+         {
+            CheckerEdge edge;
+            long int from = ( direction > 0 ) ? begin : events[ i ].first;
+            long int to = ( direction > 0 ) ? events[ i ].first : begin;
+            
+            edge.first = horizontal ? OpenCIF::Point ( from , line ) : OpenCIF::Point ( line , from );
+            edge.second = horizontal ? OpenCIF::Point ( to , line ) : OpenCIF::Point ( line , to );
+            edge.layer_id = layer_id;
+            edges.push_back ( edge );
+         }
+         
+         direction = new_direction;
+         begin = events[ i ].first;
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to find the borders of a merged layer (a list of pieces that
+    * don't overlap).
+    */
+   void findEdges ( const std::vector< OpenCIF::Shape >& pieces , const unsigned long int& layer_id , std::vector< CheckerEdge >& edges )
+   {
+      std::map< long int , std::vector< std::pair< long int , int > > > horizontal;
+      std::map< long int , std::vector< std::pair< long int , int > > > vertical;
+      std::vector< CheckerEdge > diagonal;
+      
+      for ( unsigned long int i = 0; i < pieces.size (); i++ )
+      {
+         const std::vector< OpenCIF::Point >& points = pieces[ i ].getPoints ();
+         long long int area = 0;
+         
+         for ( unsigned long int j = 0; j < points.size (); j++ )
+         {
+            area += cross ( OpenCIF::Point ( 0 , 0 ) , points[ j ] , points[ ( j + 1 ) % points.size () ] );
+         }
+         
+         if ( area == 0 )
+         {
+            continue;
+         }
+         
+         for ( unsigned long int j = 0; j < points.size (); j++ )
+         {
+            // The borders go counterclockwise, so the inside is on the left.
+            OpenCIF::Point first = ( area > 0 ) ? points[ j ] : points[ ( j + 1 ) % points.size () ];
+            OpenCIF::Point second = ( area > 0 ) ? points[ ( j + 1 ) % points.size () ] : points[ j ];
+            
+            if ( first.getX () == second.getX () && first.getY () == second.getY () )
+            {
+               continue;
+            }
+            
+            if ( first.getY () == second.getY () )
+            {
+               int direction = ( second.getX () > first.getX () ) ? 1 : -1;
+               
+               horizontal[ first.getY () ].push_back ( std::make_pair ( std::min ( first.getX () , second.getX () ) , direction ) );
+               horizontal[ first.getY () ].push_back ( std::make_pair ( std::max ( first.getX () , second.getX () ) , -direction ) );
+            }
+            else if ( first.getX () == second.getX () )
+            {
+               int direction = ( second.getY () > first.getY () ) ? 1 : -1;
+               
+               vertical[ first.getX () ].push_back ( std::make_pair ( std::min ( first.getY () , second.getY () ) , direction ) );
+               vertical[ first.getX () ].push_back ( std::make_pair ( std::max ( first.getY () , second.getY () ) , -direction ) );
+            }
+            else
+            {
+               CheckerEdge edge;
+               
+               edge.first = first;
+               edge.second = second;
+               edge.layer_id = layer_id;
+               diagonal.push_back ( edge );
+            }
+         }
+      }
+      
+      // The slanted borders are cut where the pieces are cut, so the parts of the same border are joined again.
+      std::map< std::pair< long int , long int > , std::vector< unsigned long int > > starts;
+      std::vector< unsigned long int > next ( diagonal.size () , diagonal.size () );
+      std::vector< bool > continued ( diagonal.size () , false );
+      
+      for ( unsigned long int i = 0; i < diagonal.size (); i++ )
+      {
+         starts[ std::make_pair ( diagonal[ i ].first.getX () , diagonal[ i ].first.getY () ) ].push_back ( i );
+      }
+      
+      for ( unsigned long int i = 0; i < diagonal.size (); i++ )
+      {
+         std::map< std::pair< long int , long int > , std::vector< unsigned long int > >::const_iterator found =
+            starts.find ( std::make_pair ( diagonal[ i ].second.getX () , diagonal[ i ].second.getY () ) );
+         
+         for ( unsigned long int j = 0; found != starts.end () && j < found->second.size () && next[ i ] == diagonal.size (); j++ )
+         {
+            unsigned long int candidate = found->second[ j ];
+            
+            // The cuts are rounded, so the joint can be up to one unit away from the line.
+            if ( !continued[ candidate ] && dot ( diagonal[ i ] , diagonal[ candidate ] ) > 0 &&
+                 std::abs ( (double)( cross ( diagonal[ i ].first , diagonal[ i ].second , diagonal[ candidate ].second ) ) ) <=
+                 std::hypot ( diagonal[ candidate ].second.getX () - diagonal[ i ].first.getX () , diagonal[ candidate ].second.getY () - diagonal[ i ].first.getY () ) )
+            {
+               next[ i ] = candidate;
+               continued[ candidate ] = true;
+            }
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < diagonal.size (); i++ )
+      {
+         if ( continued[ i ] )
+         {
+            continue;
+         }
+         
+         CheckerEdge edge = diagonal[ i ];
+         
+         for ( unsigned long int j = next[ i ]; j < diagonal.size (); j = next[ j ] )
+         {
+            edge.second = diagonal[ j ].second;
+         }
+         
+         edges.push_back ( edge );
+      }
+      
+      for ( std::map< long int , std::vector< std::pair< long int , int > > >::iterator line = horizontal.begin (); line != horizontal.end (); line++ )
+      {
+         joinLine ( line->first , line->second , true , layer_id , edges );
+      }
+      
+      for ( std::map< long int , std::vector< std::pair< long int , int > > >::iterator line = vertical.begin (); line != vertical.end (); line++ )
+      {
+         joinLine ( line->first , line->second , false , layer_id , edges );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to compare two borders using every rule.
+    */
+   void checkPair ( const CheckerContext& context , const CheckerEdge& first , const CheckerEdge& second , std::vector< OpenCIF::Marker >& markers )
+   {
+      std::pair< double , double > first_point;
+      std::pair< double , double > second_point;
+      double distance = -1;
+      
+      // Two borders of the same layer that meet at a corner have no width (or space) between them.
+      if ( first.layer_id == second.layer_id &&
+           ( ( first.second.getX () == second.first.getX () && first.second.getY () == second.first.getY () ) ||
+             ( second.second.getX () == first.first.getX () && second.second.getY () == first.first.getY () ) ) )
+      {
+         return;
+      }
+      
+      for ( unsigned long int i = 0; i < context.rules.size (); i++ )
+      {
+         const OpenCIF::Rule& rule = context.rules[ i ];
+         const CheckerEdge* inner = &first;
+         const CheckerEdge* outer = &second;
+         bool violated = false;
+         
+         switch ( rule.getType () )
+         {
+            case OpenCIF::Rule::Width:
+               if ( first.layer_id != rule.getLayerID () || second.layer_id != rule.getLayerID () )
+               {
+                  continue;
+               }
+               
+               violated = ( dot ( first , second ) < 0 && onSide ( first , second , 1 ) && onSide ( second , first , 1 ) );
+               break;
+            
+            case OpenCIF::Rule::Spacing:
+               if ( !( first.layer_id == rule.getLayerID () && second.layer_id == rule.getOtherLayerID () ) &&
+                    !( first.layer_id == rule.getOtherLayerID () && second.layer_id == rule.getLayerID () ) )
+               {
+                  continue;
+               }
+               
+               violated = ( dot ( first , second ) < 0 && onSide ( first , second , -1 ) && onSide ( second , first , -1 ) );
+               break;
+            
+            case OpenCIF::Rule::Enclosure:
+               if ( second.layer_id == rule.getLayerID () && first.layer_id == rule.getOtherLayerID () )
+               {
+                  std::swap ( inner , outer );
+               }
+               
+               if ( inner->layer_id != rule.getLayerID () || outer->layer_id != rule.getOtherLayerID () || inner->layer_id == outer->layer_id )
+               {
+                  continue;
+               }
+               
+               violated = ( dot ( *inner , *outer ) > 0 && onSide ( *inner , *outer , -1 ) && onSide ( *outer , *inner , 1 ) );
+               break;
+         }
+         
+         if ( !violated )
+         {
+            continue;
+         }
+         
+         if ( distance < 0 )
+         {
+            distance = edgeDistance ( first , second , first_point , second_point );
+         }
+         
+         if ( distance < rule.getValue () )
+         {
+            markers.push_back ( OpenCIF::Marker ( i , markerRectangle ( first , second , first_point , second_point , rule.getValue () ) , distance ) );
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to know if a rectangle touches a window of an index. Without
+    * index, every place is a window.
+    */
+   bool inWindows ( const OpenCIF::SpatialIndex* windows , const OpenCIF::Rectangle& rectangle )
+   {
+      if ( windows == NULL )
+      {
+         return ( true );
+      }
+      
+      std::vector< unsigned long int > found;
+      
+      windows->query ( rectangle , found );
+      
+      return ( !found.empty () );
+   }
+   
+   /*
+    * Function to add a marker, cut to the windows of an index. Only the parts
+    * inside the windows are sure: the shapes used are the ones near them, so
+    * far from them a border can be missing the shapes that cover it.
+    */
+   void addMarker ( const OpenCIF::SpatialIndex* windows , const OpenCIF::Marker& marker , std::vector< OpenCIF::Marker >& markers )
+   {
+      if ( windows == NULL )
+      {
+         markers.push_back ( marker );
+         
+         return;
+      }
+      
+      std::vector< unsigned long int > found;
+      
+      windows->query ( marker.getRectangle () , found );
+      
+      for ( unsigned long int i = 0; i < found.size (); i++ )
+      {
+         if ( windows->getItemBounds ( found[ i ] ).contains ( marker.getRectangle () ) )
+         {
+            markers.push_back ( marker );
+            
+            return;
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < found.size (); i++ )
+      {
+         markers.push_back ( OpenCIF::Marker ( marker.getRule () , windows->getItemBounds ( found[ i ] ).intersection ( marker.getRectangle () ) ,
+                                               marker.getValue () ) );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to check a set of shapes. Only the parts of the markers inside
+    * the windows are kept.
+    */
+   void checkShapes ( const CheckerContext& context , const std::vector< OpenCIF::Shape >& shapes , const OpenCIF::SpatialIndex* windows ,
+                      OpenCIF::ThreadPool& pool , std::vector< OpenCIF::Marker >& markers )
+   {
+      std::map< unsigned long int , std::vector< OpenCIF::Shape > > layers;
+      
+      for ( unsigned long int i = 0; i < shapes.size (); i++ )
+      {
+         if ( context.layers.count ( shapes[ i ].getLayerID () ) > 0 )
+         {
+            layers[ shapes[ i ].getLayerID () ].push_back ( shapes[ i ] );
+         }
+      }
+      
+      OpenCIF::Boolean boolean;
+      std::vector< OpenCIF::Shape > nothing;
+      std::vector< CheckerEdge > edges;
+      
+      for ( std::map< unsigned long int , std::vector< OpenCIF::Shape > >::const_iterator layer = layers.begin (); layer != layers.end (); layer++ )
+      {
+         findEdges ( boolean.compute ( layer->second , OpenCIF::Boolean::Union , nothing , layer->first , pool ) , layer->first , edges );
+      }
+      
+      // Two borders nearer than the biggest rule have bounding boxes that touch when they grow by half of it.
+      std::vector< OpenCIF::Rectangle > reach ( edges.size () );
+      OpenCIF::SpatialIndex index;
+      std::mutex markers_mutex;
+      
+      for ( unsigned long int i = 0; i < edges.size (); i++ )
+      {
+         OpenCIF::Rectangle bounds;
+         
+         bounds.add ( edges[ i ].first );
+         bounds.add ( edges[ i ].second );
+         reach[ i ] = grow ( bounds , ( context.halo + 1 ) / 2 );
+      }
+      
+      index.build ( reach );
+      
+      pool.parallelFor ( index.getTileAmount () , [ & ] ( unsigned long int first_tile , unsigned long int last_tile )
+      {
+         std::vector< OpenCIF::Marker > found;
+         std::vector< OpenCIF::Marker > kept;
+         std::vector< unsigned long int > items;
+         
+         for ( unsigned long int tile = first_tile; tile < last_tile; tile++ )
+         {
+            items.clear ();
+            index.getTileItems ( tile , items );
+            
+            std::sort ( items.begin () , items.end () , [ & ] ( unsigned long int first , unsigned long int second )
+            {
+               return ( reach[ first ].getLeft () < reach[ second ].getLeft () );
+            } );
+            
+            for ( unsigned long int i = 0; i < items.size (); i++ )
+            {
+               for ( unsigned long int j = i + 1; j < items.size (); j++ )
+               {
+                  const OpenCIF::Rectangle& first = reach[ items[ i ] ];
+                  const OpenCIF::Rectangle& second = reach[ items[ j ] ];
+                  
+                  if ( second.getLeft () > first.getRight () )
+                  {
+                     break;
+                  }
+                  
+                  // The pair is checked only by the tile with the lower left corner of the intersection.
+                  if ( first.intersects ( second ) &&
+                       index.findTile ( OpenCIF::Point ( std::max ( first.getLeft () , second.getLeft () ) ,
+                                                         std::max ( first.getBottom () , second.getBottom () ) ) ) == tile )
+                  {
+                     checkPair ( context , edges[ items[ i ] ] , edges[ items[ j ] ] , found );
+                  }
+               }
+            }
+         }
+         
+         for ( unsigned long int i = 0; i < found.size (); i++ )
+         {
+            addMarker ( windows , found[ i ] , kept );
+         }
+         
+         std::lock_guard< std::mutex > lock ( markers_mutex );
+         
+         markers.insert ( markers.end () , kept.begin () , kept.end () );
+      } );
+      
+      // The parts of a layer outside the enclosing layer.
+      for ( unsigned long int i = 0; i < context.rules.size (); i++ )
+      {
+         const OpenCIF::Rule& rule = context.rules[ i ];
+         
+         if ( rule.getType () != OpenCIF::Rule::Enclosure || rule.getLayerID () == rule.getOtherLayerID () || layers.count ( rule.getLayerID () ) == 0 )
+         {
+            continue;
+         }
+         
+         std::vector< OpenCIF::Shape > outside = boolean.compute ( layers[ rule.getLayerID () ] , OpenCIF::Boolean::Difference ,
+                                                                   layers.count ( rule.getOtherLayerID () ) ? layers[ rule.getOtherLayerID () ] : nothing ,
+                                                                   rule.getLayerID () , pool );
+         
+         for ( unsigned long int j = 0; j < outside.size (); j++ )
+         {
+            addMarker ( windows , OpenCIF::Marker ( i , outside[ j ].getBounds () , 0 ) , markers );
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to add the shapes of a symbol (and of the symbols it calls)
+    * placed using a transformation, if they touch a region of the index.
+    */
+   void collect ( const CheckerContext& context , const OpenCIF::Hierarchy& hierarchy , const unsigned long int& symbol_index ,
+                  const OpenCIF::Transform& transform , const OpenCIF::SpatialIndex& region , std::vector< OpenCIF::Shape >& shapes )
+   {
+      const CheckerSymbol& symbol = context.symbols[ symbol_index ];
+      const std::vector< OpenCIF::Instance >& instances = hierarchy.getSymbol ( symbol_index ).getInstances ();
+      
+      for ( unsigned long int i = 0; i < symbol.shapes.size (); i++ )
+      {
+         if ( inWindows ( &region , transform.apply ( symbol.shapes[ i ].getBounds () ) ) )
+         {
+            shapes.push_back ( transform.apply ( symbol.shapes[ i ] ) );
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < instances.size (); i++ )
+      {
+         OpenCIF::Transform placement = transform * instances[ i ].getTransform ();
+         const CheckerSymbol& called = context.symbols[ instances[ i ].getSymbol () ];
+         
+         if ( !called.bounds.isEmpty () && inWindows ( &region , placement.apply ( called.bounds ) ) )
+         {
+            collect ( context , hierarchy , instances[ i ].getSymbol () , placement , region , shapes );
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to expand the primitives of a symbol, and to compute its
+    * bounding box, once the symbols it calls are prepared.
+    */
+   void prepare ( CheckerContext& context , const std::vector< OpenCIF::Command* >& commands , const OpenCIF::Symbol& symbol , CheckerSymbol& data )
+   {
+      const std::vector< unsigned long int >& primitives = symbol.getPrimitives ();
+      const std::vector< OpenCIF::Instance >& instances = symbol.getInstances ();
+      std::vector< OpenCIF::Shape > expanded;
+      
+      for ( unsigned long int i = 0; i < primitives.size (); i++ )
+      {
+         expanded.clear ();
+         context.expander.expand ( commands[ primitives[ i ] ] , expanded );
+         
+         for ( unsigned long int j = 0; j < expanded.size (); j++ )
+         {
+            if ( context.layers.count ( expanded[ j ].getLayerID () ) > 0 )
+            {
+               data.bounds.add ( expanded[ j ].getBounds () );
+               data.shapes.push_back ( std::move ( expanded[ j ] ) );
+            }
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < instances.size (); i++ )
+      {
+         const CheckerSymbol& called = context.symbols[ instances[ i ].getSymbol () ];
+         
+         if ( !called.bounds.isEmpty () )
+         {
+            data.bounds.add ( instances[ i ].getTransform ().apply ( called.bounds ) );
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to compute the markers of a symbol, once the symbols it calls
+    * are checked.
+    */
+   void checkSymbol ( const CheckerContext& context , const OpenCIF::Hierarchy& hierarchy , const OpenCIF::Symbol& symbol , CheckerSymbol& data ,
+                      OpenCIF::ThreadPool& pool )
+   {
+      const std::vector< OpenCIF::Instance >& instances = symbol.getInstances ();
+      std::vector< OpenCIF::Rectangle > windows;
+      std::vector< OpenCIF::Rectangle > placed;
+      std::vector< unsigned long int > placed_instances;
+      std::vector< bool > reused ( instances.size () , false );
+      
+      // The own shapes can interact with anything near them.
+      for ( unsigned long int i = 0; i < data.shapes.size (); i++ )
+      {
+         windows.push_back ( grow ( data.shapes[ i ].getBounds () , context.halo ) );
+      }
+      
+      for ( unsigned long int i = 0; i < instances.size (); i++ )
+      {
+         const OpenCIF::Transform& transform = instances[ i ].getTransform ();
+         const CheckerSymbol& called = context.symbols[ instances[ i ].getSymbol () ];
+         
+         if ( called.bounds.isEmpty () )
+         {
+            continue;
+         }
+         
+         // The markers of a scaled symbol can't be used: the distances change, so it's checked again.
+         if ( std::fabs ( std::fabs ( transform.getA () * transform.getD () - transform.getB () * transform.getC () ) - 1 ) > 1e-9 )
+         {
+            windows.push_back ( grow ( transform.apply ( called.bounds ) , context.halo ) );
+            continue;
+         }
+         
+         reused[ i ] = true;
+         placed.push_back ( grow ( transform.apply ( called.bounds ) , context.halo ) );
+         placed_instances.push_back ( i );
+      }
+      
+      // Two placements can interact where they are near.
+      OpenCIF::SpatialIndex placed_index;
+      std::vector< unsigned long int > near;
+      
+      placed_index.build ( placed );
+      
+      for ( unsigned long int i = 0; i < placed.size (); i++ )
+      {
+         near.clear ();
+         placed_index.query ( placed[ i ] , near );
+         
+         for ( unsigned long int j = 0; j < near.size (); j++ )
+         {
+            if ( near[ j ] > i )
+            {
+               windows.push_back ( placed[ i ].intersection ( placed[ near[ j ] ] ) );
+            }
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < instances.size (); i++ )
+      {
+         if ( !reused[ i ] )
+         {
+            continue;
+         }
+         
+         const OpenCIF::Transform& transform = instances[ i ].getTransform ();
+         const std::vector< OpenCIF::Marker >& called = context.symbols[ instances[ i ].getSymbol () ].markers;
+         
+         for ( unsigned long int j = 0; j < called.size (); j++ )
+         {
+            data.markers.push_back ( OpenCIF::Marker ( called[ j ].getRule () , transform.apply ( called[ j ].getRectangle () ) , called[ j ].getValue () ) );
+         }
+      }
+      
+      if ( !windows.empty () )
+      {
+         std::vector< OpenCIF::Rectangle > regions ( windows.size () );
+         OpenCIF::SpatialIndex window_index;
+         OpenCIF::SpatialIndex region_index;
+         std::vector< OpenCIF::Shape > shapes ( data.shapes );
+         std::vector< OpenCIF::Marker > found;
+         
+         for ( unsigned long int i = 0; i < windows.size (); i++ )
+         {
+            regions[ i ] = grow ( windows[ i ] , context.halo );
+         }
+         
+         window_index.build ( windows );
+         region_index.build ( regions );
+         
+         for ( unsigned long int i = 0; i < instances.size (); i++ )
+         {
+            const CheckerSymbol& called = context.symbols[ instances[ i ].getSymbol () ];
+            
+            if ( !called.bounds.isEmpty () && inWindows ( &region_index , instances[ i ].getTransform ().apply ( called.bounds ) ) )
+            {
+               collect ( context , hierarchy , instances[ i ].getSymbol () , instances[ i ].getTransform () , region_index , shapes );
+            }
+         }
+         
+         checkShapes ( context , shapes , &window_index , pool , found );
+         
+         // The parts of the markers of the placed symbols, found again in a window, aren't added twice.
+         std::vector< OpenCIF::Rectangle > inherited ( data.markers.size () );
+         OpenCIF::SpatialIndex inherited_index;
+         std::vector< unsigned long int > near_markers;
+         
+         for ( unsigned long int i = 0; i < data.markers.size (); i++ )
+         {
+            inherited[ i ] = data.markers[ i ].getRectangle ();
+         }
+         
+         inherited_index.build ( inherited );
+         
+         for ( unsigned long int i = 0; i < found.size (); i++ )
+         {
+            bool repeated = false;
+            
+            near_markers.clear ();
+            inherited_index.query ( found[ i ].getRectangle () , near_markers );
+            
+            for ( unsigned long int j = 0; j < near_markers.size () && !repeated; j++ )
+            {
+               repeated = ( data.markers[ near_markers[ j ] ].getRule () == found[ i ].getRule () && inherited[ near_markers[ j ] ].contains ( found[ i ].getRectangle () ) );
+            }
+            
+            if ( !repeated )
+            {
+               data.markers.push_back ( found[ i ] );
+            }
+         }
+      }
+      
+      std::sort ( data.markers.begin () , data.markers.end () );
+      data.markers.erase ( std::unique ( data.markers.begin () , data.markers.end () ) , data.markers.end () );
+      
+      return;
+   }
+   
+   /*
+    * Function to check again the places of the markers of the top of the
+    * hierarchy, with the shapes of every level around them, so the shapes of
+    * a caller can remove the violations of the symbols it calls. The markers
+    * found replace the old ones.
+    */
+   void recheckFlat ( const CheckerContext& context , const OpenCIF::Hierarchy& hierarchy , CheckerSymbol& top , OpenCIF::ThreadPool& pool )
+   {
+      const std::vector< OpenCIF::Instance >& instances = hierarchy.getTop ().getInstances ();
+      std::vector< OpenCIF::Rectangle > windows ( top.markers.size () );
+      std::vector< OpenCIF::Rectangle > regions ( top.markers.size () );
+      OpenCIF::SpatialIndex window_index;
+      OpenCIF::SpatialIndex region_index;
+      std::vector< OpenCIF::Shape > shapes;
+      std::vector< OpenCIF::Marker > found;
+      
+      // The windows grow, so a marker found again isn't cut where the old one ended.
+      for ( unsigned long int i = 0; i < top.markers.size (); i++ )
+      {
+         windows[ i ] = grow ( top.markers[ i ].getRectangle () , context.halo );
+         regions[ i ] = grow ( windows[ i ] , context.halo );
+      }
+      
+      window_index.build ( windows );
+      region_index.build ( regions );
+      
+      for ( unsigned long int i = 0; i < top.shapes.size (); i++ )
+      {
+         if ( inWindows ( &region_index , top.shapes[ i ].getBounds () ) )
+         {
+            shapes.push_back ( top.shapes[ i ] );
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < instances.size (); i++ )
+      {
+         const CheckerSymbol& called = context.symbols[ instances[ i ].getSymbol () ];
+         
+         if ( !called.bounds.isEmpty () && inWindows ( &region_index , instances[ i ].getTransform ().apply ( called.bounds ) ) )
+         {
+            collect ( context , hierarchy , instances[ i ].getSymbol () , instances[ i ].getTransform () , region_index , shapes );
+         }
+      }
+      
+      checkShapes ( context , shapes , &window_index , pool , found );
+      
+      std::sort ( found.begin () , found.end () );
+      found.erase ( std::unique ( found.begin () , found.end () ) , found.end () );
+      top.markers.swap ( found );
+      
+      return;
+   }
+}
+
+/*
+ * Default constructor. No rules, the default expander, the amount of threads
+ * chosen using the hardware, and the markers of the hierarchy not checked
+ * again.
+ */
+OpenCIF::Checker::Checker ( void )
+   : checker_thread_amount ( 0 ) , checker_recheck_flat ( false )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Checker::~Checker ( void )
+{
+}
+
+/*
+ * Member function to add a rule. Returns the index of the rule, used by the
+ * markers.
+ */
+unsigned long int OpenCIF::Checker::addRule ( const OpenCIF::Rule& rule )
+{
+   checker_rules.push_back ( rule );
+   
+   return ( checker_rules.size () - 1 );
+}
+
+void OpenCIF::Checker::clearRules ( void )
+{
+   checker_rules.clear ();
+   
+   return;
+}
+
+void OpenCIF::Checker::setExpander ( const OpenCIF::Expander& new_expander )
+{
+   checker_expander = new_expander;
+   
+   return;
+}
+
+/*
+ * Member function to set the amount of threads used. With 0, the amount of
+ * threads is chosen using the hardware.
+ */
+void OpenCIF::Checker::setThreadAmount ( const unsigned long int& new_thread_amount )
+{
+   checker_thread_amount = new_thread_amount;
+   
+   return;
+}
+
+/*
+ * Member function to set if the markers found using the hierarchy are checked
+ * again with the flat shapes around them (removing the ones that the shapes
+ * of a caller fix).
+ */
+void OpenCIF::Checker::setRecheckFlat ( const bool& new_recheck_flat )
+{
+   checker_recheck_flat = new_recheck_flat;
+   
+   return;
+}
+
+const std::vector< OpenCIF::Rule >& OpenCIF::Checker::getRules ( void ) const
+{
+   return ( checker_rules );
+}
+
+const OpenCIF::Expander& OpenCIF::Checker::getExpander ( void ) const
+{
+   return ( checker_expander );
+}
+
+unsigned long int OpenCIF::Checker::getThreadAmount ( void ) const
+{
+   return ( checker_thread_amount );
+}
+
+bool OpenCIF::Checker::getRecheckFlat ( void ) const
+{
+   return ( checker_recheck_flat );
+}
+
+/*
+ * Member function to check a list of commands.
+ */
+std::vector< OpenCIF::Marker > OpenCIF::Checker::check ( const std::vector< OpenCIF::Command* >& commands ) const
+{
+   return ( check ( commands , OpenCIF::Hierarchy ( commands ) ) );
+}
+
+/*
+ * Member function to check a list of commands, using a hierarchy already
+ * built for them. The markers are sorted by rule and place.
+ */
+std::vector< OpenCIF::Marker > OpenCIF::Checker::check ( const std::vector< OpenCIF::Command* >& commands ,
+                                                         const OpenCIF::Hierarchy& hierarchy ) const
+{
+   CheckerContext context ( checker_rules , checker_expander );
+   std::vector< unsigned long int > order = hierarchy.getOrder ();
+   OpenCIF::ThreadPool pool ( checker_thread_amount );
+   CheckerSymbol top;
+   
+   if ( checker_rules.empty () )
+   {
+      return ( std::vector< OpenCIF::Marker > () );
+   }
+   
+   context.symbols.resize ( hierarchy.getSymbolAmount () );
+   
+   for ( unsigned long int i = 0; i < order.size (); i++ )
+   {
+      prepare ( context , commands , hierarchy.getSymbol ( order[ i ] ) , context.symbols[ order[ i ] ] );
+      checkSymbol ( context , hierarchy , hierarchy.getSymbol ( order[ i ] ) , context.symbols[ order[ i ] ] , pool );
+   }
+   
+   prepare ( context , commands , hierarchy.getTop () , top );
+   checkSymbol ( context , hierarchy , hierarchy.getTop () , top , pool );
+   
+   if ( checker_recheck_flat && !top.markers.empty () )
+   {
+      recheckFlat ( context , hierarchy , top , pool );
+   }
+   
+   return ( top.markers );
+}
+
+/*
+ * Member function to check a list of shapes, without hierarchy.
+ */
+std::vector< OpenCIF::Marker > OpenCIF::Checker::check ( const std::vector< OpenCIF::Shape >& shapes ) const
+{
+   CheckerContext context ( checker_rules , checker_expander );
+   OpenCIF::ThreadPool pool ( checker_thread_amount );
+   std::vector< OpenCIF::Marker > markers;
+   
+   if ( checker_rules.empty () )
+   {
+      return ( markers );
+   }
+   
+   checkShapes ( context , shapes , NULL , pool , markers );
+   
+   std::sort ( markers.begin () , markers.end () );
+   markers.erase ( std::unique ( markers.begin () , markers.end () ) , markers.end () );
+   
+   return ( markers );
+}
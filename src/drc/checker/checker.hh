@@ -0,0 +1,91 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_CHECKER_HH_
+# define LIBOPENCIF_CHECKER_HH_
+
+# include <vector>
+
+# include "../rule/rule.hh"
+# include "../marker/marker.hh"
+# include "../../command/command.hh"
+# include "../../geometry/shape/shape.hh"
+# include "../../geometry/expander/expander.hh"
+# include "../../hierarchy/hierarchy/hierarchy.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class checks the design rules (width, spacing and enclosure) of a
+    * design, and returns a marker for every violation found.
+    *
+    * The shapes of every layer are merged, and the borders of the result are
+    * compared in pairs: the pairs of borders near enough are found using a
+    * spatial index, whose tiles are swept in parallel. The distance between
+    * two borders is the euclidean distance between the segments, so corners
+    * are checked too. Two borders are compared only if they face each other:
+    * inside the shape for the width, outside the shapes for the spacing, and
+    * in the same direction for the enclosure. The parts of a layer that are
+    * not covered by the enclosing layer are reported as well.
+    *
+    * The hierarchy is used to check every symbol once: the markers of a
+    * symbol are computed in the coordinates of its definition and placed
+    * with every call. At every level, only the places where the shapes of
+    * the level itself, or two placements, are near enough to interact are
+    * checked again, and the markers found there are cut to those places. The
+    * shapes of the caller can't remove the violations of a symbol (for
+    * example, covering a shape that is too narrow), so a marker can be
+    * reported that a flat check doesn't report. With setRecheckFlat, the
+    * places of the markers found are checked again with the shapes of the
+    * whole design (only around them), and the markers found then are
+    * returned instead.
+    */
+   class Checker
+   {
+      public:
+         explicit Checker ( void );
+         virtual ~Checker ( void );
+         
+         unsigned long int addRule ( const OpenCIF::Rule& rule );
+         void clearRules ( void );
+         void setExpander ( const OpenCIF::Expander& new_expander );
+         void setThreadAmount ( const unsigned long int& new_thread_amount );
+         void setRecheckFlat ( const bool& new_recheck_flat );
+         const std::vector< OpenCIF::Rule >& getRules ( void ) const;
+         const OpenCIF::Expander& getExpander ( void ) const;
+         unsigned long int getThreadAmount ( void ) const;
+         bool getRecheckFlat ( void ) const;
+         
+         std::vector< OpenCIF::Marker > check ( const std::vector< OpenCIF::Command* >& commands ) const;
+         std::vector< OpenCIF::Marker > check ( const std::vector< OpenCIF::Command* >& commands , const OpenCIF::Hierarchy& hierarchy ) const;
+         std::vector< OpenCIF::Marker > check ( const std::vector< OpenCIF::Shape >& shapes ) const;
+      
+      private:
+         std::vector< OpenCIF::Rule > checker_rules;
+         OpenCIF::Expander checker_expander;
+         unsigned long int checker_thread_amount;
+         bool checker_recheck_flat;
+   };
+}
+
+# endif
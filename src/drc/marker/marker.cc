@@ -0,0 +1,99 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "marker.hh"
+
+/*
+ * Default constructor. A marker of the rule 0, without place.
+ */
+OpenCIF::Marker::Marker ( void )
+   : marker_rule ( 0 ) , marker_value ( 0 )
+{
+}
+
+OpenCIF::Marker::Marker ( const unsigned long int& new_rule , const OpenCIF::Rectangle& new_rectangle , const double& new_value )
+   : marker_rule ( new_rule ) , marker_rectangle ( new_rectangle ) , marker_value ( new_value )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Marker::~Marker ( void )
+{
+}
+
+unsigned long int OpenCIF::Marker::getRule ( void ) const
+{
+   return ( marker_rule );
+}
+
+const OpenCIF::Rectangle& OpenCIF::Marker::getRectangle ( void ) const
+{
+   return ( marker_rectangle );
+}
+
+double OpenCIF::Marker::getValue ( void ) const
+{
+   return ( marker_value );
+}
+
+/*
+ * Operator to sort the markers by rule, and then by place.
+ */
+bool OpenCIF::Marker::operator< ( const OpenCIF::Marker& marker ) const
+{
+   if ( marker_rule != marker.marker_rule )
+   {
+      return ( marker_rule < marker.marker_rule );
+   }
+   
+   if ( marker_rectangle.getLeft () != marker.marker_rectangle.getLeft () )
+   {
+      return ( marker_rectangle.getLeft () < marker.marker_rectangle.getLeft () );
+   }
+   
+   if ( marker_rectangle.getBottom () != marker.marker_rectangle.getBottom () )
+   {
+      return ( marker_rectangle.getBottom () < marker.marker_rectangle.getBottom () );
+   }
+   
+   if ( marker_rectangle.getRight () != marker.marker_rectangle.getRight () )
+   {
+      return ( marker_rectangle.getRight () < marker.marker_rectangle.getRight () );
+   }
+   
+   return ( marker_rectangle.getTop () < marker.marker_rectangle.getTop () );
+}
+
+bool OpenCIF::Marker::operator== ( const OpenCIF::Marker& marker ) const
+{
+   return ( marker_rule == marker.marker_rule && marker_rectangle == marker.marker_rectangle );
+}
+
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Marker& marker )
+{
+   output_stream << marker.marker_rule << " " << marker.marker_rectangle << " " << marker.marker_value;
+   
+   return ( output_stream );
+}
@@ -0,0 +1,67 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_MARKER_HH_
+# define LIBOPENCIF_MARKER_HH_
+
+# include <iostream>
+
+# include "../../geometry/rectangle/rectangle.hh"
+
+namespace OpenCIF { class Marker; }
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Marker& marker );
+
+namespace OpenCIF
+{
+   /*
+    * This class represents a violation of a design rule: the index of the
+    * rule (in the order the rules were added to the checker), the place of
+    * the violation (in the coordinates of the file), and the distance
+    * measured. For the parts of a layer that aren't enclosed at all by the
+    * other layer, the distance is 0 and the rectangle is the bounding box of
+    * the part.
+    */
+   class Marker
+   {
+      public:
+         explicit Marker ( void );
+         explicit Marker ( const unsigned long int& new_rule , const OpenCIF::Rectangle& new_rectangle , const double& new_value );
+         virtual ~Marker ( void );
+         
+         unsigned long int getRule ( void ) const;
+         const OpenCIF::Rectangle& getRectangle ( void ) const;
+         double getValue ( void ) const;
+         
+         bool operator< ( const OpenCIF::Marker& marker ) const;
+         bool operator== ( const OpenCIF::Marker& marker ) const;
+         
+         friend std::ostream& (::operator<<) ( std::ostream& output_stream , const Marker& marker );
+      
+      private:
+         unsigned long int marker_rule;
+         OpenCIF::Rectangle marker_rectangle;
+         double marker_value;
+   };
+}
+
+# endif
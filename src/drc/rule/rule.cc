@@ -0,0 +1,90 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "rule.hh"
+# include "../../layertable/layertable.hh"
+
+/*
+ * Default constructor. A width rule of 0 without layer (never violated).
+ */
+OpenCIF::Rule::Rule ( void )
+   : rule_type ( Width ) , rule_layer_id ( OpenCIF::LayerTable::NoLayer ) , rule_other_layer_id ( OpenCIF::LayerTable::NoLayer ) , rule_value ( 0 )
+{
+}
+
+/*
+ * Non-default constructor. For the width rules, the other layer is
+ * ignored.
+ */
+OpenCIF::Rule::Rule ( const Type& new_type , const unsigned long int& new_layer_id , const unsigned long int& new_other_layer_id ,
+                      const unsigned long int& new_value )
+   : rule_type ( new_type ) , rule_layer_id ( new_layer_id ) , rule_other_layer_id ( new_other_layer_id ) , rule_value ( new_value )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Rule::~Rule ( void )
+{
+}
+
+OpenCIF::Rule::Type OpenCIF::Rule::getType ( void ) const
+{
+   return ( rule_type );
+}
+
+unsigned long int OpenCIF::Rule::getLayerID ( void ) const
+{
+   return ( rule_layer_id );
+}
+
+unsigned long int OpenCIF::Rule::getOtherLayerID ( void ) const
+{
+   return ( rule_other_layer_id );
+}
+
+unsigned long int OpenCIF::Rule::getValue ( void ) const
+{
+   return ( rule_value );
+}
+
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Rule& rule )
+{
+   switch ( rule.rule_type )
+   {
+      case OpenCIF::Rule::Width:
+         output_stream << "width " << rule.rule_layer_id << " " << rule.rule_value;
+         break;
+      
+      case OpenCIF::Rule::Spacing:
+         output_stream << "spacing " << rule.rule_layer_id << " " << rule.rule_other_layer_id << " " << rule.rule_value;
+         break;
+      
+      case OpenCIF::Rule::Enclosure:
+         output_stream << "enclosure " << rule.rule_layer_id << " " << rule.rule_other_layer_id << " " << rule.rule_value;
+         break;
+   }
+   
+   return ( output_stream );
+}
@@ -0,0 +1,76 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_RULE_HH_
+# define LIBOPENCIF_RULE_HH_
+
+# include <iostream>
+
+namespace OpenCIF { class Rule; }
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Rule& rule );
+
+namespace OpenCIF
+{
+   /*
+    * This class represents a design rule:
+    *
+    * - Width: the shapes of the layer must be at least "value" wide.
+    * - Spacing: the shapes of the layer must be at least "value" away from
+    *   the shapes of the other layer (it can be the same layer).
+    * - Enclosure: the shapes of the layer must be inside the shapes of the
+    *   other layer, with a margin of at least "value".
+    *
+    * The layers are given using the IDs of the layer table of the file.
+    */
+   class Rule
+   {
+      public:
+         enum Type
+         {
+            Width = 0 ,
+            Spacing ,
+            Enclosure
+         };
+      
+      public:
+         explicit Rule ( void );
+         explicit Rule ( const Type& new_type , const unsigned long int& new_layer_id , const unsigned long int& new_other_layer_id ,
+                         const unsigned long int& new_value );
+         virtual ~Rule ( void );
+         
+         Type getType ( void ) const;
+         unsigned long int getLayerID ( void ) const;
+         unsigned long int getOtherLayerID ( void ) const;
+         unsigned long int getValue ( void ) const;
+         
+         friend std::ostream& (::operator<<) ( std::ostream& output_stream , const Rule& rule );
+      
+      private:
+         Type rule_type;
+         unsigned long int rule_layer_id;
+         unsigned long int rule_other_layer_id;
+         unsigned long int rule_value;
+   };
+}
+
+# endif
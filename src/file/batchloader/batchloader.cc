@@ -0,0 +1,274 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "batchloader.hh"
+
+# include <algorithm>
+# include <atomic>
+
+/*
+ * Default constructor. Stop on errors, one thread per core, and keep the
+ * raw commands.
+ */
+OpenCIF::BatchLoader::BatchLoader ( void )
+   : loader_load_method ( OpenCIF::File::StopOnError ) ,
+     loader_thread_amount ( 0 ) ,
+     loader_retention_policy ( OpenCIF::File::CloseInput )
+{
+}
+
+/*
+ * Destructor. The files are deleted by the unique pointers.
+ */
+OpenCIF::BatchLoader::~BatchLoader ( void )
+{
+}
+
+/*
+ * Member function to set the method used to load every file.
+ */
+void OpenCIF::BatchLoader::setLoadMethod ( const OpenCIF::File::LoadMethod& new_load_method )
+{
+   loader_load_method = new_load_method;
+   
+   return;
+}
+
+/*
+ * Member function to set the amount of threads used by load (0 means one per
+ * core).
+ */
+void OpenCIF::BatchLoader::setThreadAmount ( const unsigned long int& new_thread_amount )
+{
+   loader_thread_amount = new_thread_amount;
+   
+   return;
+}
+
+/*
+ * Member function to set the retention policy of every file loaded.
+ */
+void OpenCIF::BatchLoader::setRetentionPolicy ( const OpenCIF::File::RetentionPolicy& new_retention_policy )
+{
+   loader_retention_policy = new_retention_policy;
+   
+   return;
+}
+
+OpenCIF::File::LoadMethod OpenCIF::BatchLoader::getLoadMethod ( void ) const
+{
+   return ( loader_load_method );
+}
+
+unsigned long int OpenCIF::BatchLoader::getThreadAmount ( void ) const
+{
+   return ( loader_thread_amount );
+}
+
+OpenCIF::File::RetentionPolicy OpenCIF::BatchLoader::getRetentionPolicy ( void ) const
+{
+   return ( loader_retention_policy );
+}
+
+/*
+ * Member function to add a file to the list of files to load.
+ */
+void OpenCIF::BatchLoader::addPath ( const std::string& path )
+{
+   loader_paths.push_back ( path );
+   
+   return;
+}
+
+/*
+ * Member function to set the list of files to load.
+ */
+void OpenCIF::BatchLoader::setPaths ( const std::vector< std::string >& new_paths )
+{
+   loader_paths = new_paths;
+   
+   return;
+}
+
+const std::vector< std::string >& OpenCIF::BatchLoader::getPaths ( void ) const
+{
+   return ( loader_paths );
+}
+
+/*
+ * Member function to forget the paths and the files loaded.
+ */
+void OpenCIF::BatchLoader::clear ( void )
+{
+   loader_paths.clear ();
+   loader_files.clear ();
+   loader_statuses.clear ();
+   loader_messages.clear ();
+   loader_layers.clear ();
+   loader_layer_maps.clear ();
+   
+   return;
+}
+
+/*
+ * Member function to load every file of the list, using a pool with the
+ * amount of threads set. Returns the amount of files loaded without errors.
+ */
+unsigned long int OpenCIF::BatchLoader::load ( void )
+{
+   OpenCIF::ThreadPool pool ( loader_thread_amount );
+   
+   return ( load ( pool ) );
+}
+
+/*
+ * Member function to load every file of the list, using the threads of a
+ * pool. Returns the amount of files loaded without errors. The files loaded
+ * before are replaced. Only the tasks of the loader are waited for, so other
+ * threads can use the pool at the same time (but not its own tasks).
+ */
+unsigned long int OpenCIF::BatchLoader::load ( OpenCIF::ThreadPool& pool )
+{
+   std::atomic< unsigned long int > next ( 0 );
+   unsigned long int loaded = 0;
+   
+   loader_files.clear ();
+   loader_files.resize ( loader_paths.size () );
+   loader_statuses.assign ( loader_paths.size () , OpenCIF::File::AllOk );
+   loader_messages.assign ( loader_paths.size () , std::vector< std::string > () );
+   loader_layers.clear ();
+   loader_layer_maps.assign ( loader_paths.size () , std::vector< unsigned long int > () );
+   
+   // A task per thread. Every task takes the next file until there is none
+   // left, so the threads stay busy even if the sizes of the files differ.
+   // Only these tasks are waited for, since the pool can be shared.
+   unsigned long int tasks = std::min ( pool.getThreadAmount () , (unsigned long int)( loader_paths.size () ) );
+   OpenCIF::ThreadPool::Latch latch ( tasks );
+   
+   for ( unsigned long int i = 0; i < tasks; i++ )
+   {
+      pool.submit ( [ this , &next ] ()
+      {
+         for ( unsigned long int index = next++; index < loader_paths.size (); index = next++ )
+         {
+            std::unique_ptr< OpenCIF::File > file ( new OpenCIF::File () );
+            
+            file->setPath ( loader_paths[ index ] );
+            file->setRetentionPolicy ( loader_retention_policy );
+            loader_statuses[ index ] = file->loadFile ( loader_load_method );
+            file->closeFile ();
+            loader_messages[ index ] = file->getMessages ();
+            loader_files[ index ] = std::move ( file );
+         }
+      } , latch );
+   }
+   
+   latch.wait ();
+   
+   // The layers are interned in the order of the paths, so the shared IDs
+   // don't depend on the order the threads finished.
+   for ( unsigned long int i = 0; i < loader_files.size (); i++ )
+   {
+      const OpenCIF::LayerTable& layers = loader_files[ i ]->getLayers ();
+      
+      loader_layer_maps[ i ].reserve ( layers.size () );
+      
+      for ( unsigned long int j = 0; j < layers.size (); j++ )
+      {
+         loader_layer_maps[ i ].push_back ( loader_layers.intern ( layers.getName ( j ) ) );
+      }
+      
+      if ( loader_statuses[ i ] == OpenCIF::File::AllOk )
+      {
+         loaded++;
+      }
+   }
+   
+   return ( loaded );
+}
+
+/*
+ * Member function to return the amount of files of the last load.
+ */
+unsigned long int OpenCIF::BatchLoader::getFileAmount ( void ) const
+{
+   return ( loader_files.size () );
+}
+
+/*
+ * Member function to return the result of the load of a file.
+ */
+OpenCIF::File::LoadStatus OpenCIF::BatchLoader::getStatus ( const unsigned long int& index ) const
+{
+   return ( loader_statuses[ index ] );
+}
+
+/*
+ * Member function to return the messages generated during the load of a file.
+ */
+const std::vector< std::string >& OpenCIF::BatchLoader::getMessages ( const unsigned long int& index ) const
+{
+   return ( loader_messages[ index ] );
+}
+
+/*
+ * Member function to return a file loaded. It must not have been released.
+ */
+OpenCIF::File& OpenCIF::BatchLoader::getFile ( const unsigned long int& index )
+{
+   return ( *loader_files[ index ] );
+}
+
+/*
+ * Member function to return a file loaded. It must not have been released.
+ */
+const OpenCIF::File& OpenCIF::BatchLoader::getFile ( const unsigned long int& index ) const
+{
+   return ( *loader_files[ index ] );
+}
+
+/*
+ * Member function to give the ownership of a file to the caller. The status,
+ * the messages and the map of layers of the file are kept.
+ */
+std::unique_ptr< OpenCIF::File > OpenCIF::BatchLoader::releaseFile ( const unsigned long int& index )
+{
+   return ( std::move ( loader_files[ index ] ) );
+}
+
+/*
+ * Member function to return the table with the layers of every file.
+ */
+const OpenCIF::LayerTable& OpenCIF::BatchLoader::getLayers ( void ) const
+{
+   return ( loader_layers );
+}
+
+/*
+ * Member function to return the map from the layer IDs of a file (the
+ * indexes of the vector) to the IDs of the shared table of layers.
+ */
+const std::vector< unsigned long int >& OpenCIF::BatchLoader::getLayerMap ( const unsigned long int& index ) const
+{
+   return ( loader_layer_maps[ index ] );
+}
@@ -0,0 +1,98 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_BATCHLOADER_HH_
+# define LIBOPENCIF_BATCHLOADER_HH_
+
+# include <memory>
+# include <string>
+# include <vector>
+
+# include "../file.hh"
+# include "../../layertable/layertable.hh"
+# include "../../threadpool/threadpool.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class loads many CIF files at the same time (a library of cells,
+    * for example), using the threads of a pool. Every thread takes the next
+    * file not loaded yet when it finishes the previous one, so a big file
+    * doesn't leave the other threads waiting. The result of every file (its
+    * LoadStatus and messages) is kept apart, so an error in a file doesn't
+    * stop the others.
+    *
+    * Every file is closed once loaded, whatever its retention policy (the
+    * policy of every file can drop more, like the raw commands). The
+    * transitions of the finite state machine are a constant table, shared by
+    * every thread.
+    *
+    * The names of the layers of every file are interned in a single table,
+    * in the order of the paths, and a map from the IDs of the table of every
+    * file to the IDs of the shared table is kept.
+    */
+   class BatchLoader
+   {
+      public:
+         explicit BatchLoader ( void );
+         virtual ~BatchLoader ( void );
+         
+         void setLoadMethod ( const OpenCIF::File::LoadMethod& new_load_method );
+         void setThreadAmount ( const unsigned long int& new_thread_amount );
+         void setRetentionPolicy ( const OpenCIF::File::RetentionPolicy& new_retention_policy );
+         OpenCIF::File::LoadMethod getLoadMethod ( void ) const;
+         unsigned long int getThreadAmount ( void ) const;
+         OpenCIF::File::RetentionPolicy getRetentionPolicy ( void ) const;
+         
+         void addPath ( const std::string& path );
+         void setPaths ( const std::vector< std::string >& new_paths );
+         const std::vector< std::string >& getPaths ( void ) const;
+         void clear ( void );
+         
+         unsigned long int load ( void );
+         unsigned long int load ( OpenCIF::ThreadPool& pool );
+         
+         unsigned long int getFileAmount ( void ) const;
+         OpenCIF::File::LoadStatus getStatus ( const unsigned long int& index ) const;
+         const std::vector< std::string >& getMessages ( const unsigned long int& index ) const;
+         OpenCIF::File& getFile ( const unsigned long int& index );
+         const OpenCIF::File& getFile ( const unsigned long int& index ) const;
+         std::unique_ptr< OpenCIF::File > releaseFile ( const unsigned long int& index );
+         
+         const OpenCIF::LayerTable& getLayers ( void ) const;
+         const std::vector< unsigned long int >& getLayerMap ( const unsigned long int& index ) const;
+      
+      private:
+         OpenCIF::File::LoadMethod loader_load_method;
+         unsigned long int loader_thread_amount;
+         OpenCIF::File::RetentionPolicy loader_retention_policy;
+         std::vector< std::string > loader_paths;
+         std::vector< std::unique_ptr< OpenCIF::File > > loader_files;
+         std::vector< OpenCIF::File::LoadStatus > loader_statuses;
+         std::vector< std::vector< std::string > > loader_messages;
+         OpenCIF::LayerTable loader_layers;
+         std::vector< std::vector< unsigned long int > > loader_layer_maps;
+   };
+}
+
+# endif
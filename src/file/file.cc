@@ -1,789 +1,1373 @@
-/*
- * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
- * Form) file. The library also includes a finite state machine to validate
- * the contents, acording to the specifications found in the technical
- * report 2686, from february 11, 1980.
- * 
- * Copyright (C) 2014, Moises Chavez Martinez
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see <http://www.gnu.org/licenses/>.
- */ 
-
-# include "file.hh"
-
-/*
- * Default constructor. Nothing to do.
- */
-OpenCIF::File::File ( void )
-{
-}
-
-/*
- * Destructor. Delete the commands stored (if any).
- */
-OpenCIF::File::~File ( void )
-{
-   for ( unsigned int i = 0; i < file_commands.size (); i++ )
-   {
-      delete file_commands[ i ];
-      file_commands[ i ] = 0;
-   }
-}
-
-/*
- * Member function to return the commands vector.
- */
-std::vector< OpenCIF::Command* > OpenCIF::File::getCommands ( void ) const
-{
-   return ( file_commands );
-}
-
-/*
- * Member function to return the file path.
- */
-std::string OpenCIF::File::getPath ( void ) const
-{
-   return ( file_path );
-}
-
-/*
- * Member function to set a vector of commands.
- */
-void OpenCIF::File::setCommands ( const std::vector< OpenCIF::Command* >& new_commands )
-{
-   file_commands = new_commands;
-   
-   return;
-}
-
-/*
- * Member function to release the vector of commands.
- */
-void OpenCIF::File::dropCommands ( void )
-{
-   std::vector< OpenCIF::Command* > temporal_vector;
-   file_commands = temporal_vector;
-   
-   return;
-}
-
-/*
- * Member function to set the path to the file.
- */
-void OpenCIF::File::setPath ( const std::string& new_path )
-{
-   file_path = new_path;
-   
-   return;
-}
-
-/*
- * Member function to return the messages generated during the load of the file.
- */
-std::vector< std::string > OpenCIF::File::getMessages ( void )
-{
-   return ( file_messages );
-}
-
-/*
- * Member function to load the input file. There is returned a LoadStatus
- * value that indicates the result of the process.
- */
-OpenCIF::File::LoadStatus OpenCIF::File::loadFile ( const LoadMethod& load_method )
-{
-   LoadStatus end_status;
-   
-   file_messages.clear ();
-   
-   end_status = openFile ();
-   
-   if ( end_status != AllOk )
-   {
-      return ( end_status );
-   }
-   
-   end_status = validateSyntax ( load_method );
-   cleanCommands ();
-   
-   if ( end_status != AllOk && load_method != ContinueOnError )
-   {
-      return ( end_status );
-   }
-   
-   convertCommands ();
-   
-   return ( end_status );
-}
-
-/*
- * This member function try to open the input file.
- */
-OpenCIF::File::LoadStatus OpenCIF::File::openFile ( void )
-{
-   if ( file_input.is_open () )
-   {
-      file_messages.push_back ( std::string ( "File:openFile:Warning: Input file already opened. Closing." ) );
-      file_input.close ();
-   }
-   
-   file_input.open ( file_path.c_str () );
-   
-   if ( !file_input.is_open () )
-   {
-      file_messages.push_back ( std::string ( "File:openFile:Error: Can't open input file." ) );
-      
-      return ( CantOpenInputFile );
-   }
-   
-   return ( AllOk );
-}
-
-/*
- * This member function validates the contents of the input file using
- * a finite state machine.
- */
-OpenCIF::File::LoadStatus OpenCIF::File::validateSyntax ( const LoadMethod& load_method )
-{
-   /*
-    * The process of validation isn't that complex.
-    * 
-    * I need to create a CIFFSM class instance. Such instance will help me to validate
-    * the file contents. The file is already opened. So, I'll read char by char and feed
-    * them to the CIFFSM instance. The CIFFSM instance will start, by default, in state 1.
-    * 
-    * I'll feed the instance characters until I reach the end of file or the instance reports
-    * an error (jump state equal to -1). After feeding the characters, if I finish feeding the
-    * file and none error was reported, I will check the current state of the instance.
-    * 
-    * The instance should end in state 91 or 92. If the FSM is in such states, the file is 
-    * correct and the format is supported.
-    * 
-    * If the FSM ends in any other state, the file is not neccessarally incorrect, but incomplete.
-    * 
-    * If there is a jump to a negative state, the file is invalid.
-    */
-   
-   OpenCIF::CIFFSM* fsm;
-   std::string command_buffer;
-   std::string error_block; // This string will help me to give a more clear indication of where is an error.
-                            // That will be done storing the previous 100 characters to the current loading point.
-   int jump_state = 1; // By default, start in 1
-   int previous_state; // Previous state.
-   char input_char;
-   char previous_char;
-   bool errors_omited = false;
-   
-   fsm = new OpenCIF::CIFFSM ();
-   
-   file_raw_commands.clear ();
-   
-   // Iterate over the contents of the file, until the file end is
-   // reached or the FSM reports a problem.
-   
-   while ( !file_input.eof () && jump_state != -1 )
-   {
-      previous_char = input_char;
-      input_char = file_input.get ();
-      error_block += input_char;
-      
-      if ( error_block.size () > 100 ) // If there are more than 100 chars in the error block, remove 1
-      {
-         error_block = error_block.substr ( 1 , 100 );
-      }
-   
-      if ( !file_input.eof () )
-      {
-         previous_state = jump_state;
-         jump_state = fsm->operator[] ( input_char );
-         
-         if ( jump_state == 1 && previous_state != 1 ) // If I'm returning to the first state, the command
-                                                       // is loaded. Just check the previous state. If the
-                                                       // previous state is the state 1, then, do nothing,
-                                                       // since those are characteres to skip.
-         {
-            std::string tmp;
-            tmp = input_char;
-            command_buffer += tmp;
-            
-            file_raw_commands.push_back ( command_buffer );
-            command_buffer = "";
-         }
-         else if ( jump_state != 1 && jump_state != -1 )
-         {
-            std::string tmp;
-            tmp = input_char;
-            command_buffer += tmp;
-         }
-         
-         // Check if the current jump state is to an error. 
-         // If so, and the load method indicates "ContinueOnError", reset the FSM
-         // to state 1, reset the current jumps to 1, clean the command buffer and skip chars until a semicolon
-         
-         if ( jump_state == -1 && load_method == ContinueOnError )
-         {
-            fsm->reset ();
-            jump_state = 1;
-            errors_omited = true;
-            command_buffer = "";
-            
-            file_input.putback ( input_char );
-            file_raw_commands.push_back ( "(LibOpenCIF: Incorrect command here) ;" );
-         }
-      }
-   }
-   
-   // File validated. What is the result?
-   std::ostringstream oss;
-   
-   if ( jump_state == -1 )
-   {
-      std::string tmp;
-      
-      // There is an invalid input.
-      file_messages.push_back ( std::string ( "File:validateSintax:Error: Error detected when validating contents of input file." ) );
-      
-      oss << previous_state;
-      
-      file_messages.push_back ( std::string ( "                           State: " ) + oss.str () );
-      
-      oss.str ( std::string ( "" ) );
-      oss << (char)previous_char;
-      
-      tmp = tmp;
-      
-      file_messages.push_back ( std::string ( "                           Input char: \"" ) +
-                                tmp +
-                                std::string ( "\" (ASCII=" ) +
-                                (
-                                   ( oss.str ( std::string ( "" ) ) , oss << (int)previous_char ) ,
-                                   oss.str ()
-                                ) +
-                                std::string ( ")" )
-                              );
-      
-      file_messages.push_back ( std::string ( "                           Current command buffer: \"" ) + command_buffer + std::string ( "\"" ) );
-      file_messages.push_back ( std::string ( "                           Previous 100 chars to error (including invalid char): \"" ) + error_block + std::string ( "\"" ) );
-      file_messages.push_back ( std::string ( "                           The loaded raw commands can be accessed to analize the error and locate the error." ) );
-      
-      return ( IncorrectInputFile );
-   }
-   
-   if ( jump_state != 91 && jump_state != 92 )
-   {
-      file_messages.push_back ( std::string ( "File:validateSintax:Error: The file contents are incomplete (maybe a missing END command)." ) );
-      
-      return ( IncompleteInputFile );
-   }
-   
-   // Everything Ok. Add last command (the END command)
-   file_raw_commands.push_back ( command_buffer );
-   
-   return ( ( errors_omited) ? IncorrectInputFile : AllOk );
-}
-
-void OpenCIF::File::cleanCommands ( void )
-{
-   for ( unsigned long int i = 0; i < file_raw_commands.size (); i++ )
-   {
-      file_raw_commands[ i ] = cleanCommand ( file_raw_commands[ i ] );
-   }
-   
-   return;
-}
-
-/*
- * This member function loads the contents of the input file and converts them
- * into Command instances.
- */
-void OpenCIF::File::convertCommands ( void )
-{
-   /*
-    * The raw commands are ready and validated. So, there is only left the process of
-    * turning those strings into commands.
-    */
-   
-   // First, delete and clear the current commands vector
-   for ( unsigned int i = 0; i < file_commands.size (); i++ )
-   {
-      delete file_commands[ i ];
-      file_commands[ i ] = 0;
-   }
-   
-   file_commands.clear ();
-   
-   // Iterate over the raw commands. Check the first char of all. The first char will tell me exactly
-   // wich command type is every one.
-   
-   for ( unsigned long int i = 0; i < file_raw_commands.size (); i++ )
-   {
-      std::string str_command;
-      OpenCIF::Command* command;
-      
-      str_command = file_raw_commands[ i ];
-      
-      switch ( str_command[ 0 ] )
-      {
-         case 'B':
-            command = new OpenCIF::BoxCommand ( str_command );
-            file_commands.push_back ( command );
-            break;
-            
-         case 'P':
-            command = new OpenCIF::PolygonCommand ( str_command );
-            file_commands.push_back ( command );
-            break;
-            
-         case 'W':
-            command = new OpenCIF::WireCommand ( str_command );
-            file_commands.push_back ( command );
-            break;
-            
-         case 'R':
-            command = new OpenCIF::RoundFlashCommand ( str_command );
-            file_commands.push_back ( command );
-            break;
-            
-         case '(':
-            command = new OpenCIF::CommentCommand ( str_command );
-            file_commands.push_back ( command );
-            break;
-            
-         case 'C':
-            command = new OpenCIF::CallCommand ( str_command );
-            file_commands.push_back ( command );
-            break;
-            
-         case 'D':
-            switch ( str_command[ 2 ] )
-            {
-               case 'D':
-                  command = new OpenCIF::DefinitionDeleteCommand ( str_command );
-                  file_commands.push_back ( command );
-                  break;
-                  
-               case 'F':
-                  command = new OpenCIF::DefinitionEndCommand ( str_command );
-                  file_commands.push_back ( command );
-                  break;
-                  
-               case 'S':
-                  command = new OpenCIF::DefinitionStartCommand ( str_command );
-                  file_commands.push_back ( command );
-                  break;
-            }
-            break;
-            
-         case 'L':
-            command = new OpenCIF::LayerCommand ( str_command );
-            file_commands.push_back ( command );
-            break;
-            
-         case 'E':
-            command = new OpenCIF::EndCommand ();
-            file_commands.push_back ( command );
-            break;
-            
-         default:
-            command = new OpenCIF::UserExtensionCommand ( str_command );
-            file_commands.push_back ( command );
-            break;
-      }
-   }
-   
-   return;
-}
-
-/*
- * This member function returns the vector of the raw (string) commands of the file.
- */
-std::vector< std::string > OpenCIF::File::getRawCommands ( void ) const
-{
-   return ( file_raw_commands );
-}
-
-/*
- * This member function takes as argument a command in string form. The command is "not clear". That means
- * that is in the same way it was readed from the file.
- * 
- * The process of cleaning is to delete anything that is not intented to exist and leave only that things that can make
- * the command easy to parse.
- * 
- * For example, from this: "P-100,10000thisisvalid-10000cuac,cuac,cuac,imaduck-20000yolo;"
- * To this:                "P -100 10000 -10000 -20000 ;"
- * 
- * So, such kind of string can be used as an input stream to read easily.
- * 
- * There are some commands that I can't clean, like the comment or user expansion commands. Those commands are just returned.
- * 
- * At least, I can know what kind of command I'm working with by it's first char.
- */
-std::string OpenCIF::File::cleanCommand ( std::string command )
-{
-   std::string final_command;
-   
-   switch ( command[ 0 ] )
-   {
-      // All of these commands can be processed as the same, since they only need values.
-      case 'P':
-      case 'B':
-      case 'W':
-      case 'R':
-         final_command = clearNumericCommand ( command );
-         break;
-         
-      case 'L': // Layer command
-         final_command = cleanLayerCommand ( command );
-         break;
-         
-      case 'C': // Call command
-         final_command = cleanCallCommand ( command );
-         break;
-         
-      case 'D': // Definition {Start|End|Delete} command.
-         final_command = cleanDefinitionCommand ( command );
-         break;
-         
-      case 'E': // End command.
-         final_command = "E ;";
-         break;
-         
-      default:
-         final_command = command.substr ( 0 , command.size () - 1 ) + " ;";
-         break;
-   }
-   
-   return ( final_command );
-}
-
-/*
- * This member function takes as argument a string that, maybe, is a CIF command.
- * 
- * The operation done is similar to the one performed when loading a CIF file, but
- * applied directly to a string. The idea is to validate a single string as a service
- * for the user.
- */
-bool OpenCIF::File::isCommandValid ( std::string command )
-{
-   /*
-    * The process of validation isn't that complex.
-    * 
-    * I need to create a CIFFSM class instance. Such instance will help me to validate
-    * the command contents. I'll read char by char and feed them to the CIFFSM instance.
-    * The CIFFSM instance will start, by default, in state 1.
-    * 
-    * I'll feed the instance characters until I reach the end of the command or the instance reports
-    * an error (jump state equal to -1). After feeding the characters, if I finish feeding the
-    * command and none error was reported, I will check the current state of the instance.
-    * 
-    * The instance should end in state 91 or 92. If the FSM is in such states, the command is 
-    * correct and the format is supported.
-    * 
-    * If there is a jump to a negative state, the command is invalid.
-    * 
-    * Also, I'm considering an invalid a string like this one:
-    * 
-    * this.is.an.invalid.string
-    * 
-    * Such string, according to the FSM used, is valid, since all of those characters are considered
-    * "Black characters", they are chars used to add spaces between commands.
-    * 
-    * So, what I'm considering a valid command? A string that *has* a valid command. If none valid
-    * command is found, then, even if the FSM says no invalid char is found, I'm going to return
-    * false, since a technically empty string doesn't count as a command.
-    */
-   
-   OpenCIF::CIFFSM* fsm;
-   
-   int jump_state = 1; // By default, start in 1
-   char input_char;
-   bool cif_command_found = false; // Flag to prevent validating strings that are, technically speaking, empty.
-   
-   fsm = new OpenCIF::CIFFSM ();
-   
-   // Iterate over the contents of the string, until the string end is
-   // reached or the FSM reports a problem.
-   
-   for ( unsigned int i = 0; i < command.size () && jump_state != -1; i++ )
-   {
-      input_char = command[ i ];
-      
-      jump_state = fsm->operator[] ( input_char );
-      
-      if ( jump_state > 1 )
-      {
-         cif_command_found = true;
-      }
-   }
-   
-   // String validated. What is the result?
-   if ( jump_state == -1 )
-   {      
-      return ( false );
-   }
-   
-   // If no command found, is considered invalid
-   if ( !cif_command_found )
-   {
-      return ( false );
-   }
-   
-   // Everything Ok. The string is a valid according to the CIF format.
-   
-   return ( true );
-}
-
-/*
- * This member function takes as argument a Definition command and returns it cleaned.
- * 
- * A definition command can be something like this:
- * 
- *      "DxxxxxSlol100im,totally,legal;"
- * 
- * So, the task of this member function is to turn it into like this:
- * 
- *      "D S 100 ;"
- * 
- * The process begins with the deletion of any non-digit and non-uppercase characters.
- * Such operation, if good, can leave a command like this:
- * 
- *      "DS100;"
- * 
- * To simplify the process of converting commands into instances, the commands must have
- * whitespaces to separate components (to use the strings as, for example, input streams).
- * 
- * So, the next process is to separate the components to turn the command into this:
- * 
- *      "D S 100 ;"
- */
-std::string OpenCIF::File::cleanDefinitionCommand ( std::string command )
-{
-   std::string final_command;
-   std::string tmp = " ";
-            
-   // There are only uppercase chars and digits
-   final_command = command[ 0 ];
-   final_command += tmp;
-   
-   // Remove not-necessary characters
-   command[ 0 ] = ' ';
-   for ( unsigned int i = 0; i < command.size (); i++ )
-   {
-      // If the current char is not a 'D', not a digit, not an 'S' and not an 'F'
-      if ( !std::isdigit ( command[ i ] ) && !std::isupper ( command[ i ] ) )
-      {
-         command[ i ] = ' ';
-      }
-   }
-   
-   for ( unsigned int i = 1; i < command.size (); i++ )
-   {
-      if ( std::isdigit ( command[ i ] ) )
-      {
-         final_command += command[ i ];
-      }
-      else if ( command[ i ] != ' ' )
-      {
-         final_command += command[ i ];
-         final_command += " ";
-      }
-      else if ( command[ i ] == ' ' && final_command[ final_command.size () - 1 ] != ' ' )
-      {
-         final_command += " ";
-      }
-   }
-   
-   ( final_command[ final_command.size () - 1 ] == ' ' )
-      ? final_command += ";"
-      : final_command += " ;";
-   
-   return ( final_command );
-}
-
-/*
- * This member function takes as argument a call command and returns it cleaned.
- * 
- * A call command can be something like this:
- * 
- *      "C1T20000 -20000R1000000 -59999MXlololololololololMY MXMXMXMYMXR100 100R100 100;"
- * 
- * So, the task of this member function is to turn it into like this:
- * 
- *      "C 1 T 20000 -20000 R 1000000 -59999 M X M Y M X M X M X M Y M X R 100 100 R 100 100;"
- * 
- * The process begins with the deletion of any non-digit, non-dash ('-') and non-uppercase characters.
- * Such operation, if good, can leave a command like this:
- * 
- *      "C 1 T 20000 -20000 R 1000000 -59999 MX MY MXMXMXMYMXR100 100R100 100;"
- * 
- * To simplify the process of converting commands into instances, the commands must have
- * whitespaces to separate components (to use the strings as, for example, input streams).
- * 
- * So, the next process is to separate the components to turn the command into this:
- * 
- *      "C 1 T 20000 -20000 R 1000000 -59999 M X M Y M X M X M X M Y M X R 100 100 R 100 100;"
- */
-std::string OpenCIF::File::cleanCallCommand ( std::string command )
-{
-   std::string final_command;
-   std::string tmp = " ";
-            
-   // There are only uppercase chars
-   final_command = command[ 0 ];
-   final_command += tmp;
-   
-   // Remove not-necessary characters
-   command[ 0 ] = ' ';
-   for ( unsigned int i = 0; i < command.size (); i++ )
-   {
-      if ( !std::isdigit ( command[ i ] ) && !std::isupper( command[ i ] ) && command[ i ] != '-' )
-      {
-         command[ i ] = ' ';
-      }
-   }
-   
-   for ( unsigned int i = 1; i < command.size (); i++ )
-   {
-      tmp = command[ i ];
-      
-      if ( std::isdigit ( command[ i ] ) )
-      {
-         final_command += tmp;
-      }
-      else if ( command[ i ] != ' ' )
-      {
-         if ( final_command[ final_command.size () - 1 ] != ' ' )
-         {
-            final_command += " ";
-         }
-         
-         final_command += tmp;
-         
-         if ( std::isupper ( command[ i ] ) )
-         {
-            final_command += " ";
-         }
-      }
-      else if ( final_command[ final_command.size () - 1 ] != ' ' )
-      {
-         final_command += " ";
-      }
-   }
-   
-   ( final_command[ final_command.size () - 1 ] == ' ' )
-      ? final_command += ";"
-      : final_command += " ;";
-   
-   return ( final_command );
-}
-
-/*
- * This member function takes as argument a Layer camand and removes any unnecesary character.
- */
-std::string OpenCIF::File::cleanLayerCommand ( std::string command )
-{
-   std::string tmp = " ";
-   std::string final_command;
-            
-   final_command = command[ 0 ];
-   final_command += tmp;
-   
-   // Remove not-necessary characters
-   command[ 0 ] = ' ';
-   for ( unsigned int i = 0; i < command.size (); i++ )
-   {
-      if ( !std::isupper ( command[ i ] ) && command[ i ] != '_' && ! std::isdigit ( command[ i ] ) )
-      {
-         command[ i ] = ' ';
-      }
-   }
-   
-   std::istringstream iss ( command );
-   
-   while ( !iss.eof () )
-   {
-      iss >> tmp;
-      
-      if ( !iss.eof () )
-      {
-         final_command += tmp;
-         tmp = " ";
-         final_command += tmp;
-      }
-   }
-   
-   final_command += ";";
-            
-   return ( final_command );
-}
-
-/*
- * This member function takes as argument a numeric command (like a Polygon or Box command)
- * and cleans it.
- * 
- * A numeric command can be something like this:
- * 
- *      "W1000,muajajajajaja20000,,,this,is,valid20000twerking,so,hard,,,,,,xoxoxoxoxox-10000,-10000,-500 juar juar juarX-4000;"
- * 
- * So, the task of this member function is to turn it into like this:
- * 
- *      "W 1000 20000 20000 -10000 -10000 -500 -4000 ;"
- * 
- * The process begins with the deletion of any non-digit and non-dash ('-') characters.
- * Such operation, if good, can leave a command like this:
- * 
- *      "W1000              20000                20000                                 -10000 -10000 -500                -4000;"
- * 
- * To simplify the process of converting commands into instances, the commands must have
- * whitespaces to separate components (to use the strings as, for example, input streams).
- * 
- * So, the next process is to separate the components to turn the command into this:
- * 
- *      "W 1000 20000 20000 -10000 -10000 -500 -4000 ;"
- */
-std::string OpenCIF::File::clearNumericCommand ( std::string command )
-{
-   std::string tmp = " ";
-   std::string final_command;
-            
-   // There are only numbers and guides ("-")
-   final_command = command[ 0 ];
-   final_command += tmp;
-   
-   // Remove not-necessary characters
-   for ( unsigned int i = 0; i < command.size (); i++ )
-   {
-      if ( !std::isdigit ( command[ i ] ) && command[ i ] != '-' )
-      {
-         command[ i ] = ' ';
-      }
-   }
-   
-   std::istringstream iss ( command );
-   
-   while ( !iss.eof () )
-   {
-      iss >> tmp;
-      
-      if ( !iss.eof () )
-      {
-         final_command += tmp;
-         tmp = " ";
-         final_command += tmp;
-      }
-   }
-   
-   final_command += ";";
-   
-   return ( final_command );
-}
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+# include <cstdio>
+# include <unordered_set>
+
+# include "file.hh"
+# include "../design/design.hh"
+
+/*
+ * Default constructor. Keep everything once loaded.
+ */
+OpenCIF::File::File ( void )
+   : file_retention_policy ( KeepEverything )
+{
+}
+
+/*
+ * Destructor. Delete the commands stored (if any).
+ */
+OpenCIF::File::~File ( void )
+{
+   deleteCommands ();
+}
+
+/*
+ * Member function to delete the commands stored (the File instance owns them).
+ */
+void OpenCIF::File::deleteCommands ( void )
+{
+   for ( unsigned long int i = 0; i < file_commands.size (); i++ )
+   {
+      delete file_commands[ i ];
+      file_commands[ i ] = 0;
+   }
+   
+   file_commands.clear ();
+   
+   return;
+}
+
+/*
+ * Member function to return the commands vector. No copy is done, the
+ * reference is valid while the commands are not converted, replaced or released.
+ */
+const std::vector< OpenCIF::Command* >& OpenCIF::File::getCommands ( void ) const
+{
+   return ( file_commands );
+}
+
+/*
+ * Member function to return the file path.
+ */
+std::string OpenCIF::File::getPath ( void ) const
+{
+   return ( file_path );
+}
+
+/*
+ * Member function to delete the commands stored that aren't in a list of
+ * commands, for example, the new list given to setCommands.
+ */
+void OpenCIF::File::deleteCommands ( const std::vector< OpenCIF::Command* >& kept_commands )
+{
+   std::unordered_set< const OpenCIF::Command* > kept ( kept_commands.begin () , kept_commands.end () );
+   
+   for ( unsigned long int i = 0; i < file_commands.size (); i++ )
+   {
+      if ( kept.find ( file_commands[ i ] ) == kept.end () )
+      {
+         delete file_commands[ i ];
+      }
+      
+      file_commands[ i ] = 0;
+   }
+   
+   file_commands.clear ();
+   
+   return;
+}
+
+/*
+ * Member function to set a vector of commands. The File instance takes the
+ * ownership of the new commands. The commands stored previously that aren't
+ * in the new vector are deleted, so a vector taken from getCommands and then
+ * changed can be set again.
+ */
+void OpenCIF::File::setCommands ( const std::vector< OpenCIF::Command* >& new_commands )
+{
+   // The vector can be the one returned by getCommands.
+   if ( &new_commands == &file_commands )
+   {
+      file_compact_commands.clear ();
+      
+      return;
+   }
+   
+   deleteCommands ( new_commands );
+   file_compact_commands.clear ();
+   file_commands = new_commands;
+   
+   return;
+}
+
+/*
+ * Member function to set a vector of commands, moving the vector received.
+ * Like the other overload, the commands stored previously that aren't in the
+ * new vector are deleted.
+ */
+void OpenCIF::File::setCommands ( std::vector< OpenCIF::Command* >&& new_commands )
+{
+   if ( &new_commands == &file_commands )
+   {
+      file_compact_commands.clear ();
+      
+      return;
+   }
+   
+   deleteCommands ( new_commands );
+   file_compact_commands.clear ();
+   file_commands = std::move ( new_commands );
+   
+   return;
+}
+
+/*
+ * Member function to set a vector of commands owned by unique pointers. The
+ * File instance takes the ownership of the commands, and deletes all the ones
+ * stored previously (the unique pointers can't share them).
+ */
+void OpenCIF::File::setCommands ( std::vector< std::unique_ptr< OpenCIF::Command > >&& new_commands )
+{
+   deleteCommands ();
+   file_compact_commands.clear ();
+   file_commands.reserve ( new_commands.size () );
+   
+   for ( unsigned long int i = 0; i < new_commands.size (); i++ )
+   {
+      file_commands.push_back ( new_commands[ i ].release () );
+   }
+   
+   new_commands.clear ();
+   
+   return;
+}
+
+/*
+ * Member function to give the ownership of the commands to the caller. The
+ * File instance is left without commands.
+ */
+std::vector< std::unique_ptr< OpenCIF::Command > > OpenCIF::File::releaseCommands ( void )
+{
+   std::vector< std::unique_ptr< OpenCIF::Command > > released_commands;
+   
+   released_commands.reserve ( file_commands.size () );
+   
+   for ( unsigned long int i = 0; i < file_commands.size (); i++ )
+   {
+      released_commands.push_back ( std::unique_ptr< OpenCIF::Command > ( file_commands[ i ] ) );
+   }
+   
+   file_commands.clear ();
+   
+   return ( released_commands );
+}
+
+/*
+ * Member function to release the vector of commands without deleting them.
+ * The caller must own the commands (for example, using a copy of the vector
+ * returned by getCommands) and delete them.
+ */
+void OpenCIF::File::dropCommands ( void )
+{
+   file_commands.clear ();
+   
+   return;
+}
+
+/*
+ * Member function to return the commands kept as a CommandArray, by the
+ * policy KeepCompactOnly. It's empty with the other policies.
+ */
+const OpenCIF::CommandArray& OpenCIF::File::getCompactCommands ( void ) const
+{
+   return ( file_compact_commands );
+}
+
+/*
+ * Member function to convert the commands kept as a CommandArray back to
+ * commands (returned by getCommands). The CommandArray is cleared.
+ */
+void OpenCIF::File::restoreCommands ( void )
+{
+   if ( file_compact_commands.size () > 0 )
+   {
+      setCommands ( file_compact_commands.toCommands () );
+   }
+   
+   return;
+}
+
+/*
+ * Member function to create a design with the commands, the layers and the
+ * messages of the file, using the default expander. The File instance is
+ * left without commands.
+ */
+std::shared_ptr< const OpenCIF::Design > OpenCIF::File::createDesign ( void )
+{
+   return ( createDesign ( OpenCIF::Expander () ) );
+}
+
+/*
+ * Member function to create a design with the commands, the layers and the
+ * messages of the file. The expander gives the bounding boxes of the
+ * primitives of the spatial indexes. The File instance is left without
+ * commands.
+ */
+std::shared_ptr< const OpenCIF::Design > OpenCIF::File::createDesign ( const OpenCIF::Expander& expander , const unsigned long int& thread_amount )
+{
+   return ( std::shared_ptr< const OpenCIF::Design > ( new OpenCIF::Design ( releaseCommands () , file_layers , file_messages , expander , thread_amount ) ) );
+}
+
+/*
+ * Member function to set the path to the file.
+ */
+void OpenCIF::File::setPath ( const std::string& new_path )
+{
+   file_path = new_path;
+   
+   return;
+}
+
+/*
+ * Member function to set what loadFile keeps once the file is loaded.
+ */
+void OpenCIF::File::setRetentionPolicy ( const RetentionPolicy& new_retention_policy )
+{
+   file_retention_policy = new_retention_policy;
+   
+   return;
+}
+
+OpenCIF::File::RetentionPolicy OpenCIF::File::getRetentionPolicy ( void ) const
+{
+   return ( file_retention_policy );
+}
+
+/*
+ * Member function to return the messages generated during the load of the file.
+ */
+const std::vector< std::string >& OpenCIF::File::getMessages ( void ) const
+{
+   return ( file_messages );
+}
+
+/*
+ * Member function to load the input file. There is returned a LoadStatus
+ * value that indicates the result of the process.
+ */
+OpenCIF::File::LoadStatus OpenCIF::File::loadFile ( const LoadMethod& load_method )
+{
+   LoadStatus end_status;
+   
+   file_messages.clear ();
+   
+   end_status = openFile ();
+   
+   if ( end_status != AllOk )
+   {
+      return ( end_status );
+   }
+   
+   end_status = validateSyntax ( load_method );
+   cleanCommands ();
+   
+# ifdef LIBOPENCIF_COMPACT_COORDINATES
+   // The coordinates are checked whenever the commands will be converted, so with the method
+   // ContinueOnError a value that doesn't fit is reported even after a syntax error.
+   if ( end_status == AllOk || load_method == ContinueOnError )
+   {
+      LoadStatus coordinates_status = checkCoordinates ();
+      
+      if ( end_status == AllOk )
+      {
+         end_status = coordinates_status;
+      }
+   }
+# endif
+   
+   if ( end_status != AllOk && load_method != ContinueOnError )
+   {
+      // The raw commands are kept, since they weren't converted.
+      if ( file_retention_policy != KeepEverything )
+      {
+         closeFile ();
+      }
+      
+      return ( end_status );
+   }
+   
+   convertCommands ();
+   applyRetentionPolicy ();
+   
+   return ( end_status );
+}
+
+/*
+ * Member function to drop what the retention policy doesn't keep, once the
+ * commands are converted.
+ */
+void OpenCIF::File::applyRetentionPolicy ( void )
+{
+   if ( file_retention_policy >= CloseInput )
+   {
+      closeFile ();
+   }
+   
+   if ( file_retention_policy >= DropRawCommands )
+   {
+      std::vector< std::string > ().swap ( file_raw_commands );
+   }
+   
+   if ( file_retention_policy >= KeepCompactOnly )
+   {
+      file_compact_commands.assign ( file_commands );
+      deleteCommands ();
+      std::vector< OpenCIF::Command* > ().swap ( file_commands );
+   }
+   
+   return;
+}
+
+/*
+ * This member function try to open the input file.
+ */
+OpenCIF::File::LoadStatus OpenCIF::File::openFile ( void )
+{
+   if ( file_input.is_open () )
+   {
+      file_messages.push_back ( std::string ( "File:openFile:Warning: Input file already opened. Closing." ) );
+      file_input.close ();
+   }
+   
+   file_input.open ( file_path.c_str () );
+   
+   if ( !file_input.is_open () )
+   {
+      file_messages.push_back ( std::string ( "File:openFile:Error: Can't open input file." ) );
+      
+      return ( CantOpenInputFile );
+   }
+   
+   return ( AllOk );
+}
+
+/*
+ * This member function closes the input file, if it's open. The raw commands
+ * and the commands already loaded are kept.
+ */
+void OpenCIF::File::closeFile ( void )
+{
+   if ( file_input.is_open () )
+   {
+      file_input.close ();
+   }
+   
+   return;
+}
+
+/*
+ * This member function validates the contents of the input file using
+ * a finite state machine.
+ */
+OpenCIF::File::LoadStatus OpenCIF::File::validateSyntax ( const LoadMethod& load_method )
+{
+   return ( validateSyntax ( file_input , load_method ) );
+}
+
+/*
+ * This member function validates the contents of any input stream (for
+ * example, a CIF text already in memory) the same way, and keeps the raw
+ * commands found. The stream is read until its end, or until an error is
+ * found with the method StopOnError.
+ */
+OpenCIF::File::LoadStatus OpenCIF::File::validateSyntax ( std::istream& input , const LoadMethod& load_method )
+{
+   /*
+    * The process of validation isn't that complex.
+    * 
+    * I need to create a CIFFSM class instance. Such instance will help me to validate
+    * the file contents. The file is already opened. So, I'll read char by char and feed
+    * them to the CIFFSM instance. The CIFFSM instance will start, by default, in state 1.
+    * 
+    * I'll feed the instance characters until I reach the end of file or the instance reports
+    * an error (jump state equal to -1). After feeding the characters, if I finish feeding the
+    * file and none error was reported, I will check the current state of the instance.
+    * 
+    * The instance should end in state 91 or 92. If the FSM is in such states, the file is 
+    * correct and the format is supported.
+    * 
+    * If the FSM ends in any other state, the file is not neccessarally incorrect, but incomplete.
+    * 
+    * If there is a jump to a negative state, the file is invalid.
+    */
+   
+   OpenCIF::CIFFSM fsm; // Cheap to create, the transitions are stored in a constant table.
+   std::string command_buffer;
+   std::string error_block; // This string will help me to give a more clear indication of where is an error.
+                            // That will be done storing the previous 100 characters to the current loading point.
+   int jump_state = 1; // By default, start in 1
+   int previous_state; // Previous state.
+   char input_char;
+   char previous_char;
+   bool errors_omited = false;
+   bool skipping = false; // True from an error until a command is loaded, so adjacent errors make a single span.
+   unsigned long int offset = 0; // Offset of the next char of the file.
+   unsigned long int command_start = 0; // Offset of the first char of the current command.
+   
+   file_raw_commands.clear ();
+   file_error_spans.clear ();
+   
+   // Iterate over the contents of the file, until the file end is
+   // reached or the FSM reports a problem.
+   
+   while ( !input.eof () && jump_state != -1 )
+   {
+      previous_char = input_char;
+      input_char = input.get ();
+      offset++;
+      error_block += input_char;
+      
+      if ( error_block.size () >= 200 ) // Keep at least the last 100 chars, removing them in blocks of 100
+      {
+         error_block.erase ( 0 , 100 );
+      }
+   
+      if ( !input.eof () )
+      {
+         previous_state = jump_state;
+         jump_state = fsm[ input_char ];
+         
+         if ( previous_state == 1 && jump_state != 1 )
+         {
+            command_start = offset - 1;
+         }
+         
+         if ( jump_state == 1 && previous_state != 1 ) // If I'm returning to the first state, the command
+                                                       // is loaded. Just check the previous state. If the
+                                                       // previous state is the state 1, then, do nothing,
+                                                       // since those are characteres to skip.
+         {
+            std::string tmp;
+            tmp = input_char;
+            command_buffer += tmp;
+            
+            file_raw_commands.push_back ( command_buffer );
+            command_buffer = "";
+            skipping = false;
+         }
+         else if ( jump_state != 1 && jump_state != -1 )
+         {
+            std::string tmp;
+            tmp = input_char;
+            command_buffer += tmp;
+         }
+         
+         // Check if the current jump state is to an error. 
+         // If so, and the load method indicates "ContinueOnError", skip the chars until the
+         // semicolon that ends the incorrect command, keep the span skipped, reset the FSM
+         // to state 1, reset the current jumps to 1 and clean the command buffer.
+         
+         if ( jump_state == -1 && load_method == ContinueOnError )
+         {
+            offset += skipCommand ( input , command_buffer + input_char );
+            
+            // The errors found before loading another command extend the same span.
+            if ( skipping )
+            {
+               file_error_spans.back ().second = offset;
+            }
+            else
+            {
+               file_error_spans.push_back ( std::make_pair ( command_start , offset ) );
+               file_raw_commands.push_back ( "(LibOpenCIF: Incorrect command here) ;" );
+            }
+            
+            fsm.reset ();
+            jump_state = 1;
+            errors_omited = true;
+            skipping = true;
+            command_buffer = "";
+         }
+      }
+   }
+   
+   // File validated. What is the result?
+   std::ostringstream oss;
+   
+   for ( unsigned long int i = 0; i < file_error_spans.size (); i++ )
+   {
+      oss.str ( std::string ( "" ) );
+      oss << "File:validateSintax:Warning: Incorrect commands skipped, from byte " << file_error_spans[ i ].first
+          << " to byte " << file_error_spans[ i ].second << ".";
+      file_messages.push_back ( oss.str () );
+   }
+   
+   if ( jump_state == -1 )
+   {
+      std::string tmp;
+      
+      // There is an invalid input.
+      file_messages.push_back ( std::string ( "File:validateSintax:Error: Error detected when validating contents of input file." ) );
+      
+      oss << previous_state;
+      
+      file_messages.push_back ( std::string ( "                           State: " ) + oss.str () );
+      
+      oss.str ( std::string ( "" ) );
+      oss << (char)previous_char;
+      
+      tmp = tmp;
+      
+      file_messages.push_back ( std::string ( "                           Input char: \"" ) +
+                                tmp +
+                                std::string ( "\" (ASCII=" ) +
+                                (
+                                   ( oss.str ( std::string ( "" ) ) , oss << (int)previous_char ) ,
+                                   oss.str ()
+                                ) +
+                                std::string ( ")" )
+                              );
+      
+      file_messages.push_back ( std::string ( "                           Current command buffer: \"" ) + command_buffer + std::string ( "\"" ) );
+      file_messages.push_back ( std::string ( "                           Previous 100 chars to error (including invalid char): \"" ) + error_block.substr ( ( error_block.size () > 100 ) ? error_block.size () - 100 : 0 ) + std::string ( "\"" ) );
+      file_messages.push_back ( std::string ( "                           The loaded raw commands can be accessed to analize the error and locate the error." ) );
+      
+      return ( IncorrectInputFile );
+   }
+   
+   if ( jump_state != 91 && jump_state != 92 )
+   {
+      file_messages.push_back ( std::string ( "File:validateSintax:Error: The file contents are incomplete (maybe a missing END command)." ) );
+      
+      return ( IncompleteInputFile );
+   }
+   
+   // Everything Ok. Add last command (the END command)
+   file_raw_commands.push_back ( command_buffer );
+   
+   return ( ( errors_omited) ? IncorrectInputFile : AllOk );
+}
+
+/*
+ * This member function skips the rest of an incorrect command, given the chars
+ * already read: the chars until the next semicolon outside the parentheses (a
+ * semicolon inside a comment doesn't end it). The chars are taken from the
+ * buffer of the stream, without validating them. Returns the amount of chars
+ * skipped.
+ */
+unsigned long int OpenCIF::File::skipCommand ( std::istream& input , const std::string& command )
+{
+   std::streambuf* buffer = input.rdbuf ();
+   unsigned long int skipped = 0;
+   unsigned long int depth = 0;
+   
+   for ( unsigned long int i = 0; i < command.size (); i++ )
+   {
+      if ( command[ i ] == '(' )
+      {
+         depth++;
+      }
+      else if ( command[ i ] == ')' && depth > 0 )
+      {
+         depth--;
+      }
+   }
+   
+   // The incorrect char can be the semicolon itself.
+   if ( !command.empty () && command[ command.size () - 1 ] == ';' && depth == 0 )
+   {
+      return ( 0 );
+   }
+   
+   for ( int input_char = buffer->sbumpc (); input_char != std::char_traits< char >::eof (); input_char = buffer->sbumpc () )
+   {
+      skipped++;
+      
+      if ( input_char == '(' )
+      {
+         depth++;
+      }
+      else if ( input_char == ')' && depth > 0 )
+      {
+         depth--;
+      }
+      else if ( input_char == ';' && depth == 0 )
+      {
+         return ( skipped );
+      }
+   }
+   
+   input.setstate ( std::ios::eofbit );
+   
+   return ( skipped );
+}
+
+/*
+ * Member function to return the spans of the file skipped by validateSyntax
+ * with the method ContinueOnError, as the byte offsets of their first char
+ * and of the char after the last one. Every span is replaced by a single
+ * "Incorrect command here" comment in the raw commands.
+ */
+const std::vector< std::pair< unsigned long int , unsigned long int > >& OpenCIF::File::getErrorSpans ( void ) const
+{
+   return ( file_error_spans );
+}
+
+void OpenCIF::File::cleanCommands ( void )
+{
+   for ( unsigned long int i = 0; i < file_raw_commands.size (); i++ )
+   {
+      file_raw_commands[ i ] = cleanCommand ( file_raw_commands[ i ] );
+   }
+   
+   return;
+}
+
+/*
+ * This member function loads the contents of the input file and converts them
+ * into Command instances.
+ */
+void OpenCIF::File::convertCommands ( void )
+{
+   /*
+    * The raw commands are ready and validated. So, there is only left the process of
+    * turning those strings into commands.
+    */
+   
+   // First, delete and clear the current commands vector
+   deleteCommands ();
+   file_compact_commands.clear ();
+   file_commands.reserve ( file_raw_commands.size () );
+   file_layers.clear ();
+   
+   // The layer names are interned in the layer table, and every primitive receives the ID of the
+   // current layer. The current layer is local to every definition, so it is saved when a
+   // definition starts, and restored when the definition ends.
+   unsigned long int current_layer = OpenCIF::LayerTable::NoLayer;
+   unsigned long int outer_layer = OpenCIF::LayerTable::NoLayer;
+   
+   // Iterate over the raw commands, converting every one of them.
+   
+   for ( unsigned long int i = 0; i < file_raw_commands.size (); i++ )
+   {
+      OpenCIF::Command* command = convertCommand ( file_raw_commands[ i ] );
+      
+      switch ( command->type () )
+      {
+         case OpenCIF::Command::Box:
+         case OpenCIF::Command::Polygon:
+         case OpenCIF::Command::Wire:
+         case OpenCIF::Command::RoundFlash:
+            static_cast< OpenCIF::PrimitiveCommand* > ( command )->setLayerID ( current_layer );
+            break;
+            
+         case OpenCIF::Command::Layer:
+         {
+            OpenCIF::LayerCommand* layer = static_cast< OpenCIF::LayerCommand* > ( command );
+            
+            current_layer = file_layers.intern ( layer->getName () );
+            layer->setID ( current_layer );
+            break;
+         }
+            
+         case OpenCIF::Command::DefinitionStart:
+            outer_layer = current_layer;
+            current_layer = OpenCIF::LayerTable::NoLayer;
+            break;
+            
+         case OpenCIF::Command::DefinitionEnd:
+            current_layer = outer_layer;
+            break;
+            
+         default:
+            break;
+      }
+      
+      file_commands.push_back ( command );
+   }
+   
+   return;
+}
+
+/*
+ * This member function takes as argument a clean command (as returned by cleanCommand) and
+ * returns a new instance of the right class. The first char of the command tells exactly
+ * which command type it is. The caller owns the instance returned.
+ * 
+ * The layer IDs are not set, since they depend on the commands found before.
+ */
+OpenCIF::Command* OpenCIF::File::convertCommand ( const std::string& command )
+{
+   switch ( command[ 0 ] )
+   {
+      case 'B':
+         return ( new OpenCIF::BoxCommand ( command ) );
+         
+      case 'P':
+         return ( new OpenCIF::PolygonCommand ( command ) );
+         
+      case 'W':
+         return ( new OpenCIF::WireCommand ( command ) );
+         
+      case 'R':
+         return ( new OpenCIF::RoundFlashCommand ( command ) );
+         
+      case '(':
+         return ( new OpenCIF::CommentCommand ( command ) );
+         
+      case 'C':
+         return ( new OpenCIF::CallCommand ( command ) );
+         
+      case 'D': // The clean command is "D S ...", "D F ;" or "D D ...".
+         switch ( ( command.size () > 2 ) ? command[ 2 ] : 'S' )
+         {
+            case 'D':
+               return ( new OpenCIF::DefinitionDeleteCommand ( command ) );
+               
+            case 'F':
+               return ( new OpenCIF::DefinitionEndCommand ( command ) );
+               
+            default:
+               return ( new OpenCIF::DefinitionStartCommand ( command ) );
+         }
+         
+      case 'L':
+         return ( new OpenCIF::LayerCommand ( command ) );
+         
+      case 'E':
+         return ( new OpenCIF::EndCommand () );
+         
+      default:
+         return ( new OpenCIF::UserExtensionCommand ( command ) );
+   }
+}
+
+/*
+ * This member function checks that the coordinates of every clean command can be stored by the
+ * Point class. It's used by loadFile when the coordinates are stored in 32 bits, so a file with
+ * larger values is reported instead of being loaded with the values saturated.
+ */
+OpenCIF::File::LoadStatus OpenCIF::File::checkCoordinates ( void )
+{
+   for ( unsigned long int i = 0; i < file_raw_commands.size (); i++ )
+   {
+      if ( !fitsCoordinates ( file_raw_commands[ i ] ) )
+      {
+         std::ostringstream oss;
+         
+         oss << i;
+         
+         file_messages.push_back ( std::string ( "File:checkCoordinates:Error: A value can't be stored as a coordinate." ) );
+         file_messages.push_back ( std::string ( "                             Command number: " ) + oss.str () );
+         file_messages.push_back ( std::string ( "                             Command: \"" ) + file_raw_commands[ i ] + std::string ( "\"" ) );
+         
+         return ( IncorrectInputFile );
+      }
+   }
+   
+   return ( AllOk );
+}
+
+/*
+ * This member function estimates the memory used by a command: the instance and the lists it
+ * owns.
+ */
+unsigned long int OpenCIF::File::commandMemory ( const OpenCIF::Command* command )
+{
+   switch ( command->type () )
+   {
+      case OpenCIF::Command::Box:
+         return ( sizeof ( OpenCIF::BoxCommand ) );
+      
+      case OpenCIF::Command::RoundFlash:
+         return ( sizeof ( OpenCIF::RoundFlashCommand ) );
+      
+      case OpenCIF::Command::Polygon:
+         return ( sizeof ( OpenCIF::PolygonCommand ) +
+                  static_cast< const OpenCIF::PolygonCommand* > ( command )->getPoints ().capacity () * sizeof ( OpenCIF::Point ) );
+      
+      case OpenCIF::Command::Wire:
+         return ( sizeof ( OpenCIF::WireCommand ) +
+                  static_cast< const OpenCIF::WireCommand* > ( command )->getPoints ().capacity () * sizeof ( OpenCIF::Point ) );
+      
+      case OpenCIF::Command::Call:
+         return ( sizeof ( OpenCIF::CallCommand ) +
+                  static_cast< const OpenCIF::CallCommand* > ( command )->getTransformations ().capacity () * sizeof ( OpenCIF::Transformation ) );
+      
+      case OpenCIF::Command::Comment:
+      case OpenCIF::Command::UserExtension:
+         return ( sizeof ( OpenCIF::UserExtensionCommand ) + stringMemory ( static_cast< const OpenCIF::RawContentCommand* > ( command )->getContent () ) );
+      
+      case OpenCIF::Command::DefinitionStart:
+         return ( sizeof ( OpenCIF::DefinitionStartCommand ) );
+      
+      case OpenCIF::Command::Layer:
+         return ( sizeof ( OpenCIF::LayerCommand ) + stringMemory ( static_cast< const OpenCIF::LayerCommand* > ( command )->getName () ) );
+      
+      default:
+         return ( sizeof ( OpenCIF::Command ) );
+   }
+}
+
+/*
+ * This member function returns the memory used by the text of a string out of the instance (none
+ * if it's short enough to be stored inside).
+ */
+unsigned long int OpenCIF::File::stringMemory ( const std::string& text )
+{
+   static const unsigned long int inner_capacity = std::string ().capacity ();
+   
+   return ( ( text.capacity () > inner_capacity ) ? text.capacity () + 1 : 0 );
+}
+
+/*
+ * This member function takes as argument a clean command and checks that its values (the
+ * coordinates and sizes of a primitive, and the values of the transformations of a call) can be
+ * stored by the Point class. The other commands have no coordinates.
+ */
+bool OpenCIF::File::fitsCoordinates ( const std::string& command )
+{
+   unsigned long int i = 1;
+   
+   switch ( command[ 0 ] )
+   {
+      case 'B':
+      case 'P':
+      case 'W':
+      case 'R':
+         break;
+         
+      case 'C': // Skip the ID of the symbol called.
+         while ( i < command.size () && !std::isdigit ( (unsigned char)command[ i ] ) )
+         {
+            i++;
+         }
+         
+         while ( i < command.size () && std::isdigit ( (unsigned char)command[ i ] ) )
+         {
+            i++;
+         }
+         
+         break;
+         
+      default:
+         return ( true );
+   }
+   
+   while ( i < command.size () )
+   {
+      if ( !std::isdigit ( (unsigned char)command[ i ] ) )
+      {
+         i++;
+         
+         continue;
+      }
+      
+      bool negative = ( command[ i - 1 ] == '-' );
+      unsigned long int limit = ( negative ) ? (unsigned long int)( -( OpenCIF::Point::Minimum + 1 ) ) + 1 : (unsigned long int)( OpenCIF::Point::Maximum );
+      unsigned long int value = 0;
+      
+      for ( ; i < command.size () && std::isdigit ( (unsigned char)command[ i ] ); i++ )
+      {
+         if ( value > ( limit - (unsigned long int)( command[ i ] - '0' ) ) / 10 )
+         {
+            return ( false );
+         }
+         
+         value = value * 10 + ( command[ i ] - '0' );
+      }
+   }
+   
+   return ( true );
+}
+
+/*
+ * This member function returns the table of layers found when the commands
+ * were converted. The IDs stored in the LayerCommand and PrimitiveCommand
+ * instances refer to this table.
+ */
+const OpenCIF::LayerTable& OpenCIF::File::getLayers ( void ) const
+{
+   return ( file_layers );
+}
+
+/*
+ * Member function to estimate the memory used by the file, adding every
+ * category.
+ */
+unsigned long int OpenCIF::File::memoryUsage ( void ) const
+{
+   unsigned long int total = 0;
+   
+   for ( int category = InputMemory; category <= LayerMemory; category++ )
+   {
+      total += memoryUsage ( static_cast< MemoryCategory > ( category ) );
+   }
+   
+   return ( total );
+}
+
+/*
+ * Member function to estimate the memory used by a category: the instances,
+ * the capacity of their vectors and the texts out of the strings. The
+ * buffer of the input stream is taken as BUFSIZ bytes while it's open.
+ */
+unsigned long int OpenCIF::File::memoryUsage ( const MemoryCategory& category ) const
+{
+   unsigned long int total = 0;
+   
+   switch ( category )
+   {
+      case InputMemory:
+         total = sizeof ( file_input ) + ( file_input.is_open () ? BUFSIZ : 0 );
+         break;
+      
+      case RawCommandMemory:
+         total = file_raw_commands.capacity () * sizeof ( std::string );
+         
+         for ( unsigned long int i = 0; i < file_raw_commands.size (); i++ )
+         {
+            total += stringMemory ( file_raw_commands[ i ] );
+         }
+         break;
+      
+      case CommandMemory:
+         total = file_commands.capacity () * sizeof ( OpenCIF::Command* );
+         
+         for ( unsigned long int i = 0; i < file_commands.size (); i++ )
+         {
+            total += commandMemory ( file_commands[ i ] );
+         }
+         break;
+      
+      case CompactMemory:
+         total = file_compact_commands.memoryUsage ();
+         break;
+      
+      case MessageMemory:
+         total = file_messages.capacity () * sizeof ( std::string ) +
+                 file_error_spans.capacity () * sizeof ( std::pair< unsigned long int , unsigned long int > );
+         
+         for ( unsigned long int i = 0; i < file_messages.size (); i++ )
+         {
+            total += stringMemory ( file_messages[ i ] );
+         }
+         break;
+      
+      case LayerMemory:
+         total = file_layers.memoryUsage ();
+         break;
+   }
+   
+   return ( total );
+}
+
+/*
+ * This member function returns the vector of the raw (string) commands of the file.
+ */
+const std::vector< std::string >& OpenCIF::File::getRawCommands ( void ) const
+{
+   return ( file_raw_commands );
+}
+
+/*
+ * This member function takes as argument a command in string form. The command is "not clear". That means
+ * that is in the same way it was readed from the file.
+ * 
+ * The process of cleaning is to delete anything that is not intented to exist and leave only that things that can make
+ * the command easy to parse.
+ * 
+ * For example, from this: "P-100,10000thisisvalid-10000cuac,cuac,cuac,imaduck-20000yolo;"
+ * To this:                "P -100 10000 -10000 -20000 ;"
+ * 
+ * So, such kind of string can be used as an input stream to read easily.
+ * 
+ * There are some commands that I can't clean, like the comment or user expansion commands. Those commands are just returned.
+ * 
+ * At least, I can know what kind of command I'm working with by it's first char.
+ */
+std::string OpenCIF::File::cleanCommand ( std::string command )
+{
+   std::string final_command;
+   
+   switch ( command[ 0 ] )
+   {
+      // All of these commands can be processed as the same, since they only need values.
+      case 'P':
+      case 'B':
+      case 'W':
+      case 'R':
+         final_command = clearNumericCommand ( command );
+         break;
+         
+      case 'L': // Layer command
+         final_command = cleanLayerCommand ( command );
+         break;
+         
+      case 'C': // Call command
+         final_command = cleanCallCommand ( command );
+         break;
+         
+      case 'D': // Definition {Start|End|Delete} command.
+         final_command = cleanDefinitionCommand ( command );
+         break;
+         
+      case 'E': // End command.
+         final_command = "E ;";
+         break;
+         
+      default:
+         final_command = command.substr ( 0 , command.size () - 1 ) + " ;";
+         break;
+   }
+   
+   return ( final_command );
+}
+
+/*
+ * This member function takes as argument a string that, maybe, is a CIF command.
+ * 
+ * The operation done is similar to the one performed when loading a CIF file, but
+ * applied directly to a string. The idea is to validate a single string as a service
+ * for the user.
+ */
+bool OpenCIF::File::isCommandValid ( std::string command )
+{
+   /*
+    * The process of validation isn't that complex.
+    * 
+    * I need to create a CIFFSM class instance. Such instance will help me to validate
+    * the command contents. I'll read char by char and feed them to the CIFFSM instance.
+    * The CIFFSM instance will start, by default, in state 1.
+    * 
+    * I'll feed the instance characters until I reach the end of the command or the instance reports
+    * an error (jump state equal to -1). After feeding the characters, if I finish feeding the
+    * command and none error was reported, I will check the current state of the instance.
+    * 
+    * The instance should end in state 91 or 92. If the FSM is in such states, the command is 
+    * correct and the format is supported.
+    * 
+    * If there is a jump to a negative state, the command is invalid.
+    * 
+    * Also, I'm considering an invalid a string like this one:
+    * 
+    * this.is.an.invalid.string
+    * 
+    * Such string, according to the FSM used, is valid, since all of those characters are considered
+    * "Black characters", they are chars used to add spaces between commands.
+    * 
+    * So, what I'm considering a valid command? A string that *has* a valid command. If none valid
+    * command is found, then, even if the FSM says no invalid char is found, I'm going to return
+    * false, since a technically empty string doesn't count as a command.
+    */
+   
+   OpenCIF::CIFFSM fsm; // Cheap to create, the transitions are stored in a constant table.
+   
+   int jump_state = 1; // By default, start in 1
+   char input_char;
+   bool cif_command_found = false; // Flag to prevent validating strings that are, technically speaking, empty.
+   
+   // Iterate over the contents of the string, until the string end is
+   // reached or the FSM reports a problem.
+   
+   for ( unsigned int i = 0; i < command.size () && jump_state != -1; i++ )
+   {
+      input_char = command[ i ];
+      
+      jump_state = fsm[ input_char ];
+      
+      if ( jump_state > 1 )
+      {
+         cif_command_found = true;
+      }
+   }
+   
+   // String validated. What is the result?
+   if ( jump_state == -1 )
+   {      
+      return ( false );
+   }
+   
+   // A command not finished (without its semicolon, or a comment without its
+   // closing parentheses) is incomplete, so is considered invalid too.
+   if ( jump_state != 1 && jump_state != 91 && jump_state != 92 )
+   {
+      return ( false );
+   }
+   
+   // If no command found, is considered invalid
+   if ( !cif_command_found )
+   {
+      return ( false );
+   }
+   
+   // Everything Ok. The string is a valid according to the CIF format.
+   
+   return ( true );
+}
+
+/*
+ * This member function takes as argument a Definition command and returns it cleaned.
+ * 
+ * A definition command can be something like this:
+ * 
+ *      "DxxxxxSlol100im,totally,legal;"
+ * 
+ * So, the task of this member function is to turn it into like this:
+ * 
+ *      "D S 100 ;"
+ * 
+ * The process begins with the deletion of any non-digit and non-uppercase characters.
+ * Such operation, if good, can leave a command like this:
+ * 
+ *      "DS100;"
+ * 
+ * To simplify the process of converting commands into instances, the commands must have
+ * whitespaces to separate components (to use the strings as, for example, input streams).
+ * 
+ * So, the next process is to separate the components to turn the command into this:
+ * 
+ *      "D S 100 ;"
+ */
+std::string OpenCIF::File::cleanDefinitionCommand ( std::string command )
+{
+   std::string final_command;
+   std::string tmp = " ";
+            
+   // There are only uppercase chars and digits
+   final_command = command[ 0 ];
+   final_command += tmp;
+   
+   // Remove not-necessary characters
+   command[ 0 ] = ' ';
+   for ( unsigned int i = 0; i < command.size (); i++ )
+   {
+      // If the current char is not a 'D', not a digit, not an 'S' and not an 'F'
+      if ( !std::isdigit ( (unsigned char)command[ i ] ) && !std::isupper ( (unsigned char)command[ i ] ) )
+      {
+         command[ i ] = ' ';
+      }
+   }
+   
+   for ( unsigned int i = 1; i < command.size (); i++ )
+   {
+      if ( std::isdigit ( (unsigned char)command[ i ] ) )
+      {
+         final_command += command[ i ];
+      }
+      else if ( command[ i ] != ' ' )
+      {
+         final_command += command[ i ];
+         final_command += " ";
+      }
+      else if ( command[ i ] == ' ' && final_command[ final_command.size () - 1 ] != ' ' )
+      {
+         final_command += " ";
+      }
+   }
+   
+   ( final_command[ final_command.size () - 1 ] == ' ' )
+      ? final_command += ";"
+      : final_command += " ;";
+   
+   return ( final_command );
+}
+
+/*
+ * This member function takes as argument a call command and returns it cleaned.
+ * 
+ * A call command can be something like this:
+ * 
+ *      "C1T20000 -20000R1000000 -59999MXlololololololololMY MXMXMXMYMXR100 100R100 100;"
+ * 
+ * So, the task of this member function is to turn it into like this:
+ * 
+ *      "C 1 T 20000 -20000 R 1000000 -59999 M X M Y M X M X M X M Y M X R 100 100 R 100 100;"
+ * 
+ * The process begins with the deletion of any non-digit, non-dash ('-') and non-uppercase characters.
+ * Such operation, if good, can leave a command like this:
+ * 
+ *      "C 1 T 20000 -20000 R 1000000 -59999 MX MY MXMXMXMYMXR100 100R100 100;"
+ * 
+ * To simplify the process of converting commands into instances, the commands must have
+ * whitespaces to separate components (to use the strings as, for example, input streams).
+ * 
+ * So, the next process is to separate the components to turn the command into this:
+ * 
+ *      "C 1 T 20000 -20000 R 1000000 -59999 M X M Y M X M X M X M Y M X R 100 100 R 100 100;"
+ */
+std::string OpenCIF::File::cleanCallCommand ( std::string command )
+{
+   std::string final_command;
+   std::string tmp = " ";
+            
+   // There are only uppercase chars
+   final_command = command[ 0 ];
+   final_command += tmp;
+   
+   // Remove not-necessary characters
+   command[ 0 ] = ' ';
+   for ( unsigned int i = 0; i < command.size (); i++ )
+   {
+      if ( !std::isdigit ( (unsigned char)command[ i ] ) && !std::isupper ( (unsigned char)command[ i ] ) && command[ i ] != '-' )
+      {
+         command[ i ] = ' ';
+      }
+   }
+   
+   for ( unsigned int i = 1; i < command.size (); i++ )
+   {
+      tmp = command[ i ];
+      
+      if ( std::isdigit ( (unsigned char)command[ i ] ) )
+      {
+         final_command += tmp;
+      }
+      else if ( command[ i ] != ' ' )
+      {
+         if ( final_command[ final_command.size () - 1 ] != ' ' )
+         {
+            final_command += " ";
+         }
+         
+         final_command += tmp;
+         
+         if ( std::isupper ( (unsigned char)command[ i ] ) )
+         {
+            final_command += " ";
+         }
+      }
+      else if ( final_command[ final_command.size () - 1 ] != ' ' )
+      {
+         final_command += " ";
+      }
+   }
+   
+   ( final_command[ final_command.size () - 1 ] == ' ' )
+      ? final_command += ";"
+      : final_command += " ;";
+   
+   return ( final_command );
+}
+
+/*
+ * This member function takes as argument a Layer camand and removes any unnecesary character.
+ */
+std::string OpenCIF::File::cleanLayerCommand ( std::string command )
+{
+   std::string tmp = " ";
+   std::string final_command;
+            
+   final_command = command[ 0 ];
+   final_command += tmp;
+   
+   // Remove not-necessary characters
+   command[ 0 ] = ' ';
+   for ( unsigned int i = 0; i < command.size (); i++ )
+   {
+      if ( !std::isupper ( (unsigned char)command[ i ] ) && command[ i ] != '_' && ! std::isdigit ( (unsigned char)command[ i ] ) )
+      {
+         command[ i ] = ' ';
+      }
+   }
+   
+   std::istringstream iss ( command );
+   
+   while ( !iss.eof () )
+   {
+      iss >> tmp;
+      
+      if ( !iss.eof () )
+      {
+         final_command += tmp;
+         tmp = " ";
+         final_command += tmp;
+      }
+   }
+   
+   final_command += ";";
+            
+   return ( final_command );
+}
+
+/*
+ * This member function takes as argument a numeric command (like a Polygon or Box command)
+ * and cleans it.
+ * 
+ * A numeric command can be something like this:
+ * 
+ *      "W1000,muajajajajaja20000,,,this,is,valid20000twerking,so,hard,,,,,,xoxoxoxoxox-10000,-10000,-500 juar juar juarX-4000;"
+ * 
+ * So, the task of this member function is to turn it into like this:
+ * 
+ *      "W 1000 20000 20000 -10000 -10000 -500 -4000 ;"
+ * 
+ * The process begins with the deletion of any non-digit and non-dash ('-') characters.
+ * Such operation, if good, can leave a command like this:
+ * 
+ *      "W1000              20000                20000                                 -10000 -10000 -500                -4000;"
+ * 
+ * To simplify the process of converting commands into instances, the commands must have
+ * whitespaces to separate components (to use the strings as, for example, input streams).
+ * 
+ * So, the next process is to separate the components to turn the command into this:
+ * 
+ *      "W 1000 20000 20000 -10000 -10000 -500 -4000 ;"
+ */
+std::string OpenCIF::File::clearNumericCommand ( std::string command )
+{
+   std::string tmp = " ";
+   std::string final_command;
+            
+   // There are only numbers and guides ("-")
+   final_command = command[ 0 ];
+   final_command += tmp;
+   
+   // Remove not-necessary characters
+   for ( unsigned int i = 0; i < command.size (); i++ )
+   {
+      if ( !std::isdigit ( (unsigned char)command[ i ] ) && command[ i ] != '-' )
+      {
+         command[ i ] = ' ';
+      }
+   }
+   
+   std::istringstream iss ( command );
+   
+   while ( !iss.eof () )
+   {
+      iss >> tmp;
+      
+      if ( !iss.eof () )
+      {
+         final_command += tmp;
+         tmp = " ";
+         final_command += tmp;
+      }
+   }
+   
+   final_command += ";";
+   
+   return ( final_command );
+}
@@ -1,105 +1,184 @@
-/*
- * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
- * Form) file. The library also includes a finite state machine to validate
- * the contents, acording to the specifications found in the technical
- * report 2686, from february 11, 1980.
- * 
- * Copyright (C) 2014, Moises Chavez Martinez
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License as published by
- * the Free Software Foundation, either version 3 of the License, or
- * (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see <http://www.gnu.org/licenses/>.
- */ 
-
-# ifndef LIBOPENCIF_FILE_HH_
-# define LIBOPENCIF_FILE_HH_
-
-# include <iostream>
-# include <string>
-# include <vector>
-# include <fstream>
-# include <sstream>
-
-# include "../command/command.hh"
-# include "../finitestatemachine/ciffsm.hh"
-# include "../command/controlcommand/callcommand/callcommand.hh"
-# include "../command/controlcommand/definitiondeletecommand/definitiondeletecommand.hh"
-# include "../command/controlcommand/definitionendcommand/definitionendcommand.hh"
-# include "../command/controlcommand/definitionstartcommand/definitionstartcommand.hh"
-# include "../command/layercommand/layercommand.hh"
-# include "../command/primitivecommand/pathbasedcommand/polygoncommand/polygoncommand.hh"
-# include "../command/primitivecommand/pathbasedcommand/wirecommand/wirecommand.hh"
-# include "../command/primitivecommand/positionbasedcommand/roundflashcommand/roundflashcommand.hh"
-# include "../command/primitivecommand/positionbasedcommand/boxcommand/boxcommand.hh"
-# include "../command/rawcontentcommand/commentcommand/commentcommand.hh"
-# include "../command/rawcontentcommand/userextensioncommand/userextensioncommand.hh"
-# include "../command/controlcommand/endcommand/endcommand.hh"
-
-namespace OpenCIF
-{
-   class File
-   {
-      public:
-         enum LoadStatus
-         {
-            AllOk = 0 ,
-            CantOpenInputFile ,
-            IncompleteInputFile ,
-            IncorrectInputFile
-         };
-         
-         enum LoadMethod
-         {
-            StopOnError = 0 ,
-            ContinueOnError
-         };
-      
-      public:
-         explicit File ( void );
-         virtual ~File ( void );
-         void setPath ( const std::string& new_path );
-         std::string getPath ( void ) const;
-         
-         void setCommands ( const std::vector< OpenCIF::Command* >& new_commands );
-         std::vector< OpenCIF::Command* > getCommands ( void ) const;
-         void dropCommands ( void );
-         
-         LoadStatus loadFile ( const LoadMethod& load_method = StopOnError ); // Whole process of loading a CIF file, from opening the file
-                                                                              // to converting the commands into instances.
-         LoadStatus openFile ( void );
-         LoadStatus validateSyntax ( const LoadMethod& load_method = StopOnError );
-         void cleanCommands ( void );
-         void convertCommands ( void );
-         
-         std::vector< std::string > getMessages ( void );
-         
-         std::vector< std::string > getRawCommands ( void ) const;
-         
-         static std::string cleanCommand ( std::string command );
-         static bool isCommandValid ( std::string command );
-         
-      private:
-         static std::string clearNumericCommand ( std::string command );
-         static std::string cleanLayerCommand ( std::string command );
-         static std::string cleanCallCommand ( std::string command );
-         static std::string cleanDefinitionCommand ( std::string command );
-         
-      private:
-         std::string file_path;
-         std::ifstream file_input;
-         std::vector< OpenCIF::Command* > file_commands;
-         std::vector< std::string > file_raw_commands;
-         std::vector< std::string > file_messages;
-   };
-}
-
-# endif
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+# ifndef LIBOPENCIF_FILE_HH_
+# define LIBOPENCIF_FILE_HH_
+
+# include <iostream>
+# include <string>
+# include <vector>
+# include <fstream>
+# include <sstream>
+# include <memory>
+# include <utility>
+
+# include "../command/command.hh"
+# include "../command/commandarray/commandarray.hh"
+# include "../finitestatemachine/ciffsm.hh"
+# include "../layertable/layertable.hh"
+# include "../command/controlcommand/callcommand/callcommand.hh"
+# include "../command/controlcommand/definitiondeletecommand/definitiondeletecommand.hh"
+# include "../command/controlcommand/definitionendcommand/definitionendcommand.hh"
+# include "../command/controlcommand/definitionstartcommand/definitionstartcommand.hh"
+# include "../command/layercommand/layercommand.hh"
+# include "../command/primitivecommand/pathbasedcommand/polygoncommand/polygoncommand.hh"
+# include "../command/primitivecommand/pathbasedcommand/wirecommand/wirecommand.hh"
+# include "../command/primitivecommand/positionbasedcommand/roundflashcommand/roundflashcommand.hh"
+# include "../command/primitivecommand/positionbasedcommand/boxcommand/boxcommand.hh"
+# include "../command/rawcontentcommand/commentcommand/commentcommand.hh"
+# include "../command/rawcontentcommand/userextensioncommand/userextensioncommand.hh"
+# include "../command/controlcommand/endcommand/endcommand.hh"
+
+// Forward declarations
+namespace OpenCIF { class Design; class Expander; }
+
+namespace OpenCIF
+{
+   class File
+   {
+      public:
+         enum LoadStatus
+         {
+            AllOk = 0 ,
+            CantOpenInputFile ,
+            IncompleteInputFile ,
+            IncorrectInputFile
+         };
+         
+         enum LoadMethod
+         {
+            StopOnError = 0 ,
+            ContinueOnError
+         };
+         
+         /*
+          * What loadFile keeps once the file is loaded. Every policy keeps what the previous
+          * one keeps, and drops something more.
+          */
+         enum RetentionPolicy
+         {
+            KeepEverything = 0 , // The input file stays open, and the raw commands are kept.
+            CloseInput , // The input file is closed.
+            DropRawCommands , // The raw commands are dropped too, once converted.
+            KeepCompactOnly // The commands are moved to a CommandArray (see getCompactCommands).
+         };
+         
+         enum MemoryCategory
+         {
+            InputMemory = 0 , // The input stream and its buffer.
+            RawCommandMemory ,
+            CommandMemory ,
+            CompactMemory ,
+            MessageMemory ,
+            LayerMemory
+         };
+      
+      public:
+         explicit File ( void );
+         virtual ~File ( void );
+         void setPath ( const std::string& new_path );
+         std::string getPath ( void ) const;
+         void setRetentionPolicy ( const RetentionPolicy& new_retention_policy );
+         RetentionPolicy getRetentionPolicy ( void ) const;
+         
+         /*
+          * The File instance owns the commands it stores: they are deleted when the instance is
+          * destroyed, when the commands are converted again or when they are replaced using
+          * setCommands. The overloads that take raw pointers take the ownership of the new
+          * commands, and only delete the old ones that aren't in the new vector (so the vector
+          * returned by getCommands can be changed and set again). The overload that takes unique
+          * pointers deletes every old command. To take the ownership back, use releaseCommands
+          * (or dropCommands).
+          */
+         void setCommands ( const std::vector< OpenCIF::Command* >& new_commands );
+         void setCommands ( std::vector< OpenCIF::Command* >&& new_commands );
+         void setCommands ( std::vector< std::unique_ptr< OpenCIF::Command > >&& new_commands );
+         const std::vector< OpenCIF::Command* >& getCommands ( void ) const;
+         std::vector< std::unique_ptr< OpenCIF::Command > > releaseCommands ( void );
+         void dropCommands ( void );
+         
+         /*
+          * With the policy KeepCompactOnly, the commands are kept only as a CommandArray, and
+          * getCommands returns an empty vector until restoreCommands converts them back.
+          */
+         const OpenCIF::CommandArray& getCompactCommands ( void ) const;
+         void restoreCommands ( void );
+         
+         /*
+          * A design is an immutable copy of the loaded file that many threads can read at the
+          * same time. It takes the ownership of the commands, like releaseCommands.
+          */
+         std::shared_ptr< const OpenCIF::Design > createDesign ( void );
+         std::shared_ptr< const OpenCIF::Design > createDesign ( const OpenCIF::Expander& expander , const unsigned long int& thread_amount = 0 );
+         
+         LoadStatus loadFile ( const LoadMethod& load_method = StopOnError ); // Whole process of loading a CIF file, from opening the file
+                                                                              // to converting the commands into instances.
+         LoadStatus openFile ( void );
+         void closeFile ( void );
+         LoadStatus validateSyntax ( const LoadMethod& load_method = StopOnError );
+         LoadStatus validateSyntax ( std::istream& input , const LoadMethod& load_method = StopOnError );
+         void cleanCommands ( void );
+         LoadStatus checkCoordinates ( void );
+         void convertCommands ( void );
+         
+         const std::vector< std::string >& getMessages ( void ) const;
+         const std::vector< std::pair< unsigned long int , unsigned long int > >& getErrorSpans ( void ) const;
+         
+         const std::vector< std::string >& getRawCommands ( void ) const;
+         
+         const OpenCIF::LayerTable& getLayers ( void ) const;
+         
+         unsigned long int memoryUsage ( void ) const;
+         unsigned long int memoryUsage ( const MemoryCategory& category ) const;
+         
+         static std::string cleanCommand ( std::string command );
+         static bool isCommandValid ( std::string command );
+         static OpenCIF::Command* convertCommand ( const std::string& command );
+         static bool fitsCoordinates ( const std::string& command );
+         static unsigned long int commandMemory ( const OpenCIF::Command* command );
+         
+      private:
+         void deleteCommands ( void );
+         void deleteCommands ( const std::vector< OpenCIF::Command* >& kept_commands );
+         void applyRetentionPolicy ( void );
+         unsigned long int skipCommand ( std::istream& input , const std::string& command );
+         
+         static unsigned long int stringMemory ( const std::string& text );
+         static std::string clearNumericCommand ( std::string command );
+         static std::string cleanLayerCommand ( std::string command );
+         static std::string cleanCallCommand ( std::string command );
+         static std::string cleanDefinitionCommand ( std::string command );
+         
+      private:
+         std::string file_path;
+         std::ifstream file_input;
+         std::vector< OpenCIF::Command* > file_commands;
+         OpenCIF::CommandArray file_compact_commands;
+         std::vector< std::string > file_raw_commands;
+         std::vector< std::string > file_messages;
+         std::vector< std::pair< unsigned long int , unsigned long int > > file_error_spans; // Byte offsets of the spans skipped.
+         OpenCIF::LayerTable file_layers;
+         RetentionPolicy file_retention_policy;
+   };
+}
+
+# endif
@@ -0,0 +1,494 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "lazyfile.hh"
+
+namespace
+{
+   /*
+    * Function object to delete a vector of commands converted, and the
+    * commands. Used when the last shared pointer to a symbol is dropped.
+    */
+   struct CommandsDeleter
+   {
+      void operator() ( const std::vector< OpenCIF::Command* >* commands ) const
+      {
+         for ( unsigned long int i = 0; i < commands->size (); i++ )
+         {
+            delete ( *commands )[ i ];
+         }
+         
+         delete commands;
+      }
+   };
+   
+   /*
+    * Function to get the name given by a "9" user extension, or an empty
+    * string if the extension is another one.
+    */
+   std::string symbolName ( const std::string& content )
+   {
+      if ( content.size () < 2 || content[ 0 ] != '9' || ( content[ 1 ] != ' ' && content[ 1 ] != '\t' ) )
+      {
+         return ( std::string () );
+      }
+      
+      std::string::size_type first = content.find_first_not_of ( " \t" , 1 );
+      std::string::size_type last = content.find_last_not_of ( " \t" );
+      
+      return ( ( first == std::string::npos ) ? std::string () : content.substr ( first , last - first + 1 ) );
+   }
+}
+
+/*
+ * Index returned when a symbol is not found.
+ */
+const unsigned long int OpenCIF::LazyFile::NoSymbol = (unsigned long int)( -1 );
+
+/*
+ * Default constructor. No file loaded, and no limit for the cache.
+ */
+OpenCIF::LazyFile::LazyFile ( void )
+   : lazy_capacity ( 0 ) ,
+     lazy_file ( new OpenCIF::File () ) ,
+     lazy_entries ( 1 ) ,
+     lazy_converted ( 0 )
+{
+   lazy_entries[ 0 ].id = 0;
+   lazy_entries[ 0 ].size = 0;
+}
+
+/*
+ * Destructor. The commands converted are deleted by the shared pointers.
+ */
+OpenCIF::LazyFile::~LazyFile ( void )
+{
+}
+
+/*
+ * Member function to set the path to the file.
+ */
+void OpenCIF::LazyFile::setPath ( const std::string& new_path )
+{
+   lazy_path = new_path;
+   
+   return;
+}
+
+/*
+ * Member function to return the file path.
+ */
+std::string OpenCIF::LazyFile::getPath ( void ) const
+{
+   return ( lazy_path );
+}
+
+/*
+ * Member function to set the amount of commands kept converted in the cache.
+ * The symbols used least recently are dropped until the cache fits (the one
+ * used last is always kept). A capacity of 0 means no limit.
+ */
+void OpenCIF::LazyFile::setCapacity ( const unsigned long int& new_capacity )
+{
+   lazy_capacity = new_capacity;
+   evict ( ( lazy_recent.empty () ) ? NoSymbol : lazy_recent.front () );
+   
+   return;
+}
+
+/*
+ * Member function to return the amount of commands kept converted.
+ */
+unsigned long int OpenCIF::LazyFile::getCapacity ( void ) const
+{
+   return ( lazy_capacity );
+}
+
+/*
+ * Member function to load the input file: the commands are validated and
+ * cleaned, and the definitions are found, but no command is converted. The
+ * value returned has the same meaning it has in the File class.
+ */
+OpenCIF::File::LoadStatus OpenCIF::LazyFile::loadFile ( const OpenCIF::File::LoadMethod& load_method )
+{
+   OpenCIF::File::LoadStatus end_status;
+   
+   lazy_file.reset ( new OpenCIF::File () );
+   lazy_file->setPath ( lazy_path );
+   
+   lazy_entries.assign ( 1 , Entry () );
+   lazy_entries[ 0 ].id = 0;
+   lazy_entries[ 0 ].size = 0;
+   lazy_table.clear ();
+   lazy_names.clear ();
+   lazy_recent.clear ();
+   lazy_layers.clear ();
+   lazy_converted = 0;
+   
+   end_status = lazy_file->openFile ();
+   
+   if ( end_status != OpenCIF::File::AllOk )
+   {
+      return ( end_status );
+   }
+   
+   end_status = lazy_file->validateSyntax ( load_method );
+   lazy_file->cleanCommands ();
+   
+# ifdef LIBOPENCIF_COMPACT_COORDINATES
+   if ( end_status == OpenCIF::File::AllOk )
+   {
+      end_status = lazy_file->checkCoordinates ();
+   }
+# endif
+   
+   if ( end_status != OpenCIF::File::AllOk && load_method != OpenCIF::File::ContinueOnError )
+   {
+      return ( end_status );
+   }
+   
+   indexCommands ();
+   
+   return ( end_status );
+}
+
+/*
+ * Member function to find the definitions in the raw commands, and to fill
+ * the table of layers. Only the "DS", "DF", "DD", "L" and "9" commands are
+ * read.
+ */
+void OpenCIF::LazyFile::indexCommands ( void )
+{
+   const std::vector< std::string >& raw_commands = lazy_file->getRawCommands ();
+   Entry top;
+   unsigned long int current = NoSymbol;
+   unsigned long int top_begin = 0;
+   
+   top.id = 0;
+   top.size = 0;
+   lazy_entries.clear ();
+   
+   for ( unsigned long int i = 0; i < raw_commands.size (); i++ )
+   {
+      const std::string& raw_command = raw_commands[ i ];
+      
+      switch ( raw_command[ 0 ] )
+      {
+         case 'D':
+            if ( raw_command[ 2 ] == 'S' )
+            {
+               OpenCIF::DefinitionStartCommand start ( raw_command );
+               Entry symbol;
+               
+               if ( current != NoSymbol ) // A definition without end. Ends here.
+               {
+                  lazy_entries[ current ].ranges.push_back ( i );
+               }
+               else if ( top_begin < i )
+               {
+                  top.ranges.push_back ( top_begin );
+                  top.ranges.push_back ( i );
+               }
+               
+               symbol.id = start.getID ();
+               symbol.size = 0;
+               symbol.ranges.push_back ( i );
+               current = lazy_entries.size ();
+               lazy_entries.push_back ( symbol );
+            }
+            else if ( raw_command[ 2 ] == 'F' && current != NoSymbol )
+            {
+               lazy_entries[ current ].ranges.push_back ( i + 1 );
+               lazy_table[ lazy_entries[ current ].id ] = current;
+               
+               if ( !lazy_entries[ current ].name.empty () )
+               {
+                  lazy_names[ lazy_entries[ current ].name ] = current;
+               }
+               
+               current = NoSymbol;
+               top_begin = i + 1;
+            }
+            else if ( raw_command[ 2 ] == 'D' && current == NoSymbol )
+            {
+               OpenCIF::DefinitionDeleteCommand definition_delete ( raw_command );
+               
+               lazy_table.erase ( lazy_table.lower_bound ( definition_delete.getID () ) , lazy_table.end () );
+            }
+            break;
+         
+         case 'L':
+         {
+            OpenCIF::LayerCommand layer ( raw_command );
+            
+            lazy_layers.intern ( layer.getName () );
+            break;
+         }
+         
+         case '9':
+            if ( current != NoSymbol && lazy_entries[ current ].name.empty () )
+            {
+               OpenCIF::UserExtensionCommand extension ( raw_command );
+               
+               lazy_entries[ current ].name = symbolName ( extension.getContent () );
+            }
+            break;
+         
+         default:
+            break;
+      }
+   }
+   
+   if ( current != NoSymbol )
+   {
+      lazy_entries[ current ].ranges.push_back ( raw_commands.size () );
+   }
+   else if ( top_begin < raw_commands.size () )
+   {
+      top.ranges.push_back ( top_begin );
+      top.ranges.push_back ( raw_commands.size () );
+   }
+   
+   lazy_entries.push_back ( top );
+   
+   for ( unsigned long int i = 0; i < lazy_entries.size (); i++ )
+   {
+      Entry& entry = lazy_entries[ i ];
+      
+      for ( unsigned long int j = 0; j < entry.ranges.size (); j += 2 )
+      {
+         entry.size += entry.ranges[ j + 1 ] - entry.ranges[ j ];
+      }
+   }
+   
+   return;
+}
+
+/*
+ * Member function to return the messages generated during the load of the file.
+ */
+const std::vector< std::string >& OpenCIF::LazyFile::getMessages ( void ) const
+{
+   return ( lazy_file->getMessages () );
+}
+
+/*
+ * Member function to return the table of layers of the file. The IDs stored
+ * in the commands converted refer to this table.
+ */
+const OpenCIF::LayerTable& OpenCIF::LazyFile::getLayers ( void ) const
+{
+   return ( lazy_layers );
+}
+
+/*
+ * Member function to return the amount of symbols defined in the file.
+ */
+unsigned long int OpenCIF::LazyFile::getSymbolAmount ( void ) const
+{
+   return ( lazy_entries.size () - 1 );
+}
+
+/*
+ * Member function to return the ID of a symbol.
+ */
+unsigned long int OpenCIF::LazyFile::getID ( const unsigned long int& index ) const
+{
+   return ( lazy_entries[ index ].id );
+}
+
+/*
+ * Member function to return the name of a symbol (given by the "9" user
+ * extension), or an empty string.
+ */
+const std::string& OpenCIF::LazyFile::getName ( const unsigned long int& index ) const
+{
+   return ( lazy_entries[ index ].name );
+}
+
+/*
+ * Member function to find the symbol defined with an ID, after the last
+ * command (like the Hierarchy class does). Returns NoSymbol if it was never
+ * defined, or it was deleted.
+ */
+unsigned long int OpenCIF::LazyFile::findID ( const unsigned long int& id ) const
+{
+   std::map< unsigned long int , unsigned long int >::const_iterator found = lazy_table.find ( id );
+   
+   return ( ( found != lazy_table.end () ) ? found->second : NoSymbol );
+}
+
+/*
+ * Member function to find the last symbol defined with a name.
+ */
+unsigned long int OpenCIF::LazyFile::findName ( const std::string& name ) const
+{
+   std::map< std::string , unsigned long int >::const_iterator found = lazy_names.find ( name );
+   
+   return ( ( found != lazy_names.end () ) ? found->second : NoSymbol );
+}
+
+/*
+ * Member function to return the commands of a symbol, from the "DS" command
+ * to the "DF" command, converting them if they are not in the cache.
+ */
+std::shared_ptr< const std::vector< OpenCIF::Command* > > OpenCIF::LazyFile::getSymbol ( const unsigned long int& index )
+{
+   return ( getEntry ( index ) );
+}
+
+/*
+ * Member function to return the commands outside the definitions, converting
+ * them if they are not in the cache.
+ */
+std::shared_ptr< const std::vector< OpenCIF::Command* > > OpenCIF::LazyFile::getTop ( void )
+{
+   return ( getEntry ( lazy_entries.size () - 1 ) );
+}
+
+/*
+ * Member function to know if the commands of a symbol are in the cache. The
+ * index of the top is the amount of symbols.
+ */
+bool OpenCIF::LazyFile::isConverted ( const unsigned long int& index ) const
+{
+   return ( lazy_entries[ index ].commands != 0 );
+}
+
+/*
+ * Member function to return the amount of commands in the cache.
+ */
+unsigned long int OpenCIF::LazyFile::getConvertedCommands ( void ) const
+{
+   return ( lazy_converted );
+}
+
+/*
+ * Member function to drop every symbol from the cache. The commands returned
+ * before stay valid while they are kept by the caller.
+ */
+void OpenCIF::LazyFile::clearCache ( void )
+{
+   while ( !lazy_recent.empty () )
+   {
+      lazy_entries[ lazy_recent.back () ].commands.reset ();
+      lazy_recent.pop_back ();
+   }
+   
+   lazy_converted = 0;
+   
+   return;
+}
+
+/*
+ * Member function to return the commands of an entry. If they are in the
+ * cache, the entry becomes the one used last. If not, the commands are
+ * converted, with the same layer IDs the File class would give them.
+ */
+std::shared_ptr< const std::vector< OpenCIF::Command* > > OpenCIF::LazyFile::getEntry ( const unsigned long int& index )
+{
+   Entry& entry = lazy_entries[ index ];
+   
+   if ( entry.commands != 0 )
+   {
+      lazy_recent.splice ( lazy_recent.begin () , lazy_recent , entry.recent );
+      
+      return ( entry.commands );
+   }
+   
+   const std::vector< std::string >& raw_commands = lazy_file->getRawCommands ();
+   std::vector< OpenCIF::Command* >* commands = new std::vector< OpenCIF::Command* > ();
+   unsigned long int current_layer = OpenCIF::LayerTable::NoLayer;
+   unsigned long int outer_layer = OpenCIF::LayerTable::NoLayer;
+   
+   commands->reserve ( entry.size );
+   
+   for ( unsigned long int i = 0; i < entry.ranges.size (); i += 2 )
+   {
+      for ( unsigned long int j = entry.ranges[ i ]; j < entry.ranges[ i + 1 ]; j++ )
+      {
+         OpenCIF::Command* command = OpenCIF::File::convertCommand ( raw_commands[ j ] );
+         
+         switch ( command->type () )
+         {
+            case OpenCIF::Command::Box:
+            case OpenCIF::Command::Polygon:
+            case OpenCIF::Command::Wire:
+            case OpenCIF::Command::RoundFlash:
+               static_cast< OpenCIF::PrimitiveCommand* > ( command )->setLayerID ( current_layer );
+               break;
+            
+            case OpenCIF::Command::Layer:
+            {
+               OpenCIF::LayerCommand* layer = static_cast< OpenCIF::LayerCommand* > ( command );
+               
+               current_layer = lazy_layers.find ( layer->getName () );
+               layer->setID ( current_layer );
+               break;
+            }
+            
+            case OpenCIF::Command::DefinitionStart:
+               outer_layer = current_layer;
+               current_layer = OpenCIF::LayerTable::NoLayer;
+               break;
+            
+            case OpenCIF::Command::DefinitionEnd:
+               current_layer = outer_layer;
+               break;
+            
+            default:
+               break;
+         }
+         
+         commands->push_back ( command );
+      }
+   }
+   
+   entry.commands = std::shared_ptr< const std::vector< OpenCIF::Command* > > ( commands , CommandsDeleter () );
+   lazy_recent.push_front ( index );
+   entry.recent = lazy_recent.begin ();
+   lazy_converted += entry.size;
+   
+   evict ( index );
+   
+   return ( entry.commands );
+}
+
+/*
+ * Member function to drop the entries used least recently from the cache,
+ * until the amount of commands converted fits the capacity. The entry given
+ * is never dropped.
+ */
+void OpenCIF::LazyFile::evict ( const unsigned long int& kept )
+{
+   while ( lazy_capacity != 0 && lazy_converted > lazy_capacity && !lazy_recent.empty () && lazy_recent.back () != kept )
+   {
+      Entry& entry = lazy_entries[ lazy_recent.back () ];
+      
+      entry.commands.reset ();
+      lazy_converted -= entry.size;
+      lazy_recent.pop_back ();
+   }
+   
+   return;
+}
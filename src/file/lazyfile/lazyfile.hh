@@ -0,0 +1,123 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_LAZYFILE_HH_
+# define LIBOPENCIF_LAZYFILE_HH_
+
+# include <list>
+# include <map>
+# include <memory>
+# include <string>
+# include <vector>
+
+# include "../file.hh"
+# include "../../command/command.hh"
+# include "../../layertable/layertable.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class loads a CIF file without converting its commands up front.
+    * The load validates and cleans the commands (like the File class does),
+    * and only records where every definition ("DS" to "DF") starts and ends,
+    * the ID and name of every symbol and the table of layers. The commands of
+    * a symbol are converted into instances the first time the symbol is
+    * requested, so the time needed to show a few symbols doesn't depend on
+    * the size of the library.
+    *
+    * The symbols converted are kept in a cache, with a capacity given as an
+    * amount of commands. When the capacity is exceeded, the symbols used
+    * least recently are dropped (and converted again if requested later).
+    * The commands are returned through shared pointers, so a symbol dropped
+    * from the cache stays valid while the caller keeps it.
+    *
+    * The layer IDs are the same the File class would give, since the table
+    * of layers is filled when the file is loaded. The commands outside the
+    * definitions are converted (and cached) as one more symbol, the top.
+    *
+    * An instance of this class must not be used by several threads at the
+    * same time.
+    */
+   class LazyFile
+   {
+      public:
+         static const unsigned long int NoSymbol;
+      
+      public:
+         explicit LazyFile ( void );
+         virtual ~LazyFile ( void );
+         
+         void setPath ( const std::string& new_path );
+         std::string getPath ( void ) const;
+         void setCapacity ( const unsigned long int& new_capacity ); // Amount of commands kept converted (0 means no limit).
+         unsigned long int getCapacity ( void ) const;
+         
+         OpenCIF::File::LoadStatus loadFile ( const OpenCIF::File::LoadMethod& load_method = OpenCIF::File::StopOnError );
+         const std::vector< std::string >& getMessages ( void ) const;
+         const OpenCIF::LayerTable& getLayers ( void ) const;
+         
+         unsigned long int getSymbolAmount ( void ) const;
+         unsigned long int getID ( const unsigned long int& index ) const;
+         const std::string& getName ( const unsigned long int& index ) const;
+         unsigned long int findID ( const unsigned long int& id ) const;
+         unsigned long int findName ( const std::string& name ) const;
+         
+         std::shared_ptr< const std::vector< OpenCIF::Command* > > getSymbol ( const unsigned long int& index );
+         std::shared_ptr< const std::vector< OpenCIF::Command* > > getTop ( void );
+         bool isConverted ( const unsigned long int& index ) const;
+         unsigned long int getConvertedCommands ( void ) const;
+         void clearCache ( void );
+      
+      private:
+         /*
+          * A symbol (or the top), with the indexes of its raw commands and the
+          * commands converted, if they are in the cache.
+          */
+         struct Entry
+         {
+            unsigned long int id;
+            std::string name;
+            std::vector< unsigned long int > ranges; // Pairs of indexes: first raw command, and one past the last.
+            unsigned long int size;
+            std::shared_ptr< const std::vector< OpenCIF::Command* > > commands;
+            std::list< unsigned long int >::iterator recent;
+         };
+         
+         void indexCommands ( void );
+         std::shared_ptr< const std::vector< OpenCIF::Command* > > getEntry ( const unsigned long int& index );
+         void evict ( const unsigned long int& kept );
+      
+      private:
+         std::string lazy_path;
+         unsigned long int lazy_capacity;
+         std::unique_ptr< OpenCIF::File > lazy_file;
+         OpenCIF::LayerTable lazy_layers;
+         std::vector< Entry > lazy_entries; // The symbols, and the top as the last one.
+         std::map< unsigned long int , unsigned long int > lazy_table;
+         std::map< std::string , unsigned long int > lazy_names;
+         std::list< unsigned long int > lazy_recent; // Entries converted, the one used last first.
+         unsigned long int lazy_converted;
+   };
+}
+
+# endif
@@ -0,0 +1,646 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <cmath>
+# include <ctime>
+# include <fstream>
+# include <set>
+# include <sstream>
+
+# include "gdsiiwriter.hh"
+# include "../../command/controlcommand/callcommand/callcommand.hh"
+# include "../../command/primitivecommand/primitivecommand.hh"
+# include "../../command/primitivecommand/pathbasedcommand/wirecommand/wirecommand.hh"
+# include "../../geometry/boolean/boolean.hh"
+# include "../../geometry/transform/transform.hh"
+
+namespace
+{
+   /*
+    * Records of a GDSII stream: the record type in the high byte, and the
+    * type of its data in the low byte.
+    */
+   enum GDSIIRecord
+   {
+      Header = 0x0002 ,
+      BeginLibrary = 0x0102 ,
+      LibraryName = 0x0206 ,
+      Units = 0x0305 ,
+      EndLibrary = 0x0400 ,
+      BeginStructure = 0x0502 ,
+      StructureName = 0x0606 ,
+      EndStructure = 0x0700 ,
+      Boundary = 0x0800 ,
+      Path = 0x0900 ,
+      StructureReference = 0x0A00 ,
+      Layer = 0x0D02 ,
+      Datatype = 0x0E02 ,
+      Width = 0x0F03 ,
+      XY = 0x1003 ,
+      EndElement = 0x1100 ,
+      ReferenceName = 0x1206 ,
+      Transformation = 0x1A01 ,
+      Magnification = 0x1B05 ,
+      Angle = 0x1C05 ,
+      PathType = 0x2102
+   };
+   
+   // A record can't be longer than 65535 bytes, so a XY record keeps 8191 points.
+   const unsigned long int MaximumPoints = 8191;
+   const unsigned long int BufferSize = 1 << 20;
+   
+   /*
+    * Output of the writer. The records are stored in the buffer, and written
+    * to the stream when it's full.
+    */
+   struct GDSIIStream
+   {
+      std::ostream& output;
+      std::vector< char > buffer;
+      
+      explicit GDSIIStream ( std::ostream& new_output )
+         : output ( new_output )
+      {
+         buffer.reserve ( BufferSize );
+      }
+   };
+   
+   /*
+    * State of a single writing.
+    */
+   struct GDSIIContext
+   {
+      const std::vector< OpenCIF::Command* >& commands;
+      const OpenCIF::Expander& expander;
+      const std::map< unsigned long int , std::pair< unsigned int , unsigned int > >& layers;
+      std::vector< std::string > names;
+      
+      GDSIIContext ( const std::vector< OpenCIF::Command* >& new_commands , const OpenCIF::Expander& new_expander ,
+                     const std::map< unsigned long int , std::pair< unsigned int , unsigned int > >& new_layers )
+         : commands ( new_commands ) , expander ( new_expander ) , layers ( new_layers )
+      {
+      }
+   };
+   
+   void flush ( GDSIIStream& stream )
+   {
+      stream.output.write ( stream.buffer.data () , stream.buffer.size () );
+      stream.buffer.clear ();
+      
+      return;
+   }
+   
+   void put ( GDSIIStream& stream , const unsigned long long int& value , const int& bytes )
+   {
+      for ( int i = bytes - 1; i >= 0; i-- )
+      {
+         stream.buffer.push_back ( (char)( ( value >> ( 8 * i ) ) & 0xFF ) );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to start a record, given the size of its data.
+    */
+   void begin ( GDSIIStream& stream , const GDSIIRecord& record , const unsigned long int& size )
+   {
+      if ( stream.buffer.size () + size + 4 > BufferSize )
+      {
+         flush ( stream );
+      }
+      
+      put ( stream , size + 4 , 2 );
+      put ( stream , record , 2 );
+      
+      return;
+   }
+   
+   /*
+    * Function to convert a number to the 8-byte real of GDSII: sign bit, 7
+    * bits of exponent (a power of 16, with an excess of 64) and 56 bits of
+    * mantissa, with the point before them.
+    */
+   unsigned long long int toReal ( double value )
+   {
+      unsigned long long int sign = 0;
+      int exponent = 64;
+      
+      if ( value == 0 )
+      {
+         return ( 0 );
+      }
+      
+      if ( value < 0 )
+      {
+         sign = 1ULL << 63;
+         value = -value;
+      }
+      
+      while ( value >= 1 )
+      {
+         value /= 16;
+         exponent++;
+      }
+      
+      while ( value < 1.0 / 16 )
+      {
+         value *= 16;
+         exponent--;
+      }
+      
+      unsigned long long int mantissa = (unsigned long long int)( std::ldexp ( value , 56 ) + 0.5 );
+      
+      if ( mantissa >> 56 )
+      {
+         mantissa >>= 4;
+         exponent++;
+      }
+      
+      return ( sign | ( (unsigned long long int)( exponent ) << 56 ) | mantissa );
+   }
+   
+   void writeRecord ( GDSIIStream& stream , const GDSIIRecord& record )
+   {
+      begin ( stream , record , 0 );
+      
+      return;
+   }
+   
+   void writeShort ( GDSIIStream& stream , const GDSIIRecord& record , const unsigned int& value )
+   {
+      begin ( stream , record , 2 );
+      put ( stream , value , 2 );
+      
+      return;
+   }
+   
+   void writeReal ( GDSIIStream& stream , const GDSIIRecord& record , const double& value )
+   {
+      begin ( stream , record , 8 );
+      put ( stream , toReal ( value ) , 8 );
+      
+      return;
+   }
+   
+   /*
+    * Function to write a string. The strings are padded with a null char to
+    * an even length.
+    */
+   void writeString ( GDSIIStream& stream , const GDSIIRecord& record , const std::string& value )
+   {
+      begin ( stream , record , value.size () + ( value.size () % 2 ) );
+      stream.buffer.insert ( stream.buffer.end () , value.begin () , value.end () );
+      
+      if ( value.size () % 2 )
+      {
+         stream.buffer.push_back ( 0 );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to write the date of creation and modification of the library
+    * or a structure (both are the current time).
+    */
+   void writeDates ( GDSIIStream& stream , const GDSIIRecord& record )
+   {
+      std::time_t now = std::time ( NULL );
+      std::tm* local = std::localtime ( &now );
+      
+      begin ( stream , record , 24 );
+      
+      for ( int i = 0; i < 2; i++ )
+      {
+         put ( stream , local->tm_year + 1900 , 2 );
+         put ( stream , local->tm_mon + 1 , 2 );
+         put ( stream , local->tm_mday , 2 );
+         put ( stream , local->tm_hour , 2 );
+         put ( stream , local->tm_min , 2 );
+         put ( stream , local->tm_sec , 2 );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to write a list of points. A boundary repeats the first point
+    * at the end.
+    */
+   void writePoints ( GDSIIStream& stream , const std::vector< OpenCIF::Point >& points , const unsigned long int& first ,
+                      const unsigned long int& amount , const bool& closed )
+   {
+      begin ( stream , XY , ( amount + ( closed ? 1 : 0 ) ) * 8 );
+      
+      for ( unsigned long int i = first; i < first + amount; i++ )
+      {
+         put ( stream , (unsigned int)( points[ i ].getX () ) , 4 );
+         put ( stream , (unsigned int)( points[ i ].getY () ) , 4 );
+      }
+      
+      if ( closed )
+      {
+         put ( stream , (unsigned int)( points[ first ].getX () ) , 4 );
+         put ( stream , (unsigned int)( points[ first ].getY () ) , 4 );
+      }
+      
+      return;
+   }
+   
+   void writeLayer ( GDSIIStream& stream , const std::pair< unsigned int , unsigned int >& layer )
+   {
+      writeShort ( stream , Layer , layer.first );
+      writeShort ( stream , Datatype , layer.second );
+      
+      return;
+   }
+   
+   /*
+    * Function to write a shape as a boundary. If it has too many points, it's
+    * split into pieces that don't overlap.
+    */
+   void writeShape ( GDSIIStream& stream , const OpenCIF::Shape& shape , const std::pair< unsigned int , unsigned int >& layer )
+   {
+      const std::vector< OpenCIF::Point >& points = shape.getPoints ();
+      
+      if ( points.size () < 3 )
+      {
+         return;
+      }
+      
+      if ( points.size () >= MaximumPoints )
+      {
+         std::vector< OpenCIF::Shape > pieces = OpenCIF::Boolean ().merge ( std::vector< OpenCIF::Shape > ( 1 , shape ) );
+         
+         for ( unsigned long int i = 0; i < pieces.size (); i++ )
+         {
+            writeShape ( stream , pieces[ i ] , layer );
+         }
+         
+         return;
+      }
+      
+      writeRecord ( stream , Boundary );
+      writeLayer ( stream , layer );
+      writePoints ( stream , points , 0 , points.size () , true );
+      writeRecord ( stream , EndElement );
+      
+      return;
+   }
+   
+   /*
+    * Function to write a wire as a path. A long wire is split into paths
+    * that share their ends.
+    */
+   void writeWire ( GDSIIStream& stream , const OpenCIF::WireCommand& wire , const OpenCIF::Transform& scale , const OpenCIF::Expander& expander ,
+                    const std::pair< unsigned int , unsigned int >& layer )
+   {
+      std::vector< OpenCIF::Point > points;
+      unsigned int type = 0;
+      
+      points.reserve ( wire.getPointAmount () );
+      
+      for ( unsigned long int i = 0; i < wire.getPointAmount (); i++ )
+      {
+         points.push_back ( scale.apply ( wire.getPoint ( i ) ) );
+      }
+      
+      switch ( expander.getWireEnds () )
+      {
+         case OpenCIF::Expander::FlushEnds:
+            type = 0;
+            break;
+         
+         case OpenCIF::Expander::RoundEnds:
+            type = 1;
+            break;
+         
+         case OpenCIF::Expander::ExtendedEnds:
+            type = 2;
+            break;
+      }
+      
+      for ( unsigned long int first = 0; first + 1 < points.size (); first += MaximumPoints - 1 )
+      {
+         writeRecord ( stream , Path );
+         writeLayer ( stream , layer );
+         writeShort ( stream , PathType , type );
+         begin ( stream , Width , 4 );
+         put ( stream , (unsigned int)( std::lround ( wire.getWidth () * scale.getA () ) ) , 4 );
+         writePoints ( stream , points , first , std::min ( MaximumPoints , (unsigned long int)( points.size () - first ) ) , false );
+         writeRecord ( stream , EndElement );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to write a call as a structure reference. The transformation
+    * is split into the mirroring in Y (done first), the magnification, the
+    * rotation (in degrees, counterclockwise) and the displacement.
+    */
+   void writeReference ( GDSIIStream& stream , const std::string& name , const OpenCIF::Transform& transform )
+   {
+      const double pi = 3.14159265358979323846;
+      double determinant = transform.getA () * transform.getD () - transform.getB () * transform.getC ();
+      double magnification = std::sqrt ( std::fabs ( determinant ) );
+      double angle = std::atan2 ( transform.getC () , transform.getA () ) * 180 / pi;
+      bool mirrored = ( determinant < 0 );
+      std::vector< OpenCIF::Point > position ( 1 , OpenCIF::Point ( std::lround ( transform.getDX () ) , std::lround ( transform.getDY () ) ) );
+      
+      // Keep the multiples of 90 degrees exact.
+      if ( std::fabs ( angle - std::round ( angle ) ) < 1e-9 )
+      {
+         angle = std::round ( angle );
+      }
+      
+      if ( angle < 0 )
+      {
+         angle += 360;
+      }
+      
+      if ( std::fabs ( magnification - 1 ) < 1e-12 )
+      {
+         magnification = 1;
+      }
+      
+      writeRecord ( stream , StructureReference );
+      writeString ( stream , ReferenceName , name );
+      
+      if ( mirrored || magnification != 1 || angle != 0 )
+      {
+         writeShort ( stream , Transformation , mirrored ? 0x8000 : 0 );
+         
+         if ( magnification != 1 )
+         {
+            writeReal ( stream , Magnification , magnification );
+         }
+         
+         if ( angle != 0 )
+         {
+            writeReal ( stream , Angle , angle );
+         }
+      }
+      
+      writePoints ( stream , position , 0 , 1 , false );
+      writeRecord ( stream , EndElement );
+      
+      return;
+   }
+   
+   /*
+    * Function to write a symbol as a structure.
+    */
+   void writeStructure ( const GDSIIContext& context , GDSIIStream& stream , const OpenCIF::Symbol& symbol , const std::string& name )
+   {
+      const std::vector< unsigned long int >& primitives = symbol.getPrimitives ();
+      const std::vector< OpenCIF::Instance >& instances = symbol.getInstances ();
+      const OpenCIF::Transform& scale = symbol.getScale ();
+      std::vector< OpenCIF::Shape > shapes;
+      
+      writeDates ( stream , BeginStructure );
+      writeString ( stream , StructureName , name );
+      
+      for ( unsigned long int i = 0; i < primitives.size (); i++ )
+      {
+         OpenCIF::Command* command = context.commands[ primitives[ i ] ];
+         std::map< unsigned long int , std::pair< unsigned int , unsigned int > >::const_iterator layer =
+            context.layers.find ( static_cast< OpenCIF::PrimitiveCommand* > ( command )->getLayerID () );
+         
+         if ( layer == context.layers.end () )
+         {
+            continue;
+         }
+         
+         if ( command->type () == OpenCIF::Command::Wire && static_cast< OpenCIF::WireCommand* > ( command )->getPointAmount () > 1 )
+         {
+            writeWire ( stream , *static_cast< OpenCIF::WireCommand* > ( command ) , scale , context.expander , layer->second );
+            continue;
+         }
+         
+         shapes.clear ();
+         context.expander.expand ( command , shapes );
+         
+         for ( unsigned long int j = 0; j < shapes.size (); j++ )
+         {
+            writeShape ( stream , scale.isIdentity () ? shapes[ j ] : scale.apply ( shapes[ j ] ) , layer->second );
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < instances.size (); i++ )
+      {
+         const OpenCIF::CallCommand* call = static_cast< OpenCIF::CallCommand* > ( context.commands[ instances[ i ].getCommand () ] );
+         
+         // The scale of the called symbol is already applied to its structure,
+         // but the call is in the units of this symbol, so its scale applies
+         // to the reference like to the shapes.
+         writeReference ( stream , context.names[ instances[ i ].getSymbol () ] ,
+                          scale.isIdentity () ? call->getTransform () : scale * call->getTransform () );
+      }
+      
+      writeRecord ( stream , EndStructure );
+      
+      return;
+   }
+   
+   /*
+    * Function to return a name that isn't used yet, adding a number to it if
+    * it's needed.
+    */
+   std::string uniqueName ( const std::string& name , std::set< std::string >& used )
+   {
+      std::string result = name;
+      
+      for ( unsigned long int i = 1; used.count ( result ) > 0; i++ )
+      {
+         std::ostringstream numbered;
+         
+         numbered << name << "_" << i;
+         result = numbered.str ();
+      }
+      
+      used.insert ( result );
+      
+      return ( result );
+   }
+}
+
+/*
+ * Default constructor. No layers are mapped, the library is named
+ * "LIBOPENCIF", and the top structure "TOP".
+ */
+OpenCIF::GDSIIWriter::GDSIIWriter ( void )
+   : writer_library_name ( "LIBOPENCIF" ) , writer_top_name ( "TOP" )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::GDSIIWriter::~GDSIIWriter ( void )
+{
+}
+
+void OpenCIF::GDSIIWriter::setLibraryName ( const std::string& new_library_name )
+{
+   writer_library_name = new_library_name;
+   
+   return;
+}
+
+void OpenCIF::GDSIIWriter::setTopName ( const std::string& new_top_name )
+{
+   writer_top_name = new_top_name;
+   
+   return;
+}
+
+void OpenCIF::GDSIIWriter::setExpander ( const OpenCIF::Expander& new_expander )
+{
+   writer_expander = new_expander;
+   
+   return;
+}
+
+/*
+ * Member function to give the GDSII layer and datatype of a layer of the
+ * file.
+ */
+void OpenCIF::GDSIIWriter::mapLayer ( const unsigned long int& layer_id , const unsigned int& gdsii_layer , const unsigned int& gdsii_datatype )
+{
+   writer_layers[ layer_id ] = std::make_pair ( gdsii_layer , gdsii_datatype );
+   
+   return;
+}
+
+void OpenCIF::GDSIIWriter::clearLayers ( void )
+{
+   writer_layers.clear ();
+   
+   return;
+}
+
+const std::string& OpenCIF::GDSIIWriter::getLibraryName ( void ) const
+{
+   return ( writer_library_name );
+}
+
+const std::string& OpenCIF::GDSIIWriter::getTopName ( void ) const
+{
+   return ( writer_top_name );
+}
+
+const OpenCIF::Expander& OpenCIF::GDSIIWriter::getExpander ( void ) const
+{
+   return ( writer_expander );
+}
+
+bool OpenCIF::GDSIIWriter::isMapped ( const unsigned long int& layer_id ) const
+{
+   return ( writer_layers.count ( layer_id ) > 0 );
+}
+
+/*
+ * Member function to write a list of commands to a file.
+ */
+bool OpenCIF::GDSIIWriter::write ( const std::vector< OpenCIF::Command* >& commands , const std::string& path ) const
+{
+   return ( write ( commands , OpenCIF::Hierarchy ( commands ) , path ) );
+}
+
+/*
+ * Member function to write a list of commands to a file, using a hierarchy
+ * already built for them.
+ */
+bool OpenCIF::GDSIIWriter::write ( const std::vector< OpenCIF::Command* >& commands , const OpenCIF::Hierarchy& hierarchy ,
+                                   const std::string& path ) const
+{
+   std::ofstream output ( path.c_str () , std::ios::binary );
+   
+   if ( !output.is_open () )
+   {
+      return ( false );
+   }
+   
+   return ( write ( commands , hierarchy , output ) );
+}
+
+/*
+ * Member function to write a list of commands to a stream. The structures
+ * of the symbols are written before the structures that reference them.
+ * Returns false if the stream fails.
+ */
+bool OpenCIF::GDSIIWriter::write ( const std::vector< OpenCIF::Command* >& commands , const OpenCIF::Hierarchy& hierarchy ,
+                                   std::ostream& output ) const
+{
+   GDSIIContext context ( commands , writer_expander , writer_layers );
+   GDSIIStream stream ( output );
+   std::vector< unsigned long int > order = hierarchy.getOrder ();
+   std::set< std::string > used;
+   const OpenCIF::Symbol& top = hierarchy.getTop ();
+   
+   context.names.resize ( hierarchy.getSymbolAmount () );
+   
+   for ( unsigned long int i = 0; i < hierarchy.getSymbolAmount (); i++ )
+   {
+      const OpenCIF::Symbol& symbol = hierarchy.getSymbol ( i );
+      std::ostringstream name;
+      
+      if ( symbol.getName ().empty () )
+      {
+         name << "SYMBOL_" << symbol.getID ();
+      }
+      else
+      {
+         name << symbol.getName ();
+      }
+      
+      context.names[ i ] = uniqueName ( name.str () , used );
+   }
+   
+   writeShort ( stream , Header , 600 );
+   writeDates ( stream , BeginLibrary );
+   writeString ( stream , LibraryName , writer_library_name );
+   
+   // A database unit is 0.01 micrometers (0.01 user units, 1e-8 meters).
+   begin ( stream , Units , 16 );
+   put ( stream , toReal ( 0.01 ) , 8 );
+   put ( stream , toReal ( 1e-8 ) , 8 );
+   
+   for ( unsigned long int i = 0; i < order.size (); i++ )
+   {
+      writeStructure ( context , stream , hierarchy.getSymbol ( order[ i ] ) , context.names[ order[ i ] ] );
+   }
+   
+   if ( !top.getPrimitives ().empty () || !top.getInstances ().empty () )
+   {
+      writeStructure ( context , stream , top , uniqueName ( writer_top_name , used ) );
+   }
+   
+   writeRecord ( stream , EndLibrary );
+   flush ( stream );
+   output.flush ();
+   
+   return ( output.good () );
+}
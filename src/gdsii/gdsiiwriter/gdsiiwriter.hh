@@ -0,0 +1,92 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_GDSIIWRITER_HH_
+# define LIBOPENCIF_GDSIIWRITER_HH_
+
+# include <iostream>
+# include <map>
+# include <string>
+# include <utility>
+# include <vector>
+
+# include "../../command/command.hh"
+# include "../../geometry/expander/expander.hh"
+# include "../../hierarchy/hierarchy/hierarchy.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class writes a list of commands as a GDSII stream file, keeping the
+    * hierarchy (nothing is flattened):
+    *
+    * - Every symbol becomes a structure, named using the "9" user extension
+    *   ("SYMBOL_<ID>" if it has no name). The commands outside the
+    *   definitions become the top structure.
+    * - Every call becomes a structure reference (SREF), with the mirroring,
+    *   the rotation and the displacement of its transformations.
+    * - Boxes, polygons and round flashes become boundaries. Rotated boxes and
+    *   round flashes are converted using the expander. A polygon with more
+    *   points than a boundary can keep is split into trapezoids by the
+    *   Boolean class (the points where the slanted sides are cut are rounded).
+    * - Wires become paths, with the style of ends of the expander. A wire
+    *   with too many points is split into paths that share their ends.
+    *
+    * The scale of a definition (A/B) is applied to the elements of its
+    * structure, so the references don't need a magnification. The database
+    * unit is the unit of CIF (0.01 micrometers), and the user unit is the
+    * micrometer.
+    *
+    * The layers are given by a table from the IDs of the layer table of the
+    * file to the GDSII layer and datatype. The shapes of layers without an
+    * entry are not written. The stream is written through a big buffer.
+    */
+   class GDSIIWriter
+   {
+      public:
+         explicit GDSIIWriter ( void );
+         virtual ~GDSIIWriter ( void );
+         
+         void setLibraryName ( const std::string& new_library_name );
+         void setTopName ( const std::string& new_top_name );
+         void setExpander ( const OpenCIF::Expander& new_expander );
+         void mapLayer ( const unsigned long int& layer_id , const unsigned int& gdsii_layer , const unsigned int& gdsii_datatype = 0 );
+         void clearLayers ( void );
+         const std::string& getLibraryName ( void ) const;
+         const std::string& getTopName ( void ) const;
+         const OpenCIF::Expander& getExpander ( void ) const;
+         bool isMapped ( const unsigned long int& layer_id ) const;
+         
+         bool write ( const std::vector< OpenCIF::Command* >& commands , const std::string& path ) const;
+         bool write ( const std::vector< OpenCIF::Command* >& commands , const OpenCIF::Hierarchy& hierarchy , const std::string& path ) const;
+         bool write ( const std::vector< OpenCIF::Command* >& commands , const OpenCIF::Hierarchy& hierarchy , std::ostream& output ) const;
+      
+      private:
+         std::string writer_library_name;
+         std::string writer_top_name;
+         OpenCIF::Expander writer_expander;
+         std::map< unsigned long int , std::pair< unsigned int , unsigned int > > writer_layers;
+   };
+}
+
+# endif
@@ -0,0 +1,672 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <cmath>
+# include <algorithm>
+# include <map>
+# include <iterator>
+# include <utility>
+
+# include "boolean.hh"
+
+namespace
+{
+   /*
+    * Edge of a shape, stored from bottom to top. The direction is +1 if the
+    * edge goes up in the shape (taken counter-clockwise), and -1 if it goes
+    * down. Horizontal edges are not needed by the scanline.
+    */
+   struct BooleanEdge
+   {
+      long int x0 , y0 , x1 , y1;
+      int direction;
+      int set;
+   };
+   
+   /*
+    * Part of a slab covered by the result, between two edges.
+    */
+   struct BooleanInterval
+   {
+      unsigned long int left;
+      unsigned long int right;
+   };
+   
+   /*
+    * Part of the result that is still growing up, slab after slab, since it
+    * has the same sides.
+    */
+   struct BooleanOpen
+   {
+      std::pair< long int , long int > key;
+      unsigned long int left;
+      unsigned long int right;
+      double bottom;
+   };
+   
+   /*
+    * Result of a band.
+    */
+   struct BooleanBand
+   {
+      std::vector< OpenCIF::Rectangle > rectangles;
+      std::vector< std::vector< OpenCIF::Point > > trapezoids;
+   };
+   
+   double xAt ( const BooleanEdge& edge , const double& y )
+   {
+      if ( edge.x0 == edge.x1 )
+      {
+         return ( edge.x0 );
+      }
+      
+      return ( edge.x0 + (double)( edge.x1 - edge.x0 ) * ( y - edge.y0 ) / (double)( edge.y1 - edge.y0 ) );
+   }
+   
+   double slope ( const BooleanEdge& edge )
+   {
+      return ( (double)( edge.x1 - edge.x0 ) / (double)( edge.y1 - edge.y0 ) );
+   }
+   
+   bool isInside ( const OpenCIF::Boolean::Operation& operation , const bool& first , const bool& second )
+   {
+      switch ( operation )
+      {
+         case OpenCIF::Boolean::Union:
+            return ( first || second );
+         
+         case OpenCIF::Boolean::Intersection:
+            return ( first && second );
+         
+         case OpenCIF::Boolean::Difference:
+            return ( first && !second );
+         
+         case OpenCIF::Boolean::ExclusiveOr:
+            return ( first != second );
+      }
+      
+      return ( false );
+   }
+   
+   void addEdges ( const std::vector< OpenCIF::Shape >& shapes , const int& set , std::vector< BooleanEdge >& edges )
+   {
+      for ( unsigned long int i = 0; i < shapes.size (); i++ )
+      {
+         const std::vector< OpenCIF::Point >& points = shapes[ i ].getPoints ();
+         long long int twice_area = 0;
+         
+         for ( unsigned long int j = 0; j < points.size (); j++ )
+         {
+            const OpenCIF::Point& current = points[ j ];
+            const OpenCIF::Point& next = points[ ( j + 1 ) % points.size () ];
+            
+            twice_area += (long long int)( current.getX () ) * next.getY () - (long long int)( next.getX () ) * current.getY ();
+         }
+         
+         // Every shape adds 1 to the winding number inside it, whatever its
+         // orientation (a mirrored shape is clockwise, and it would cancel
+         // the counter-clockwise shapes it overlaps).
+         int orientation = ( twice_area < 0 ? -1 : 1 );
+         
+         for ( unsigned long int j = 0; j < points.size (); j++ )
+         {
+            const OpenCIF::Point& start = points[ j ];
+            const OpenCIF::Point& end = points[ ( j + 1 ) % points.size () ];
+            BooleanEdge edge;
+            
+            if ( start.getY () == end.getY () )
+            {
+               continue;
+            }
+            
+            if ( start.getY () < end.getY () )
+            {
+               edge.x0 = start.getX ();
+               edge.y0 = start.getY ();
+               edge.x1 = end.getX ();
+               edge.y1 = end.getY ();
+               edge.direction = orientation;
+            }
+            else
+            {
+               edge.x0 = end.getX ();
+               edge.y0 = end.getY ();
+               edge.x1 = start.getX ();
+               edge.y1 = start.getY ();
+               edge.direction = -orientation;
+            }
+            
+            edge.set = set;
+            edges.push_back ( edge );
+         }
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to close a part of the result at the given height.
+    */
+   void closeOpen ( const std::vector< BooleanEdge >& edges , const BooleanOpen& open , const double& top , const bool& manhattan , BooleanBand& band )
+   {
+      if ( manhattan )
+      {
+         band.rectangles.push_back ( OpenCIF::Rectangle ( open.key.first , std::lround ( open.bottom ) , open.key.second , std::lround ( top ) ) );
+         
+         return;
+      }
+      
+      const BooleanEdge& left = edges[ open.left ];
+      const BooleanEdge& right = edges[ open.right ];
+      OpenCIF::Point corners[ 4 ] =
+      {
+         OpenCIF::Point ( std::lround ( xAt ( left , open.bottom ) ) , std::lround ( open.bottom ) ) ,
+         OpenCIF::Point ( std::lround ( xAt ( right , open.bottom ) ) , std::lround ( open.bottom ) ) ,
+         OpenCIF::Point ( std::lround ( xAt ( right , top ) ) , std::lround ( top ) ) ,
+         OpenCIF::Point ( std::lround ( xAt ( left , top ) ) , std::lround ( top ) )
+      };
+      std::vector< OpenCIF::Point > points;
+      
+      // The rounding can join corners (or the trapezoid can be a triangle).
+      for ( unsigned int i = 0; i < 4; i++ )
+      {
+         if ( points.empty () || corners[ i ].getX () != points.back ().getX () || corners[ i ].getY () != points.back ().getY () )
+         {
+            points.push_back ( corners[ i ] );
+         }
+      }
+      
+      if ( points.size () > 1 && points.front ().getX () == points.back ().getX () && points.front ().getY () == points.back ().getY () )
+      {
+         points.pop_back ();
+      }
+      
+      if ( points.size () >= 3 && corners[ 0 ].getY () != corners[ 3 ].getY () )
+      {
+         band.trapezoids.push_back ( points );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to return the height of the first crossing of two edges between
+    * "bottom" and "top" (or "top" if there isn't). The first crossing is
+    * always between two edges that are neighbors at the bottom.
+    */
+   double firstCrossing ( const std::vector< BooleanEdge >& edges , std::vector< unsigned long int >& active , const double& bottom , const double& top )
+   {
+      double crossing = top;
+      
+      std::sort ( active.begin () , active.end () , [ & ] ( unsigned long int a , unsigned long int b )
+      {
+         double xa = xAt ( edges[ a ] , bottom ) , xb = xAt ( edges[ b ] , bottom );
+         
+         return ( xa < xb || ( xa == xb && slope ( edges[ a ] ) < slope ( edges[ b ] ) ) );
+      } );
+      
+      for ( unsigned long int i = 0; i + 1 < active.size (); i++ )
+      {
+         const BooleanEdge& a = edges[ active[ i ] ];
+         const BooleanEdge& b = edges[ active[ i + 1 ] ];
+         
+         if ( xAt ( a , top ) <= xAt ( b , top ) + 1e-9 )
+         {
+            continue;
+         }
+         
+         double difference = slope ( a ) - slope ( b );
+         
+         if ( difference <= 0 )
+         {
+            continue;
+         }
+         
+         double height = bottom + ( xAt ( b , bottom ) - xAt ( a , bottom ) ) / difference;
+         
+         if ( height > bottom && height < crossing )
+         {
+            crossing = height;
+         }
+      }
+      
+      return ( crossing );
+   }
+   
+   /*
+    * Function to compute the result inside a band, from "bottom" to "top".
+    */
+   void sweepBand ( const std::vector< BooleanEdge >& edges , std::vector< unsigned long int >& indexes , const long int& bottom , const long int& top ,
+                    const OpenCIF::Boolean::Operation& operation , const bool& manhattan , BooleanBand& band )
+   {
+      std::vector< long int > events;
+      std::vector< unsigned long int > active;
+      std::vector< BooleanInterval > intervals;
+      std::vector< BooleanOpen > open , still_open;
+      unsigned long int next_edge = 0;
+      
+      events.reserve ( indexes.size () * 2 + 2 );
+      events.push_back ( bottom );
+      events.push_back ( top );
+      
+      for ( unsigned long int i = 0; i < indexes.size (); i++ )
+      {
+         const BooleanEdge& edge = edges[ indexes[ i ] ];
+         
+         if ( edge.y0 > bottom && edge.y0 < top )
+         {
+            events.push_back ( edge.y0 );
+         }
+         
+         if ( edge.y1 > bottom && edge.y1 < top )
+         {
+            events.push_back ( edge.y1 );
+         }
+      }
+      
+      std::sort ( events.begin () , events.end () );
+      events.erase ( std::unique ( events.begin () , events.end () ) , events.end () );
+      
+      std::sort ( indexes.begin () , indexes.end () , [ & ] ( unsigned long int a , unsigned long int b )
+      {
+         return ( edges[ a ].y0 < edges[ b ].y0 );
+      } );
+      
+      for ( unsigned long int k = 0; k + 1 < events.size (); k++ )
+      {
+         double slab_bottom = events[ k ];
+         
+         unsigned long int old_amount = active.size ();
+         
+         while ( next_edge < indexes.size () && edges[ indexes[ next_edge ] ].y0 <= events[ k ] )
+         {
+            active.push_back ( indexes[ next_edge ] );
+            next_edge++;
+         }
+         
+         // The edges of Manhattan shapes are vertical, so the active edges are kept sorted merging the new ones.
+         if ( manhattan )
+         {
+            std::sort ( active.begin () + old_amount , active.end () , [ & ] ( unsigned long int a , unsigned long int b ) { return ( edges[ a ].x0 < edges[ b ].x0 ); } );
+            std::inplace_merge ( active.begin () , active.begin () + old_amount , active.end () , [ & ] ( unsigned long int a , unsigned long int b ) { return ( edges[ a ].x0 < edges[ b ].x0 ); } );
+         }
+         
+         active.erase ( std::remove_if ( active.begin () , active.end () , [ & ] ( unsigned long int a ) { return ( edges[ a ].y1 <= events[ k ] ); } ) , active.end () );
+         
+         while ( slab_bottom < events[ k + 1 ] )
+         {
+            double slab_top = manhattan ? events[ k + 1 ] : firstCrossing ( edges , active , slab_bottom , events[ k + 1 ] );
+            double middle = ( slab_bottom + slab_top ) / 2.0;
+            int winding[ 2 ] = { 0 , 0 };
+            bool inside = false;
+            unsigned long int start = 0;
+            
+            if ( !manhattan )
+            {
+               std::sort ( active.begin () , active.end () , [ & ] ( unsigned long int a , unsigned long int b )
+               {
+                  return ( xAt ( edges[ a ] , middle ) < xAt ( edges[ b ] , middle ) );
+               } );
+            }
+            
+            intervals.clear ();
+            
+            for ( unsigned long int i = 0; i < active.size (); i++ )
+            {
+               const BooleanEdge& edge = edges[ active[ i ] ];
+               
+               winding[ edge.set ] += edge.direction;
+               
+               bool now_inside = isInside ( operation , winding[ 0 ] != 0 , winding[ 1 ] != 0 );
+               
+               if ( !inside && now_inside )
+               {
+                  start = active[ i ];
+               }
+               else if ( inside && !now_inside )
+               {
+                  BooleanInterval interval = { start , active[ i ] };
+                  
+                  // Join the intervals that touch (shapes side by side).
+                  if ( !intervals.empty () &&
+                       std::fabs ( xAt ( edges[ intervals.back ().right ] , slab_bottom ) - xAt ( edges[ start ] , slab_bottom ) ) < 1e-9 &&
+                       std::fabs ( xAt ( edges[ intervals.back ().right ] , slab_top ) - xAt ( edges[ start ] , slab_top ) ) < 1e-9 )
+                  {
+                     intervals.back ().right = active[ i ];
+                  }
+                  else if ( std::fabs ( xAt ( edges[ start ] , middle ) - xAt ( edge , middle ) ) > 1e-9 )
+                  {
+                     intervals.push_back ( interval );
+                  }
+               }
+               
+               inside = now_inside;
+            }
+            
+            // Continue the parts with the same sides, close the others and open the new ones.
+            std::vector< BooleanOpen > current ( intervals.size () );
+            
+            for ( unsigned long int i = 0; i < intervals.size (); i++ )
+            {
+               current[ i ].left = intervals[ i ].left;
+               current[ i ].right = intervals[ i ].right;
+               current[ i ].bottom = slab_bottom;
+               
+               if ( manhattan )
+               {
+                  current[ i ].key = std::make_pair ( edges[ intervals[ i ].left ].x0 , edges[ intervals[ i ].right ].x0 );
+               }
+               else
+               {
+                  current[ i ].key = std::make_pair ( (long int)( intervals[ i ].left ) , (long int)( intervals[ i ].right ) );
+               }
+            }
+            
+            // The intervals of Manhattan shapes are already sorted by their sides.
+            if ( !manhattan )
+            {
+               std::sort ( current.begin () , current.end () , [] ( const BooleanOpen& a , const BooleanOpen& b ) { return ( a.key < b.key ); } );
+            }
+            still_open.clear ();
+            
+            unsigned long int i = 0 , j = 0;
+            
+            while ( i < open.size () || j < current.size () )
+            {
+               if ( j == current.size () || ( i < open.size () && open[ i ].key < current[ j ].key ) )
+               {
+                  closeOpen ( edges , open[ i ] , slab_bottom , manhattan , band );
+                  i++;
+               }
+               else if ( i == open.size () || current[ j ].key < open[ i ].key )
+               {
+                  still_open.push_back ( current[ j ] );
+                  j++;
+               }
+               else
+               {
+                  still_open.push_back ( open[ i ] );
+                  i++;
+                  j++;
+               }
+            }
+            
+            open.swap ( still_open );
+            slab_bottom = slab_top;
+         }
+      }
+      
+      for ( unsigned long int i = 0; i < open.size (); i++ )
+      {
+         closeOpen ( edges , open[ i ] , top , manhattan , band );
+      }
+      
+      return;
+   }
+}
+
+/*
+ * Default constructor. One thread per core is used.
+ */
+OpenCIF::Boolean::Boolean ( void )
+   : boolean_thread_amount ( 0 )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Boolean::~Boolean ( void )
+{
+}
+
+/*
+ * Member function to set the amount of threads used. If it's 0, one thread
+ * per core is used.
+ */
+void OpenCIF::Boolean::setThreadAmount ( const unsigned long int& new_thread_amount )
+{
+   boolean_thread_amount = new_thread_amount;
+   
+   return;
+}
+
+unsigned long int OpenCIF::Boolean::getThreadAmount ( void ) const
+{
+   return ( boolean_thread_amount );
+}
+
+/*
+ * Member function to compute "first operation second", using a new pool of
+ * threads. The shapes of the result are in the given layer.
+ */
+std::vector< OpenCIF::Shape > OpenCIF::Boolean::compute ( const std::vector< OpenCIF::Shape >& first , const Operation& operation ,
+                                                          const std::vector< OpenCIF::Shape >& second , const unsigned long int& layer_id ) const
+{
+   OpenCIF::ThreadPool pool ( boolean_thread_amount );
+   
+   return ( compute ( first , operation , second , layer_id , pool ) );
+}
+
+/*
+ * Member function to compute "first operation second", using the given pool
+ * of threads. The shapes of the result are in the given layer.
+ */
+std::vector< OpenCIF::Shape > OpenCIF::Boolean::compute ( const std::vector< OpenCIF::Shape >& first , const Operation& operation ,
+                                                          const std::vector< OpenCIF::Shape >& second , const unsigned long int& layer_id ,
+                                                          OpenCIF::ThreadPool& pool ) const
+{
+   std::vector< BooleanEdge > edges;
+   std::vector< long int > heights;
+   std::vector< long int > limits;
+   bool manhattan = true;
+   
+   for ( unsigned long int i = 0; i < first.size () && manhattan; i++ )
+   {
+      manhattan = first[ i ].isManhattan ();
+   }
+   
+   for ( unsigned long int i = 0; i < second.size () && manhattan; i++ )
+   {
+      manhattan = second[ i ].isManhattan ();
+   }
+   
+   addEdges ( first , 0 , edges );
+   addEdges ( second , 1 , edges );
+   
+   if ( edges.empty () )
+   {
+      return ( std::vector< OpenCIF::Shape > () );
+   }
+   
+   // The limits of the bands are taken from the heights of the vertices, so every band has about the same amount.
+   heights.reserve ( edges.size () * 2 );
+   
+   for ( unsigned long int i = 0; i < edges.size (); i++ )
+   {
+      heights.push_back ( edges[ i ].y0 );
+      heights.push_back ( edges[ i ].y1 );
+   }
+   
+   std::sort ( heights.begin () , heights.end () );
+   heights.erase ( std::unique ( heights.begin () , heights.end () ) , heights.end () );
+   
+   unsigned long int band_amount = std::min ( pool.getThreadAmount () * 4 , heights.size () - 1 );
+   
+   // Small inputs are not worth splitting.
+   band_amount = std::max ( std::min ( band_amount , (unsigned long int)( edges.size () / 256 ) ) , 1UL );
+   
+   for ( unsigned long int i = 0; i <= band_amount; i++ )
+   {
+      limits.push_back ( heights[ i * ( heights.size () - 1 ) / band_amount ] );
+   }
+   
+   limits.erase ( std::unique ( limits.begin () , limits.end () ) , limits.end () );
+   band_amount = limits.size () - 1;
+   
+   std::vector< std::vector< unsigned long int > > band_edges ( band_amount );
+   std::vector< BooleanBand > bands ( band_amount );
+   
+   for ( unsigned long int i = 0; i < edges.size (); i++ )
+   {
+      unsigned long int band = std::upper_bound ( limits.begin () , limits.end () , edges[ i ].y0 ) - limits.begin ();
+      
+      band = ( band == 0 ) ? 0 : band - 1;
+      
+      for ( ; band < band_amount && limits[ band ] < edges[ i ].y1; band++ )
+      {
+         band_edges[ band ].push_back ( i );
+      }
+   }
+   
+   pool.parallelFor ( band_amount , [ & ] ( unsigned long int first_band , unsigned long int last_band )
+   {
+      for ( unsigned long int band = first_band; band < last_band; band++ )
+      {
+         sweepBand ( edges , band_edges[ band ] , limits[ band ] , limits[ band + 1 ] , operation , manhattan , bands[ band ] );
+      }
+   } );
+   
+   std::vector< OpenCIF::Shape > shapes;
+   
+   if ( !manhattan )
+   {
+      for ( unsigned long int band = 0; band < band_amount; band++ )
+      {
+         for ( unsigned long int i = 0; i < bands[ band ].trapezoids.size (); i++ )
+         {
+            shapes.push_back ( OpenCIF::Shape ( layer_id , std::move ( bands[ band ].trapezoids[ i ] ) ) );
+         }
+      }
+      
+      return ( shapes );
+   }
+   
+   // Join the rectangles cut by the limit between two bands.
+   std::vector< OpenCIF::Rectangle > rectangles;
+   std::map< std::pair< long int , long int > , unsigned long int > touching , next_touching;
+   
+   for ( unsigned long int band = 0; band < band_amount; band++ )
+   {
+      next_touching.clear ();
+      
+      for ( unsigned long int i = 0; i < bands[ band ].rectangles.size (); i++ )
+      {
+         const OpenCIF::Rectangle& rectangle = bands[ band ].rectangles[ i ];
+         std::pair< long int , long int > key ( rectangle.getLeft () , rectangle.getRight () );
+         std::map< std::pair< long int , long int > , unsigned long int >::iterator below = touching.end ();
+         unsigned long int index;
+         
+         if ( rectangle.getBottom () == limits[ band ] )
+         {
+            below = touching.find ( key );
+         }
+         
+         if ( below != touching.end () )
+         {
+            index = below->second;
+            
+            OpenCIF::Rectangle& joined = rectangles[ index ];
+            
+            joined.set ( joined.getLeft () , joined.getBottom () , joined.getRight () , rectangle.getTop () );
+            touching.erase ( below );
+         }
+         else
+         {
+            index = rectangles.size ();
+            rectangles.push_back ( rectangle );
+         }
+         
+         if ( rectangle.getTop () == limits[ band + 1 ] )
+         {
+            next_touching[ key ] = index;
+         }
+      }
+      
+      touching.swap ( next_touching );
+   }
+   
+   shapes.reserve ( rectangles.size () );
+   
+   for ( unsigned long int i = 0; i < rectangles.size (); i++ )
+   {
+      shapes.push_back ( OpenCIF::Shape ( layer_id , rectangles[ i ] ) );
+   }
+   
+   return ( shapes );
+}
+
+/*
+ * Member function to compute "first layer operation second layer", taking the
+ * shapes of both layers from the same list.
+ */
+std::vector< OpenCIF::Shape > OpenCIF::Boolean::computeLayers ( const std::vector< OpenCIF::Shape >& shapes , const unsigned long int& first_layer_id ,
+                                                                const Operation& operation , const unsigned long int& second_layer_id ,
+                                                                const unsigned long int& layer_id ) const
+{
+   return ( compute ( selectLayer ( shapes , first_layer_id ) , operation , selectLayer ( shapes , second_layer_id ) , layer_id ) );
+}
+
+/*
+ * Member function to compute the union of the shapes of every layer. The
+ * result has the shapes of every layer, in the order of the layer IDs.
+ */
+std::vector< OpenCIF::Shape > OpenCIF::Boolean::merge ( const std::vector< OpenCIF::Shape >& shapes ) const
+{
+   OpenCIF::ThreadPool pool ( boolean_thread_amount );
+   std::map< unsigned long int , std::vector< OpenCIF::Shape > > layers;
+   std::vector< OpenCIF::Shape > merged;
+   std::vector< OpenCIF::Shape > nothing;
+   
+   for ( unsigned long int i = 0; i < shapes.size (); i++ )
+   {
+      layers[ shapes[ i ].getLayerID () ].push_back ( shapes[ i ] );
+   }
+   
+   for ( std::map< unsigned long int , std::vector< OpenCIF::Shape > >::const_iterator layer = layers.begin (); layer != layers.end (); layer++ )
+   {
+      std::vector< OpenCIF::Shape > layer_shapes = compute ( layer->second , Union , nothing , layer->first , pool );
+      
+      std::move ( layer_shapes.begin () , layer_shapes.end () , std::back_inserter ( merged ) );
+   }
+   
+   return ( merged );
+}
+
+/*
+ * Static member function to return the shapes of a layer.
+ */
+std::vector< OpenCIF::Shape > OpenCIF::Boolean::selectLayer ( const std::vector< OpenCIF::Shape >& shapes , const unsigned long int& layer_id )
+{
+   std::vector< OpenCIF::Shape > selected;
+   
+   for ( unsigned long int i = 0; i < shapes.size (); i++ )
+   {
+      if ( shapes[ i ].getLayerID () == layer_id )
+      {
+         selected.push_back ( shapes[ i ] );
+      }
+   }
+   
+   return ( selected );
+}
@@ -0,0 +1,89 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_BOOLEAN_HH_
+# define LIBOPENCIF_BOOLEAN_HH_
+
+# include <vector>
+
+# include "../shape/shape.hh"
+# include "../../threadpool/threadpool.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class computes boolean operations (union, intersection, difference
+    * and exclusive or) between two sets of shapes, using a scanline: the plane
+    * is cut into horizontal slabs at every vertex (and at every crossing of
+    * edges), and inside a slab the edges are sorted from left to right to know
+    * which parts are covered by every set. A point is covered by a set if the
+    * winding number of the set is not zero there, so the shapes of a set can
+    * overlap and have any orientation.
+    *
+    * The result is a list of shapes that don't overlap:
+    *
+    * - If every shape is Manhattan, the result is computed using only integers,
+    *   and it's made of rectangles (slabs with the same sides are joined).
+    * - Otherwise, the result is made of trapezoids, and the coordinates where
+    *   edges cross are rounded to the nearest integer.
+    *
+    * The slabs are grouped into horizontal bands (with about the same amount
+    * of vertices), and every band is computed by a thread of a pool.
+    */
+   class Boolean
+   {
+      public:
+         enum Operation
+         {
+            Union = 0 ,
+            Intersection ,
+            Difference ,
+            ExclusiveOr
+         };
+      
+      public:
+         explicit Boolean ( void );
+         virtual ~Boolean ( void );
+         
+         void setThreadAmount ( const unsigned long int& new_thread_amount );
+         unsigned long int getThreadAmount ( void ) const;
+         
+         std::vector< OpenCIF::Shape > compute ( const std::vector< OpenCIF::Shape >& first , const Operation& operation ,
+                                                 const std::vector< OpenCIF::Shape >& second , const unsigned long int& layer_id ) const;
+         std::vector< OpenCIF::Shape > compute ( const std::vector< OpenCIF::Shape >& first , const Operation& operation ,
+                                                 const std::vector< OpenCIF::Shape >& second , const unsigned long int& layer_id ,
+                                                 OpenCIF::ThreadPool& pool ) const;
+         std::vector< OpenCIF::Shape > computeLayers ( const std::vector< OpenCIF::Shape >& shapes , const unsigned long int& first_layer_id ,
+                                                       const Operation& operation , const unsigned long int& second_layer_id ,
+                                                       const unsigned long int& layer_id ) const;
+         std::vector< OpenCIF::Shape > merge ( const std::vector< OpenCIF::Shape >& shapes ) const;
+      
+      public:
+         static std::vector< OpenCIF::Shape > selectLayer ( const std::vector< OpenCIF::Shape >& shapes , const unsigned long int& layer_id );
+      
+      private:
+         unsigned long int boolean_thread_amount;
+   };
+}
+
+# endif
@@ -0,0 +1,442 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <cmath>
+# include <algorithm>
+# include <iterator>
+
+# include "expander.hh"
+
+namespace
+{
+   /*
+    * Function to round a coordinate computed using floating point.
+    */
+   long int roundCoordinate ( const double& value )
+   {
+      return ( std::lround ( value ) );
+   }
+}
+
+/*
+ * Default constructor. Round flashes use 32 segments, wires use extended
+ * ends, and one thread per core is used.
+ */
+OpenCIF::Expander::Expander ( void )
+   : expander_flash_segments ( 32 ) , expander_wire_ends ( ExtendedEnds ) , expander_thread_amount ( 0 )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Expander::~Expander ( void )
+{
+}
+
+/*
+ * Member function to set the amount of segments used for the round flashes
+ * (and the round ends of the wires). At least 4 segments are used.
+ */
+void OpenCIF::Expander::setFlashSegments ( const unsigned long int& new_flash_segments )
+{
+   expander_flash_segments = std::max ( new_flash_segments , 4UL );
+   
+   return;
+}
+
+void OpenCIF::Expander::setWireEnds ( const WireEnds& new_wire_ends )
+{
+   expander_wire_ends = new_wire_ends;
+   
+   return;
+}
+
+/*
+ * Member function to set the amount of threads used to expand a list of
+ * commands. If it's 0, one thread per core is used.
+ */
+void OpenCIF::Expander::setThreadAmount ( const unsigned long int& new_thread_amount )
+{
+   expander_thread_amount = new_thread_amount;
+   
+   return;
+}
+
+unsigned long int OpenCIF::Expander::getFlashSegments ( void ) const
+{
+   return ( expander_flash_segments );
+}
+
+OpenCIF::Expander::WireEnds OpenCIF::Expander::getWireEnds ( void ) const
+{
+   return ( expander_wire_ends );
+}
+
+unsigned long int OpenCIF::Expander::getThreadAmount ( void ) const
+{
+   return ( expander_thread_amount );
+}
+
+/*
+ * Member function to expand every primitive command of the list, using a new
+ * pool of threads.
+ */
+std::vector< OpenCIF::Shape > OpenCIF::Expander::expand ( const std::vector< OpenCIF::Command* >& commands ) const
+{
+   OpenCIF::ThreadPool pool ( expander_thread_amount );
+   
+   return ( expand ( commands , pool ) );
+}
+
+/*
+ * Member function to expand every primitive command of the list, using the
+ * given pool of threads. The list is split into blocks, every block is
+ * expanded by a thread into its own list, and then the lists are joined, so
+ * the shapes are in the same order as the commands.
+ */
+std::vector< OpenCIF::Shape > OpenCIF::Expander::expand ( const std::vector< OpenCIF::Command* >& commands , OpenCIF::ThreadPool& pool ) const
+{
+   unsigned long int block_amount = pool.getThreadAmount () * 4;
+   unsigned long int block_size = ( commands.size () + block_amount - 1 ) / block_amount;
+   std::vector< std::vector< OpenCIF::Shape > > blocks ( block_amount );
+   
+   pool.parallelFor ( block_amount , [ & ] ( unsigned long int first_block , unsigned long int last_block )
+   {
+      for ( unsigned long int block = first_block; block < last_block; block++ )
+      {
+         unsigned long int begin = std::min ( block * block_size , (unsigned long int)( commands.size () ) );
+         unsigned long int end = std::min ( begin + block_size , (unsigned long int)( commands.size () ) );
+         
+         for ( unsigned long int i = begin; i < end; i++ )
+         {
+            expand ( commands[ i ] , blocks[ block ] );
+         }
+      }
+   } );
+   
+   unsigned long int total = 0;
+   
+   for ( unsigned long int i = 0; i < blocks.size (); i++ )
+   {
+      total += blocks[ i ].size ();
+   }
+   
+   std::vector< OpenCIF::Shape > shapes;
+   
+   shapes.reserve ( total );
+   
+   for ( unsigned long int i = 0; i < blocks.size (); i++ )
+   {
+      std::move ( blocks[ i ].begin () , blocks[ i ].end () , std::back_inserter ( shapes ) );
+   }
+   
+   return ( shapes );
+}
+
+/*
+ * Member function to expand a single command, adding its shapes to the list.
+ * Commands that are not primitives are ignored.
+ */
+void OpenCIF::Expander::expand ( OpenCIF::Command* command , std::vector< OpenCIF::Shape >& shapes ) const
+{
+   switch ( command->type () )
+   {
+      case OpenCIF::Command::Box:
+         expandBox ( *static_cast< OpenCIF::BoxCommand* > ( command ) , shapes );
+         break;
+      
+      case OpenCIF::Command::Polygon:
+         expandPolygon ( *static_cast< OpenCIF::PolygonCommand* > ( command ) , shapes );
+         break;
+      
+      case OpenCIF::Command::RoundFlash:
+         expandRoundFlash ( *static_cast< OpenCIF::RoundFlashCommand* > ( command ) , shapes );
+         break;
+      
+      case OpenCIF::Command::Wire:
+         expandWire ( *static_cast< OpenCIF::WireCommand* > ( command ) , shapes );
+         break;
+      
+      default:
+         break;
+   }
+   
+   return;
+}
+
+/*
+ * Member function to expand a box. Horizontal and vertical directions are
+ * computed using integers: when the size is odd, the extra unit goes to the
+ * right (or top) side, so the size is kept.
+ */
+void OpenCIF::Expander::expandBox ( const OpenCIF::BoxCommand& command , std::vector< OpenCIF::Shape >& shapes ) const
+{
+   const OpenCIF::Point& center = command.getPosition ();
+   const OpenCIF::Point& rotation = command.getRotation ();
+   long int length = command.getSize ().getWidth ();
+   long int width = command.getSize ().getHeight ();
+   
+   if ( length == 0 || width == 0 )
+   {
+      return;
+   }
+   
+   if ( rotation.getY () == 0 || rotation.getX () == 0 )
+   {
+      // A vertical direction swaps the sides of the box.
+      if ( rotation.getY () != 0 )
+      {
+         std::swap ( length , width );
+      }
+      
+      long int left = center.getX () - length / 2;
+      long int bottom = center.getY () - width / 2;
+      
+      shapes.push_back ( OpenCIF::Shape ( command.getLayerID () , OpenCIF::Rectangle ( left , bottom , left + length , bottom + width ) ) );
+      
+      return;
+   }
+   
+   double norm = std::sqrt ( (double)( rotation.getX () ) * rotation.getX () + (double)( rotation.getY () ) * rotation.getY () );
+   double ux = rotation.getX () / norm * ( length / 2.0 );
+   double uy = rotation.getY () / norm * ( length / 2.0 );
+   double vx = -rotation.getY () / norm * ( width / 2.0 );
+   double vy = rotation.getX () / norm * ( width / 2.0 );
+   std::vector< OpenCIF::Point > points;
+   
+   points.reserve ( 4 );
+   points.push_back ( OpenCIF::Point ( roundCoordinate ( center.getX () - ux - vx ) , roundCoordinate ( center.getY () - uy - vy ) ) );
+   points.push_back ( OpenCIF::Point ( roundCoordinate ( center.getX () + ux - vx ) , roundCoordinate ( center.getY () + uy - vy ) ) );
+   points.push_back ( OpenCIF::Point ( roundCoordinate ( center.getX () + ux + vx ) , roundCoordinate ( center.getY () + uy + vy ) ) );
+   points.push_back ( OpenCIF::Point ( roundCoordinate ( center.getX () - ux + vx ) , roundCoordinate ( center.getY () - uy + vy ) ) );
+   
+   shapes.push_back ( OpenCIF::Shape ( command.getLayerID () , std::move ( points ) ) );
+   
+   return;
+}
+
+/*
+ * Member function to expand a polygon. Polygons with less than 3 points have
+ * no area, and are ignored.
+ */
+void OpenCIF::Expander::expandPolygon ( const OpenCIF::PolygonCommand& command , std::vector< OpenCIF::Shape >& shapes ) const
+{
+   if ( command.getPointAmount () < 3 )
+   {
+      return;
+   }
+   
+   shapes.push_back ( OpenCIF::Shape ( command.getLayerID () , command.getPoints () ) );
+   
+   return;
+}
+
+/*
+ * Member function to expand a round flash.
+ */
+void OpenCIF::Expander::expandRoundFlash ( const OpenCIF::RoundFlashCommand& command , std::vector< OpenCIF::Shape >& shapes ) const
+{
+   addCircle ( command.getLayerID () , command.getPosition () , command.getDiameter () / 2.0 , shapes );
+   
+   return;
+}
+
+/*
+ * Member function to expand a wire. Every segment becomes a rectangle (exact
+ * for horizontal and vertical segments). The segments are extended half the
+ * width at the ends of the wire (for extended ends) and at the joints with
+ * other segments (only the Manhattan ones, the other joints are filled using
+ * a bevel).
+ */
+void OpenCIF::Expander::expandWire ( const OpenCIF::WireCommand& command , std::vector< OpenCIF::Shape >& shapes ) const
+{
+   unsigned long int layer_id = command.getLayerID ();
+   long int width = command.getWidth ();
+   long int low_half = width / 2;
+   long int high_half = width - low_half;
+   double half = width / 2.0;
+   std::vector< OpenCIF::Point > path;
+   
+   if ( width == 0 )
+   {
+      return;
+   }
+   
+   // Repeated consecutive points don't change the wire.
+   path.reserve ( command.getPointAmount () );
+   
+   for ( unsigned long int i = 0; i < command.getPointAmount (); i++ )
+   {
+      const OpenCIF::Point& point = command.getPoint ( i );
+      
+      if ( path.empty () || point.getX () != path.back ().getX () || point.getY () != path.back ().getY () )
+      {
+         path.push_back ( point );
+      }
+   }
+   
+   if ( path.empty () )
+   {
+      return;
+   }
+   
+   if ( expander_wire_ends == RoundEnds )
+   {
+      for ( unsigned long int i = 0; i < path.size (); i++ )
+      {
+         addCircle ( layer_id , path[ i ] , half , shapes );
+      }
+   }
+   else if ( path.size () == 1 && expander_wire_ends == ExtendedEnds )
+   {
+      shapes.push_back ( OpenCIF::Shape ( layer_id , OpenCIF::Rectangle ( path[ 0 ].getX () - low_half , path[ 0 ].getY () - low_half ,
+                                                                          path[ 0 ].getX () + high_half , path[ 0 ].getY () + high_half ) ) );
+   }
+   
+   for ( unsigned long int i = 0; i + 1 < path.size (); i++ )
+   {
+      const OpenCIF::Point& start = path[ i ];
+      const OpenCIF::Point& end = path[ i + 1 ];
+      bool manhattan = ( start.getX () == end.getX () || start.getY () == end.getY () );
+      bool extend_start , extend_end;
+      
+      if ( expander_wire_ends == RoundEnds )
+      {
+         extend_start = extend_end = false;
+      }
+      else
+      {
+         extend_start = ( i == 0 ) ? ( expander_wire_ends == ExtendedEnds ) : manhattan;
+         extend_end = ( i + 2 == path.size () ) ? ( expander_wire_ends == ExtendedEnds ) : manhattan;
+      }
+      
+      if ( manhattan )
+      {
+         bool forward = ( start.getX () < end.getX () || start.getY () < end.getY () );
+         const OpenCIF::Point& low = forward ? start : end;
+         const OpenCIF::Point& high = forward ? end : start;
+         long int low_extension = ( forward ? extend_start : extend_end ) ? low_half : 0;
+         long int high_extension = ( forward ? extend_end : extend_start ) ? high_half : 0;
+         
+         if ( low.getY () == high.getY () )
+         {
+            shapes.push_back ( OpenCIF::Shape ( layer_id , OpenCIF::Rectangle ( low.getX () - low_extension , low.getY () - low_half ,
+                                                                                high.getX () + high_extension , low.getY () + high_half ) ) );
+         }
+         else
+         {
+            shapes.push_back ( OpenCIF::Shape ( layer_id , OpenCIF::Rectangle ( low.getX () - low_half , low.getY () - low_extension ,
+                                                                                low.getX () + high_half , high.getY () + high_extension ) ) );
+         }
+         
+         continue;
+      }
+      
+      double dx = end.getX () - start.getX ();
+      double dy = end.getY () - start.getY ();
+      double norm = std::sqrt ( dx * dx + dy * dy );
+      double ux = dx / norm , uy = dy / norm;
+      double start_extension = extend_start ? half : 0.0;
+      double end_extension = extend_end ? half : 0.0;
+      std::vector< OpenCIF::Point > points;
+      
+      points.reserve ( 4 );
+      points.push_back ( OpenCIF::Point ( roundCoordinate ( start.getX () - ux * start_extension + uy * half ) , roundCoordinate ( start.getY () - uy * start_extension - ux * half ) ) );
+      points.push_back ( OpenCIF::Point ( roundCoordinate ( end.getX () + ux * end_extension + uy * half ) , roundCoordinate ( end.getY () + uy * end_extension - ux * half ) ) );
+      points.push_back ( OpenCIF::Point ( roundCoordinate ( end.getX () + ux * end_extension - uy * half ) , roundCoordinate ( end.getY () + uy * end_extension + ux * half ) ) );
+      points.push_back ( OpenCIF::Point ( roundCoordinate ( start.getX () - ux * start_extension - uy * half ) , roundCoordinate ( start.getY () - uy * start_extension + ux * half ) ) );
+      
+      shapes.push_back ( OpenCIF::Shape ( layer_id , std::move ( points ) ) );
+   }
+   
+   // Bevel joints, only needed when a segment of the joint is not Manhattan.
+   for ( unsigned long int i = 1; expander_wire_ends != RoundEnds && i + 1 < path.size (); i++ )
+   {
+      const OpenCIF::Point& previous = path[ i - 1 ];
+      const OpenCIF::Point& joint = path[ i ];
+      const OpenCIF::Point& next = path[ i + 1 ];
+      double dx1 = joint.getX () - previous.getX () , dy1 = joint.getY () - previous.getY ();
+      double dx2 = next.getX () - joint.getX () , dy2 = next.getY () - joint.getY ();
+      
+      if ( ( dx1 == 0 || dy1 == 0 ) && ( dx2 == 0 || dy2 == 0 ) )
+      {
+         continue;
+      }
+      
+      // Segments in the same line don't need a joint.
+      if ( dx1 * dy2 - dy1 * dx2 == 0 )
+      {
+         continue;
+      }
+      
+      double norm1 = std::sqrt ( dx1 * dx1 + dy1 * dy1 );
+      double norm2 = std::sqrt ( dx2 * dx2 + dy2 * dy2 );
+      double nx1 = -dy1 / norm1 * half , ny1 = dx1 / norm1 * half;
+      double nx2 = -dy2 / norm2 * half , ny2 = dx2 / norm2 * half;
+      std::vector< OpenCIF::Point > points;
+      
+      points.reserve ( 4 );
+      points.push_back ( OpenCIF::Point ( roundCoordinate ( joint.getX () + nx1 ) , roundCoordinate ( joint.getY () + ny1 ) ) );
+      points.push_back ( OpenCIF::Point ( roundCoordinate ( joint.getX () + nx2 ) , roundCoordinate ( joint.getY () + ny2 ) ) );
+      points.push_back ( OpenCIF::Point ( roundCoordinate ( joint.getX () - nx1 ) , roundCoordinate ( joint.getY () - ny1 ) ) );
+      points.push_back ( OpenCIF::Point ( roundCoordinate ( joint.getX () - nx2 ) , roundCoordinate ( joint.getY () - ny2 ) ) );
+      
+      shapes.push_back ( OpenCIF::Shape ( layer_id , std::move ( points ) ) );
+   }
+   
+   return;
+}
+
+/*
+ * Member function to add a regular polygon inscribed in a circle. Circles
+ * too small to have an integer point out of the center are ignored.
+ */
+void OpenCIF::Expander::addCircle ( const unsigned long int& layer_id , const OpenCIF::Point& center , const double& radius , std::vector< OpenCIF::Shape >& shapes ) const
+{
+   const double pi = 3.14159265358979323846;
+   std::vector< OpenCIF::Point > points;
+   
+   if ( radius < 0.5 )
+   {
+      return;
+   }
+   
+   points.reserve ( expander_flash_segments );
+   
+   for ( unsigned long int i = 0; i < expander_flash_segments; i++ )
+   {
+      double angle = 2.0 * pi * i / expander_flash_segments;
+      OpenCIF::Point point ( roundCoordinate ( center.getX () + radius * std::cos ( angle ) ) , roundCoordinate ( center.getY () + radius * std::sin ( angle ) ) );
+      
+      // Small circles can round consecutive points to the same coordinates.
+      if ( points.empty () || point.getX () != points.back ().getX () || point.getY () != points.back ().getY () )
+      {
+         points.push_back ( point );
+      }
+   }
+   
+   shapes.push_back ( OpenCIF::Shape ( layer_id , std::move ( points ) ) );
+   
+   return;
+}
@@ -0,0 +1,98 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_EXPANDER_HH_
+# define LIBOPENCIF_EXPANDER_HH_
+
+# include <vector>
+
+# include "../shape/shape.hh"
+# include "../../command/command.hh"
+# include "../../command/primitivecommand/positionbasedcommand/boxcommand/boxcommand.hh"
+# include "../../command/primitivecommand/positionbasedcommand/roundflashcommand/roundflashcommand.hh"
+# include "../../command/primitivecommand/pathbasedcommand/polygoncommand/polygoncommand.hh"
+# include "../../command/primitivecommand/pathbasedcommand/wirecommand/wirecommand.hh"
+# include "../../threadpool/threadpool.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class converts the primitive commands into shapes (polygons with
+    * integer coordinates):
+    *
+    * - A box becomes a rectangle. If it's rotated, the corners are rounded to
+    *   the nearest integer, unless the direction is horizontal or vertical
+    *   (the exact rectangle is computed using only integers).
+    * - A polygon becomes a shape with the same points.
+    * - A round flash becomes a regular polygon, with the amount of segments
+    *   given by the user (32 by default), inscribed in the circle.
+    * - A wire becomes a shape per segment. The ends of the wire can be flush,
+    *   extended half the width (the default, as most tools do) or round (as
+    *   the CIF specification says, using a round flash at every point). The
+    *   joints between non-Manhattan segments are beveled. A Manhattan wire
+    *   with extended ends becomes only rectangles.
+    *
+    * The shapes aren't merged: a wire can produce overlapping shapes. The
+    * shapes keep the layer ID of the command. Calls to symbols are not
+    * followed.
+    */
+   class Expander
+   {
+      public:
+         enum WireEnds
+         {
+            FlushEnds = 0 ,
+            ExtendedEnds ,
+            RoundEnds
+         };
+      
+      public:
+         explicit Expander ( void );
+         virtual ~Expander ( void );
+         
+         void setFlashSegments ( const unsigned long int& new_flash_segments );
+         void setWireEnds ( const WireEnds& new_wire_ends );
+         void setThreadAmount ( const unsigned long int& new_thread_amount );
+         unsigned long int getFlashSegments ( void ) const;
+         WireEnds getWireEnds ( void ) const;
+         unsigned long int getThreadAmount ( void ) const;
+         
+         std::vector< OpenCIF::Shape > expand ( const std::vector< OpenCIF::Command* >& commands ) const;
+         std::vector< OpenCIF::Shape > expand ( const std::vector< OpenCIF::Command* >& commands , OpenCIF::ThreadPool& pool ) const;
+         void expand ( OpenCIF::Command* command , std::vector< OpenCIF::Shape >& shapes ) const;
+         void expandBox ( const OpenCIF::BoxCommand& command , std::vector< OpenCIF::Shape >& shapes ) const;
+         void expandPolygon ( const OpenCIF::PolygonCommand& command , std::vector< OpenCIF::Shape >& shapes ) const;
+         void expandRoundFlash ( const OpenCIF::RoundFlashCommand& command , std::vector< OpenCIF::Shape >& shapes ) const;
+         void expandWire ( const OpenCIF::WireCommand& command , std::vector< OpenCIF::Shape >& shapes ) const;
+      
+      private:
+         void addCircle ( const unsigned long int& layer_id , const OpenCIF::Point& center , const double& radius , std::vector< OpenCIF::Shape >& shapes ) const;
+      
+      private:
+         unsigned long int expander_flash_segments;
+         WireEnds expander_wire_ends;
+         unsigned long int expander_thread_amount;
+   };
+}
+
+# endif
@@ -0,0 +1,682 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <algorithm>
+# include <atomic>
+# include <map>
+
+# include "flattener.hh"
+# include "../../hierarchy/instancearray/instancearray.hh"
+# include "../../threadpool/threadpool.hh"
+# include "../../command/controlcommand/controlcommand.hh"
+# include "../../command/controlcommand/callcommand/callcommand.hh"
+# include "../../command/controlcommand/definitionstartcommand/definitionstartcommand.hh"
+
+namespace
+{
+   /*
+    * Call of a symbol, or regular array of calls (a single call is an array
+    * of one element). The transformation is the one of the first element,
+    * without the scale of the symbol called.
+    */
+   struct FlattenerCall
+   {
+      unsigned long int id;
+      OpenCIF::Transform transform;
+      OpenCIF::InstanceArray array;
+   };
+   
+   /*
+    * Definition of a symbol found in the list of commands. The primitives and
+    * the calls are taken from the list the first time the symbol is placed.
+    */
+   struct FlattenerSymbol
+   {
+      unsigned long int begin;
+      unsigned long int end;
+      OpenCIF::Transform scale;
+      bool prepared;
+      bool visiting;
+      bool bounded;
+      OpenCIF::Rectangle bounds;
+      std::vector< OpenCIF::Shape > shapes;
+      std::vector< FlattenerCall > calls;
+   };
+   
+   /*
+    * State of a single flattening.
+    */
+   struct FlattenerContext
+   {
+      const std::vector< OpenCIF::Command* >& commands;
+      const OpenCIF::Expander& expander;
+      const OpenCIF::Rectangle& window;
+      std::vector< FlattenerSymbol > symbols;
+      std::map< unsigned long int , unsigned long int > table;
+      
+      FlattenerContext ( const std::vector< OpenCIF::Command* >& new_commands , const OpenCIF::Expander& new_expander ,
+                         const OpenCIF::Rectangle& new_window )
+         : commands ( new_commands ) , expander ( new_expander ) , window ( new_window )
+      {
+      }
+   };
+   
+   /*
+    * Placement of a symbol in the stack of a worker: the symbol, the
+    * transformation to the coordinates of the file, and the next call (and
+    * element of its array) to follow.
+    */
+   struct FlattenerFrame
+   {
+      unsigned long int symbol;
+      OpenCIF::Transform transform;
+      unsigned long int call;
+      unsigned long int element;
+   };
+   
+   /*
+    * State of a worker, that places symbols and gives their shapes to a
+    * sink. The stack replaces the recursion, and the shape and the points
+    * are reused for every shape placed, so the placements don't allocate
+    * memory once they have grown to the biggest shape.
+    */
+   struct FlattenerWorker
+   {
+      OpenCIF::ShapeSink& sink;
+      std::vector< FlattenerFrame > stack;
+      std::vector< bool > visiting;
+      OpenCIF::Shape shape;
+      std::vector< OpenCIF::Point > points;
+      std::vector< OpenCIF::Shape > primitive_shapes;
+      
+      explicit FlattenerWorker ( OpenCIF::ShapeSink& new_sink )
+         : sink ( new_sink )
+      {
+      }
+   };
+   
+   /*
+    * Sink used to return the shapes as a vector.
+    */
+   class FlattenerCollector : public OpenCIF::ShapeSink
+   {
+      public:
+         explicit FlattenerCollector ( std::vector< OpenCIF::Shape >& new_shapes )
+            : collector_shapes ( new_shapes )
+         {
+         }
+         
+         virtual bool write ( const OpenCIF::Shape& shape )
+         {
+            collector_shapes.push_back ( shape );
+            
+            return ( true );
+         }
+      
+      private:
+         std::vector< OpenCIF::Shape >& collector_shapes;
+   };
+   
+   /*
+    * Function to expand the primitives of a symbol, and to keep its calls
+    * (with the transformations composed). The calls that form regular arrays
+    * are kept as a single call.
+    */
+   void prepare ( FlattenerContext& context , FlattenerSymbol& symbol )
+   {
+      if ( symbol.prepared )
+      {
+         return;
+      }
+      
+      std::vector< OpenCIF::Instance > instances;
+      
+      for ( unsigned long int i = symbol.begin + 1; i < symbol.end; i++ )
+      {
+         OpenCIF::Command* command = context.commands[ i ];
+         
+         if ( command->type () == OpenCIF::Command::Call )
+         {
+            OpenCIF::CallCommand* call = static_cast< OpenCIF::CallCommand* > ( command );
+            
+            // The symbols are not resolved yet (they can be redefined), so the instances keep the IDs.
+            instances.push_back ( OpenCIF::Instance ( call->getID () , call->getTransform () , i ) );
+         }
+         else
+         {
+            context.expander.expand ( command , symbol.shapes );
+         }
+      }
+      
+      std::vector< OpenCIF::InstanceArray > arrays = OpenCIF::InstanceArray::detect ( instances );
+      unsigned long int next_array = 0;
+      
+      for ( unsigned long int i = 0; i < instances.size (); i++ )
+      {
+         FlattenerCall call;
+         
+         call.id = instances[ i ].getSymbol ();
+         call.transform = instances[ i ].getTransform ();
+         
+         if ( next_array < arrays.size () && arrays[ next_array ].getFirst () == i )
+         {
+            call.array = arrays[ next_array++ ];
+            i += call.array.getSize () - 1;
+         }
+         
+         symbol.calls.push_back ( call );
+      }
+      
+      symbol.prepared = true;
+      
+      return;
+   }
+   
+   /*
+    * Function to return the symbol called using an ID, or NULL if it's not
+    * defined.
+    */
+   FlattenerSymbol* find ( FlattenerContext& context , const unsigned long int& id )
+   {
+      std::map< unsigned long int , unsigned long int >::const_iterator found = context.table.find ( id );
+      
+      return ( ( found != context.table.end () ) ? &context.symbols[ found->second ] : NULL );
+   }
+   
+   /*
+    * Function to compute the bounding box of a symbol, including the symbols
+    * it calls, in the coordinates of the definition (before the scale).
+    */
+   const OpenCIF::Rectangle& bound ( FlattenerContext& context , FlattenerSymbol& symbol )
+   {
+      if ( symbol.bounded || symbol.visiting )
+      {
+         return ( symbol.bounds );
+      }
+      
+      prepare ( context , symbol );
+      
+      symbol.visiting = true;
+      symbol.bounds = OpenCIF::Rectangle ();
+      
+      for ( unsigned long int i = 0; i < symbol.shapes.size (); i++ )
+      {
+         symbol.bounds.add ( symbol.shapes[ i ].getBounds () );
+      }
+      
+      for ( unsigned long int i = 0; i < symbol.calls.size (); i++ )
+      {
+         const FlattenerCall& call = symbol.calls[ i ];
+         FlattenerSymbol* called = find ( context , call.id );
+         
+         if ( called != NULL )
+         {
+            symbol.bounds.add ( call.array.getBounds ( ( call.transform * called->scale ).apply ( bound ( context , *called ) ) ) );
+         }
+      }
+      
+      symbol.visiting = false;
+      symbol.bounded = true;
+      
+      return ( symbol.bounds );
+   }
+   
+   /*
+    * Function to transform a shape into the shape of the worker, reusing its
+    * memory (the same result as Transform::apply).
+    */
+   void transformShape ( FlattenerWorker& worker , const OpenCIF::Shape& shape , const OpenCIF::Transform& transform )
+   {
+      worker.shape.setLayerID ( shape.getLayerID () );
+      
+      if ( shape.isRectangle () && transform.isOrthogonal () )
+      {
+         worker.shape.setRectangle ( transform.apply ( shape.getBounds () ) );
+         
+         return;
+      }
+      
+      const std::vector< OpenCIF::Point >& points = shape.getPoints ();
+      
+      worker.points.clear ();
+      
+      for ( unsigned long int i = 0; i < points.size (); i++ )
+      {
+         worker.points.push_back ( transform.apply ( points[ i ] ) );
+      }
+      
+      worker.shape.swapPoints ( worker.points );
+      
+      return;
+   }
+   
+   /*
+    * Function to give the shapes of a symbol placed using the given
+    * transformation (from the coordinates of the definition to the
+    * coordinates of the file) to the sink, and to push the placement to
+    * follow its calls. Returns false if the sink stops.
+    */
+   bool enter ( FlattenerContext& context , FlattenerWorker& worker , const unsigned long int& index , const OpenCIF::Transform& transform )
+   {
+      FlattenerSymbol& symbol = context.symbols[ index ];
+      
+      if ( worker.visiting[ index ] )
+      {
+         return ( true );
+      }
+      
+      const OpenCIF::Rectangle& bounds = bound ( context , symbol );
+      
+      // A placement whose coordinates can't be stored (they would be saturated) is skipped.
+      if ( !transform.fits ( bounds ) )
+      {
+         return ( true );
+      }
+      
+      if ( !context.window.isEmpty () && !context.window.intersects ( transform.apply ( bounds ) ) )
+      {
+         return ( true );
+      }
+      
+      prepare ( context , symbol );
+      
+      for ( unsigned long int i = 0; i < symbol.shapes.size (); i++ )
+      {
+         if ( context.window.isEmpty () || context.window.intersects ( transform.apply ( symbol.shapes[ i ].getBounds () ) ) )
+         {
+            transformShape ( worker , symbol.shapes[ i ] , transform );
+            
+            if ( !worker.sink.write ( worker.shape ) )
+            {
+               return ( false );
+            }
+         }
+      }
+      
+      FlattenerFrame frame;
+      
+      frame.symbol = index;
+      frame.transform = transform;
+      frame.call = 0;
+      frame.element = 0;
+      
+      worker.stack.push_back ( frame );
+      worker.visiting[ index ] = true;
+      
+      return ( true );
+   }
+   
+   /*
+    * Function to place a symbol and, depth first, every symbol it calls.
+    * Returns false if the sink stops.
+    */
+   bool place ( FlattenerContext& context , FlattenerWorker& worker , const unsigned long int& index , const OpenCIF::Transform& transform )
+   {
+      bool result = enter ( context , worker , index , transform );
+      
+      while ( result && !worker.stack.empty () )
+      {
+         FlattenerFrame& frame = worker.stack.back ();
+         const FlattenerSymbol& symbol = context.symbols[ frame.symbol ];
+         
+         if ( frame.call == symbol.calls.size () )
+         {
+            worker.visiting[ frame.symbol ] = false;
+            worker.stack.pop_back ();
+            
+            continue;
+         }
+         
+         const FlattenerCall& call = symbol.calls[ frame.call ];
+         FlattenerSymbol* called = find ( context , call.id );
+         unsigned long int element = frame.element++;
+         
+         if ( frame.element == call.array.getSize () )
+         {
+            frame.call++;
+            frame.element = 0;
+         }
+         
+         if ( called == NULL )
+         {
+            continue;
+         }
+         
+         // An array outside the window is skipped at once, instead of element by element.
+         if ( element == 0 && call.array.getSize () > 1 && !context.window.isEmpty () )
+         {
+            OpenCIF::Transform first_transform = call.transform * called->scale;
+            OpenCIF::Rectangle bounds = call.array.getBounds ( first_transform.apply ( bound ( context , *called ) ) );
+            
+            if ( !context.window.intersects ( frame.transform.apply ( bounds ) ) )
+            {
+               frame.call++;
+               frame.element = 0;
+               
+               continue;
+            }
+         }
+         
+         // The frame can be moved by the push, so the transformation is composed first.
+         OpenCIF::Transform called_transform = frame.transform * call.array.place ( call.transform , element ) * called->scale;
+         
+         result = enter ( context , worker , called - &context.symbols[ 0 ] , called_transform );
+      }
+      
+      for ( unsigned long int i = 0; i < worker.stack.size (); i++ )
+      {
+         worker.visiting[ worker.stack[ i ].symbol ] = false;
+      }
+      
+      worker.stack.clear ();
+      
+      return ( result );
+   }
+   
+   /*
+    * Function to give the shapes of a primitive outside the definitions to
+    * the sink. Returns false if the sink stops.
+    */
+   bool placePrimitive ( FlattenerContext& context , FlattenerWorker& worker , OpenCIF::Command* command )
+   {
+      worker.primitive_shapes.clear ();
+      context.expander.expand ( command , worker.primitive_shapes );
+      
+      for ( unsigned long int i = 0; i < worker.primitive_shapes.size (); i++ )
+      {
+         if ( context.window.isEmpty () || context.window.intersects ( worker.primitive_shapes[ i ].getBounds () ) )
+         {
+            if ( !worker.sink.write ( worker.primitive_shapes[ i ] ) )
+            {
+               return ( false );
+            }
+         }
+      }
+      
+      return ( true );
+   }
+   
+   /*
+    * Function to add the definition that starts in the given command. Returns
+    * the index of its "DF" command.
+    */
+   unsigned long int define ( FlattenerContext& context , unsigned long int i )
+   {
+      const std::vector< OpenCIF::Command* >& commands = context.commands;
+      FlattenerSymbol symbol;
+      
+      symbol.begin = i;
+      symbol.scale = OpenCIF::Transform::fromScale ( static_cast< OpenCIF::DefinitionStartCommand* > ( commands[ i ] )->getAB () );
+      symbol.prepared = symbol.visiting = symbol.bounded = false;
+      
+      while ( i + 1 < commands.size () && commands[ i + 1 ]->type () != OpenCIF::Command::DefinitionEnd )
+      {
+         i++;
+      }
+      
+      i++;
+      symbol.end = i;
+      
+      context.table[ static_cast< OpenCIF::ControlCommand* > ( commands[ symbol.begin ] )->getID () ] = context.symbols.size ();
+      context.symbols.push_back ( symbol );
+      
+      return ( i );
+   }
+}
+
+/*
+ * Default constructor. The default expander is used, and there is no
+ * window.
+ */
+OpenCIF::Flattener::Flattener ( void )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Flattener::~Flattener ( void )
+{
+}
+
+/*
+ * Member function to set the expander used for the primitives (segments of
+ * the round flashes, ends of the wires).
+ */
+void OpenCIF::Flattener::setExpander ( const OpenCIF::Expander& new_expander )
+{
+   flattener_expander = new_expander;
+   
+   return;
+}
+
+/*
+ * Member function to set the window. An empty rectangle means that every
+ * shape is returned.
+ */
+void OpenCIF::Flattener::setWindow ( const OpenCIF::Rectangle& new_window )
+{
+   flattener_window = new_window;
+   
+   return;
+}
+
+const OpenCIF::Expander& OpenCIF::Flattener::getExpander ( void ) const
+{
+   return ( flattener_expander );
+}
+
+const OpenCIF::Rectangle& OpenCIF::Flattener::getWindow ( void ) const
+{
+   return ( flattener_window );
+}
+
+/*
+ * Member function to return the shapes drawn by a list of commands.
+ */
+std::vector< OpenCIF::Shape > OpenCIF::Flattener::flatten ( const std::vector< OpenCIF::Command* >& commands ) const
+{
+   std::vector< OpenCIF::Shape > shapes;
+   FlattenerCollector collector ( shapes );
+   
+   flatten ( commands , collector );
+   
+   return ( shapes );
+}
+
+/*
+ * Member function to give the shapes drawn by a list of commands to a sink,
+ * in the same order "flatten" returns them, without storing them. Returns
+ * false if the sink stops or fails.
+ */
+bool OpenCIF::Flattener::flatten ( const std::vector< OpenCIF::Command* >& commands , OpenCIF::ShapeSink& sink ) const
+{
+   FlattenerContext context ( commands , flattener_expander , flattener_window );
+   FlattenerWorker worker ( sink );
+   bool result = true;
+   
+   for ( unsigned long int i = 0; i < commands.size () && result; i++ )
+   {
+      switch ( commands[ i ]->type () )
+      {
+         case OpenCIF::Command::DefinitionStart:
+         {
+            i = define ( context , i );
+            worker.visiting.resize ( context.symbols.size () , false );
+            
+            // The bounds of the symbols can change, since the symbols they call can be redefined.
+            for ( unsigned long int j = 0; j < context.symbols.size (); j++ )
+            {
+               context.symbols[ j ].bounded = false;
+            }
+            
+            break;
+         }
+         
+         case OpenCIF::Command::DefinitionDelete:
+         {
+            unsigned long int first_id = static_cast< OpenCIF::ControlCommand* > ( commands[ i ] )->getID ();
+            
+            context.table.erase ( context.table.lower_bound ( first_id ) , context.table.end () );
+            
+            for ( unsigned long int j = 0; j < context.symbols.size (); j++ )
+            {
+               context.symbols[ j ].bounded = false;
+            }
+            
+            break;
+         }
+         
+         case OpenCIF::Command::Call:
+         {
+            OpenCIF::CallCommand* call = static_cast< OpenCIF::CallCommand* > ( commands[ i ] );
+            FlattenerSymbol* called = find ( context , call->getID () );
+            
+            if ( called != NULL )
+            {
+               result = place ( context , worker , called - &context.symbols[ 0 ] , call->getTransform () * called->scale );
+            }
+            
+            break;
+         }
+         
+         default:
+            result = placePrimitive ( context , worker , commands[ i ] );
+            break;
+      }
+   }
+   
+   return ( sink.finish () && result );
+}
+
+/*
+ * Member function to give the shapes drawn by a list of commands to several
+ * sinks in parallel, one worker for every sink. The calls and the
+ * primitives outside the definitions are taken by the workers one by one,
+ * so every sink receives the shapes of a disjoint part of the design (the
+ * order between the parts is not kept).
+ *
+ * The symbols are read and bounded before the workers start. If the
+ * definitions change while the commands are read (a "DD" command, a
+ * symbol defined again, or a definition after the first call), the result
+ * would depend on the order, so the first sink receives every shape.
+ * Returns false if a sink stops or fails.
+ */
+bool OpenCIF::Flattener::flatten ( const std::vector< OpenCIF::Command* >& commands , const std::vector< OpenCIF::ShapeSink* >& sinks ) const
+{
+   if ( sinks.empty () )
+   {
+      return ( false );
+   }
+   
+   FlattenerContext context ( commands , flattener_expander , flattener_window );
+   std::vector< std::pair< unsigned long int , unsigned long int > > items; // Command, and symbol called (or NoSymbol).
+   const unsigned long int NoSymbol = (unsigned long int)-1;
+   bool dynamic = false;
+   
+   for ( unsigned long int i = 0; i < commands.size () && !dynamic; i++ )
+   {
+      switch ( commands[ i ]->type () )
+      {
+         case OpenCIF::Command::DefinitionStart:
+            dynamic = !items.empty () || context.table.count ( static_cast< OpenCIF::ControlCommand* > ( commands[ i ] )->getID () ) > 0;
+            i = define ( context , i );
+            break;
+         
+         case OpenCIF::Command::DefinitionDelete:
+            dynamic = true;
+            break;
+         
+         case OpenCIF::Command::Call:
+         {
+            FlattenerSymbol* called = find ( context , static_cast< OpenCIF::CallCommand* > ( commands[ i ] )->getID () );
+            
+            if ( called != NULL )
+            {
+               items.push_back ( std::make_pair ( i , called - &context.symbols[ 0 ] ) );
+            }
+            
+            break;
+         }
+         
+         default:
+            items.push_back ( std::make_pair ( i , NoSymbol ) );
+            break;
+      }
+   }
+   
+   if ( dynamic || sinks.size () == 1 )
+   {
+      return ( flatten ( commands , *sinks[ 0 ] ) );
+   }
+   
+   // After this, the workers only read the symbols.
+   for ( unsigned long int i = 0; i < context.symbols.size (); i++ )
+   {
+      bound ( context , context.symbols[ i ] );
+   }
+   
+   OpenCIF::ThreadPool pool ( sinks.size () );
+   std::atomic< unsigned long int > next ( 0 );
+   std::atomic< bool > stopped ( false );
+   std::vector< char > results ( sinks.size () , 1 );
+   
+   for ( unsigned long int w = 0; w < sinks.size (); w++ )
+   {
+      pool.submit ( [ & , w ] ()
+      {
+         FlattenerWorker worker ( *sinks[ w ] );
+         bool result = true;
+         
+         worker.visiting.resize ( context.symbols.size () , false );
+         
+         for ( unsigned long int j = next++; j < items.size () && result && !stopped; j = next++ )
+         {
+            OpenCIF::Command* command = commands[ items[ j ].first ];
+            
+            if ( items[ j ].second == NoSymbol )
+            {
+               result = placePrimitive ( context , worker , command );
+            }
+            else
+            {
+               const OpenCIF::CallCommand* call = static_cast< const OpenCIF::CallCommand* > ( command );
+               
+               result = place ( context , worker , items[ j ].second ,
+                                call->getTransform () * context.symbols[ items[ j ].second ].scale );
+            }
+         }
+         
+         if ( !result )
+         {
+            stopped = true;
+         }
+         
+         results[ w ] = ( worker.sink.finish () && result );
+      } );
+   }
+   
+   pool.wait ();
+   
+   return ( std::find ( results.begin () , results.end () , 0 ) == results.end () );
+}
@@ -0,0 +1,82 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_FLATTENER_HH_
+# define LIBOPENCIF_FLATTENER_HH_
+
+# include <vector>
+
+# include "../shape/shape.hh"
+# include "../rectangle/rectangle.hh"
+# include "../transform/transform.hh"
+# include "../expander/expander.hh"
+# include "../shapesink/shapesink.hh"
+# include "../../command/command.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class converts the commands of a CIF file into the shapes that are
+    * drawn: the primitives outside the definitions, and the contents of every
+    * symbol called (recursively), placed using the transformations of the
+    * calls and the scale of the definitions.
+    *
+    * The primitives of every symbol are expanded only once, and then every
+    * placement only transforms the shapes. The definitions are found while
+    * the commands are read, so a "DD" command removes them for the calls
+    * that follow. Calls to unknown symbols, and recursive calls, are ignored.
+    *
+    * If a window is given, only the shapes that intersect it are returned,
+    * and the placements of symbols outside the window are skipped without
+    * visiting their contents. The placements that would take coordinates out
+    * of the range of the Point class are skipped too.
+    *
+    * The shapes can be given to a sink instead of being returned. The
+    * symbols are placed using a stack (not recursion), and the placed shapes
+    * are built in memory that is reused, so the memory used doesn't depend
+    * on the amount of shapes drawn, only on the depth of the hierarchy and
+    * the contents of the symbols. Several sinks can be filled in parallel,
+    * every one with a part of the calls outside the definitions.
+    */
+   class Flattener
+   {
+      public:
+         explicit Flattener ( void );
+         virtual ~Flattener ( void );
+         
+         void setExpander ( const OpenCIF::Expander& new_expander );
+         void setWindow ( const OpenCIF::Rectangle& new_window );
+         const OpenCIF::Expander& getExpander ( void ) const;
+         const OpenCIF::Rectangle& getWindow ( void ) const;
+         
+         std::vector< OpenCIF::Shape > flatten ( const std::vector< OpenCIF::Command* >& commands ) const;
+         bool flatten ( const std::vector< OpenCIF::Command* >& commands , OpenCIF::ShapeSink& sink ) const;
+         bool flatten ( const std::vector< OpenCIF::Command* >& commands , const std::vector< OpenCIF::ShapeSink* >& sinks ) const;
+      
+      private:
+         OpenCIF::Expander flattener_expander;
+         OpenCIF::Rectangle flattener_window;
+   };
+}
+
+# endif
@@ -0,0 +1,270 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <algorithm>
+
+# include "rectangle.hh"
+
+/*
+ * Default constructor. The rectangle is empty (the left side is after the
+ * right side).
+ */
+OpenCIF::Rectangle::Rectangle ( void )
+   : rectangle_left ( 0 ) , rectangle_bottom ( 0 ) , rectangle_right ( -1 ) , rectangle_top ( -1 )
+{
+}
+
+/*
+ * Non-default constructor. Initialize the rectangle with its sides.
+ */
+OpenCIF::Rectangle::Rectangle ( const long int& new_left , const long int& new_bottom , const long int& new_right , const long int& new_top )
+   : rectangle_left ( new_left ) , rectangle_bottom ( new_bottom ) , rectangle_right ( new_right ) , rectangle_top ( new_top )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Rectangle::~Rectangle ( void )
+{
+}
+
+long int OpenCIF::Rectangle::getLeft ( void ) const
+{
+   return ( rectangle_left );
+}
+
+long int OpenCIF::Rectangle::getBottom ( void ) const
+{
+   return ( rectangle_bottom );
+}
+
+long int OpenCIF::Rectangle::getRight ( void ) const
+{
+   return ( rectangle_right );
+}
+
+long int OpenCIF::Rectangle::getTop ( void ) const
+{
+   return ( rectangle_top );
+}
+
+/*
+ * Member function to return the width. An empty rectangle has no width.
+ */
+long int OpenCIF::Rectangle::getWidth ( void ) const
+{
+   return ( isEmpty () ? 0 : rectangle_right - rectangle_left );
+}
+
+/*
+ * Member function to return the height. An empty rectangle has no height.
+ */
+long int OpenCIF::Rectangle::getHeight ( void ) const
+{
+   return ( isEmpty () ? 0 : rectangle_top - rectangle_bottom );
+}
+
+/*
+ * Member function to return the area. It's computed using "long long int",
+ * since the product of two coordinates can be bigger than a "long int".
+ */
+long long int OpenCIF::Rectangle::getArea ( void ) const
+{
+   return ( (long long int)( getWidth () ) * (long long int)( getHeight () ) );
+}
+
+void OpenCIF::Rectangle::set ( const long int& new_left , const long int& new_bottom , const long int& new_right , const long int& new_top )
+{
+   rectangle_left = new_left;
+   rectangle_bottom = new_bottom;
+   rectangle_right = new_right;
+   rectangle_top = new_top;
+   
+   return;
+}
+
+/*
+ * Member function to make the rectangle grow until it contains the point.
+ */
+void OpenCIF::Rectangle::add ( const OpenCIF::Point& point )
+{
+   if ( isEmpty () )
+   {
+      set ( point.getX () , point.getY () , point.getX () , point.getY () );
+      
+      return;
+   }
+   
+   if ( point.getX () < rectangle_left )
+   {
+      rectangle_left = point.getX ();
+   }
+   
+   if ( point.getX () > rectangle_right )
+   {
+      rectangle_right = point.getX ();
+   }
+   
+   if ( point.getY () < rectangle_bottom )
+   {
+      rectangle_bottom = point.getY ();
+   }
+   
+   if ( point.getY () > rectangle_top )
+   {
+      rectangle_top = point.getY ();
+   }
+   
+   return;
+}
+
+/*
+ * Member function to make the rectangle grow until it contains the given
+ * rectangle. Empty rectangles are ignored.
+ */
+void OpenCIF::Rectangle::add ( const OpenCIF::Rectangle& rectangle )
+{
+   if ( rectangle.isEmpty () )
+   {
+      return;
+   }
+   
+   if ( isEmpty () )
+   {
+      *this = rectangle;
+      
+      return;
+   }
+   
+   if ( rectangle.rectangle_left < rectangle_left )
+   {
+      rectangle_left = rectangle.rectangle_left;
+   }
+   
+   if ( rectangle.rectangle_right > rectangle_right )
+   {
+      rectangle_right = rectangle.rectangle_right;
+   }
+   
+   if ( rectangle.rectangle_bottom < rectangle_bottom )
+   {
+      rectangle_bottom = rectangle.rectangle_bottom;
+   }
+   
+   if ( rectangle.rectangle_top > rectangle_top )
+   {
+      rectangle_top = rectangle.rectangle_top;
+   }
+   
+   return;
+}
+
+/*
+ * Member function to know if the rectangle is empty. A rectangle with zero
+ * width or height (a line or a point) is not empty.
+ */
+bool OpenCIF::Rectangle::isEmpty ( void ) const
+{
+   return ( rectangle_left > rectangle_right || rectangle_bottom > rectangle_top );
+}
+
+/*
+ * Member function to know if a point is inside the rectangle, or over its
+ * border.
+ */
+bool OpenCIF::Rectangle::contains ( const OpenCIF::Point& point ) const
+{
+   return ( point.getX () >= rectangle_left && point.getX () <= rectangle_right &&
+            point.getY () >= rectangle_bottom && point.getY () <= rectangle_top );
+}
+
+/*
+ * Member function to know if the given rectangle is completely inside this
+ * one.
+ */
+bool OpenCIF::Rectangle::contains ( const OpenCIF::Rectangle& rectangle ) const
+{
+   if ( isEmpty () || rectangle.isEmpty () )
+   {
+      return ( false );
+   }
+   
+   return ( rectangle.rectangle_left >= rectangle_left && rectangle.rectangle_right <= rectangle_right &&
+            rectangle.rectangle_bottom >= rectangle_bottom && rectangle.rectangle_top <= rectangle_top );
+}
+
+/*
+ * Member function to know if the rectangles share at least a point (touching
+ * rectangles intersect).
+ */
+bool OpenCIF::Rectangle::intersects ( const OpenCIF::Rectangle& rectangle ) const
+{
+   if ( isEmpty () || rectangle.isEmpty () )
+   {
+      return ( false );
+   }
+   
+   return ( rectangle.rectangle_left <= rectangle_right && rectangle.rectangle_right >= rectangle_left &&
+            rectangle.rectangle_bottom <= rectangle_top && rectangle.rectangle_top >= rectangle_bottom );
+}
+
+/*
+ * Member function to return the rectangle shared by both rectangles. If they
+ * don't intersect, the result is empty.
+ */
+OpenCIF::Rectangle OpenCIF::Rectangle::intersection ( const OpenCIF::Rectangle& rectangle ) const
+{
+   if ( !intersects ( rectangle ) )
+   {
+      return ( OpenCIF::Rectangle () );
+   }
+   
+   return ( OpenCIF::Rectangle ( std::max ( rectangle_left , rectangle.rectangle_left ) ,
+                                 std::max ( rectangle_bottom , rectangle.rectangle_bottom ) ,
+                                 std::min ( rectangle_right , rectangle.rectangle_right ) ,
+                                 std::min ( rectangle_top , rectangle.rectangle_top ) ) );
+}
+
+bool OpenCIF::Rectangle::operator== ( const OpenCIF::Rectangle& rectangle ) const
+{
+   if ( isEmpty () && rectangle.isEmpty () )
+   {
+      return ( true );
+   }
+   
+   return ( rectangle_left == rectangle.rectangle_left && rectangle_bottom == rectangle.rectangle_bottom &&
+            rectangle_right == rectangle.rectangle_right && rectangle_top == rectangle.rectangle_top );
+}
+
+bool OpenCIF::Rectangle::operator!= ( const OpenCIF::Rectangle& rectangle ) const
+{
+   return ( !( *this == rectangle ) );
+}
+
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Rectangle& rectangle )
+{
+   output_stream << rectangle.rectangle_left << " " << rectangle.rectangle_bottom << " " << rectangle.rectangle_right << " " << rectangle.rectangle_top;
+   
+   return ( output_stream );
+}
@@ -0,0 +1,81 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_RECTANGLE_HH_
+# define LIBOPENCIF_RECTANGLE_HH_
+
+# include <iostream>
+
+# include "../../command/point/point.hh"
+
+namespace OpenCIF { class Rectangle; }
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Rectangle& rectangle );
+
+namespace OpenCIF
+{
+   /*
+    * This class represents an axis-aligned rectangle, with integer
+    * coordinates. It's used for bounding boxes, windows and markers.
+    *
+    * A default constructed rectangle is empty. Adding points or rectangles
+    * to an empty rectangle makes it grow to contain them.
+    */
+   class Rectangle
+   {
+      public:
+         explicit Rectangle ( void );
+         explicit Rectangle ( const long int& new_left , const long int& new_bottom , const long int& new_right , const long int& new_top );
+         virtual ~Rectangle ( void );
+         
+         long int getLeft ( void ) const;
+         long int getBottom ( void ) const;
+         long int getRight ( void ) const;
+         long int getTop ( void ) const;
+         long int getWidth ( void ) const;
+         long int getHeight ( void ) const;
+         long long int getArea ( void ) const;
+         
+         void set ( const long int& new_left , const long int& new_bottom , const long int& new_right , const long int& new_top );
+         void add ( const OpenCIF::Point& point );
+         void add ( const OpenCIF::Rectangle& rectangle );
+         
+         bool isEmpty ( void ) const;
+         bool contains ( const OpenCIF::Point& point ) const;
+         bool contains ( const OpenCIF::Rectangle& rectangle ) const;
+         bool intersects ( const OpenCIF::Rectangle& rectangle ) const;
+         OpenCIF::Rectangle intersection ( const OpenCIF::Rectangle& rectangle ) const;
+         
+         bool operator== ( const OpenCIF::Rectangle& rectangle ) const;
+         bool operator!= ( const OpenCIF::Rectangle& rectangle ) const;
+         
+         friend std::ostream& (::operator<<) ( std::ostream& output_stream , const Rectangle& rectangle );
+      
+      private:
+         long int rectangle_left;
+         long int rectangle_bottom;
+         long int rectangle_right;
+         long int rectangle_top;
+   };
+}
+
+# endif
@@ -0,0 +1,352 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <algorithm>
+# include <utility>
+
+# include "shape.hh"
+
+namespace
+{
+   /*
+    * Function to know the side of a point from a line: positive if it's on
+    * the left, negative if it's on the right, and 0 if it's on the line.
+    */
+   int side ( const OpenCIF::Point& first , const OpenCIF::Point& second , const OpenCIF::Point& point )
+   {
+      long long int cross = (long long int)( second.getX () - first.getX () ) * (long long int)( point.getY () - first.getY () ) -
+                            (long long int)( second.getY () - first.getY () ) * (long long int)( point.getX () - first.getX () );
+      
+      return ( ( cross > 0 ) - ( cross < 0 ) );
+   }
+   
+   /*
+    * Function to know if a point on the line of a segment is inside the
+    * segment.
+    */
+   bool between ( const OpenCIF::Point& first , const OpenCIF::Point& second , const OpenCIF::Point& point )
+   {
+      return ( std::min ( first.getX () , second.getX () ) <= point.getX () && point.getX () <= std::max ( first.getX () , second.getX () ) &&
+               std::min ( first.getY () , second.getY () ) <= point.getY () && point.getY () <= std::max ( first.getY () , second.getY () ) );
+   }
+   
+   /*
+    * Function to know if two segments touch (including their ends).
+    */
+   bool segmentsTouch ( const OpenCIF::Point& first_a , const OpenCIF::Point& first_b , const OpenCIF::Point& second_a , const OpenCIF::Point& second_b )
+   {
+      int side_1 = side ( first_a , first_b , second_a );
+      int side_2 = side ( first_a , first_b , second_b );
+      int side_3 = side ( second_a , second_b , first_a );
+      int side_4 = side ( second_a , second_b , first_b );
+      
+      if ( side_1 * side_2 < 0 && side_3 * side_4 < 0 )
+      {
+         return ( true );
+      }
+      
+      // Otherwise, they only touch if an end of a segment is on the other one.
+      return ( ( side_1 == 0 && between ( first_a , first_b , second_a ) ) || ( side_2 == 0 && between ( first_a , first_b , second_b ) ) ||
+               ( side_3 == 0 && between ( second_a , second_b , first_a ) ) || ( side_4 == 0 && between ( second_a , second_b , first_b ) ) );
+   }
+}
+
+/*
+ * Default constructor. The shape has no points and no layer.
+ */
+OpenCIF::Shape::Shape ( void )
+   : shape_layer_id ( OpenCIF::LayerTable::NoLayer ) , shape_manhattan ( true ) , shape_rectangle ( false )
+{
+}
+
+/*
+ * Non-default constructors. Initialize the shape with its layer and its
+ * points.
+ */
+OpenCIF::Shape::Shape ( const unsigned long int& new_layer_id , const std::vector< OpenCIF::Point >& new_points )
+   : shape_layer_id ( new_layer_id ) , shape_points ( new_points )
+{
+   update ();
+}
+
+OpenCIF::Shape::Shape ( const unsigned long int& new_layer_id , std::vector< OpenCIF::Point >&& new_points )
+   : shape_layer_id ( new_layer_id ) , shape_points ( std::move ( new_points ) )
+{
+   update ();
+}
+
+OpenCIF::Shape::Shape ( const unsigned long int& new_layer_id , const OpenCIF::Rectangle& rectangle )
+   : shape_layer_id ( new_layer_id )
+{
+   setRectangle ( rectangle );
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Shape::~Shape ( void )
+{
+}
+
+void OpenCIF::Shape::setLayerID ( const unsigned long int& new_layer_id )
+{
+   shape_layer_id = new_layer_id;
+   
+   return;
+}
+
+void OpenCIF::Shape::setPoints ( const std::vector< OpenCIF::Point >& new_points )
+{
+   shape_points = new_points;
+   update ();
+   
+   return;
+}
+
+void OpenCIF::Shape::setPoints ( std::vector< OpenCIF::Point >&& new_points )
+{
+   shape_points = std::move ( new_points );
+   update ();
+   
+   return;
+}
+
+/*
+ * Member function to exchange the points of the shape with the points of a
+ * vector. The vector receives the previous points (and their memory), so a
+ * shape can be filled again and again without allocating.
+ */
+void OpenCIF::Shape::swapPoints ( std::vector< OpenCIF::Point >& new_points )
+{
+   shape_points.swap ( new_points );
+   update ();
+   
+   return;
+}
+
+/*
+ * Member function to make the shape a rectangle. The points are stored in
+ * counterclockwise order, starting from the bottom left corner.
+ */
+void OpenCIF::Shape::setRectangle ( const OpenCIF::Rectangle& rectangle )
+{
+   shape_points.clear ();
+   
+   if ( !rectangle.isEmpty () )
+   {
+      shape_points.reserve ( 4 );
+      shape_points.push_back ( OpenCIF::Point ( rectangle.getLeft () , rectangle.getBottom () ) );
+      shape_points.push_back ( OpenCIF::Point ( rectangle.getRight () , rectangle.getBottom () ) );
+      shape_points.push_back ( OpenCIF::Point ( rectangle.getRight () , rectangle.getTop () ) );
+      shape_points.push_back ( OpenCIF::Point ( rectangle.getLeft () , rectangle.getTop () ) );
+   }
+   
+   shape_bounds = rectangle;
+   shape_manhattan = true;
+   shape_rectangle = !rectangle.isEmpty ();
+   
+   return;
+}
+
+unsigned long int OpenCIF::Shape::getLayerID ( void ) const
+{
+   return ( shape_layer_id );
+}
+
+const std::vector< OpenCIF::Point >& OpenCIF::Shape::getPoints ( void ) const
+{
+   return ( shape_points );
+}
+
+const OpenCIF::Rectangle& OpenCIF::Shape::getBounds ( void ) const
+{
+   return ( shape_bounds );
+}
+
+/*
+ * Member function to return the area of the shape (shoelace formula). The
+ * area is always positive, no matter the orientation of the points.
+ */
+long long int OpenCIF::Shape::getArea ( void ) const
+{
+   if ( shape_rectangle )
+   {
+      return ( shape_bounds.getArea () );
+   }
+   
+   long long int twice_area = 0;
+   unsigned long int amount = shape_points.size ();
+   
+   for ( unsigned long int i = 0; i < amount; i++ )
+   {
+      const OpenCIF::Point& current = shape_points[ i ];
+      const OpenCIF::Point& next = shape_points[ ( i + 1 ) % amount ];
+      
+      twice_area += (long long int)( current.getX () ) * next.getY () - (long long int)( next.getX () ) * current.getY ();
+   }
+   
+   return ( ( twice_area < 0 ? -twice_area : twice_area ) / 2 );
+}
+
+bool OpenCIF::Shape::isManhattan ( void ) const
+{
+   return ( shape_manhattan );
+}
+
+bool OpenCIF::Shape::isRectangle ( void ) const
+{
+   return ( shape_rectangle );
+}
+
+/*
+ * Member function to compute the bounding box of the points, and to check if
+ * the shape is Manhattan, and if it's a rectangle (4 points, Manhattan, and
+ * every point in a corner of the bounding box).
+ */
+void OpenCIF::Shape::update ( void )
+{
+   unsigned long int amount = shape_points.size ();
+   
+   shape_bounds = OpenCIF::Rectangle ();
+   shape_manhattan = true;
+   
+   for ( unsigned long int i = 0; i < amount; i++ )
+   {
+      const OpenCIF::Point& current = shape_points[ i ];
+      const OpenCIF::Point& next = shape_points[ ( i + 1 ) % amount ];
+      
+      shape_bounds.add ( current );
+      
+      if ( current.getX () != next.getX () && current.getY () != next.getY () )
+      {
+         shape_manhattan = false;
+      }
+   }
+   
+   shape_rectangle = ( amount == 4 && shape_manhattan );
+   
+   for ( unsigned long int i = 0; shape_rectangle && i < amount; i++ )
+   {
+      const OpenCIF::Point& current = shape_points[ i ];
+      
+      if ( ( current.getX () != shape_bounds.getLeft () && current.getX () != shape_bounds.getRight () ) ||
+           ( current.getY () != shape_bounds.getBottom () && current.getY () != shape_bounds.getTop () ) )
+      {
+         shape_rectangle = false;
+      }
+   }
+   
+   return;
+}
+
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Shape& shape )
+{
+   output_stream << "P";
+   
+   for ( unsigned long int i = 0; i < shape.shape_points.size (); i++ )
+   {
+      output_stream << " " << shape.shape_points[ i ];
+   }
+   
+   output_stream << " ;";
+   
+   return ( output_stream );
+}
+
+/*
+ * Member function to know if a point is inside the shape, or on its border.
+ */
+bool OpenCIF::Shape::contains ( const OpenCIF::Point& point ) const
+{
+   if ( !shape_bounds.contains ( point ) )
+   {
+      return ( false );
+   }
+   
+   if ( shape_rectangle )
+   {
+      return ( true );
+   }
+   
+   bool inside = false;
+   
+   for ( unsigned long int i = 0; i < shape_points.size (); i++ )
+   {
+      const OpenCIF::Point& first = shape_points[ i ];
+      const OpenCIF::Point& second = shape_points[ ( i + 1 ) % shape_points.size () ];
+      
+      if ( side ( first , second , point ) == 0 && between ( first , second , point ) )
+      {
+         return ( true );
+      }
+      
+      // Count the edges crossed by a ray to the right of the point.
+      if ( ( first.getY () > point.getY () ) != ( second.getY () > point.getY () ) )
+      {
+         double x = first.getX () + (double)( point.getY () - first.getY () ) * (double)( second.getX () - first.getX () ) /
+                    (double)( second.getY () - first.getY () );
+         
+         if ( x > point.getX () )
+         {
+            inside = !inside;
+         }
+      }
+   }
+   
+   return ( inside );
+}
+
+/*
+ * Member function to know if two shapes touch or overlap (the layers are
+ * not checked).
+ */
+bool OpenCIF::Shape::touches ( const OpenCIF::Shape& shape ) const
+{
+   if ( !shape_bounds.intersects ( shape.shape_bounds ) || shape_points.empty () || shape.shape_points.empty () )
+   {
+      return ( false );
+   }
+   
+   if ( shape_rectangle && shape.shape_rectangle )
+   {
+      return ( true );
+   }
+   
+   for ( unsigned long int i = 0; i < shape_points.size (); i++ )
+   {
+      const OpenCIF::Point& first = shape_points[ i ];
+      const OpenCIF::Point& second = shape_points[ ( i + 1 ) % shape_points.size () ];
+      
+      for ( unsigned long int j = 0; j < shape.shape_points.size (); j++ )
+      {
+         if ( segmentsTouch ( first , second , shape.shape_points[ j ] , shape.shape_points[ ( j + 1 ) % shape.shape_points.size () ] ) )
+         {
+            return ( true );
+         }
+      }
+   }
+   
+   // Without crossing borders, a shape can only be inside the other one.
+   return ( contains ( shape.shape_points[ 0 ] ) || shape.contains ( shape_points[ 0 ] ) );
+}
+
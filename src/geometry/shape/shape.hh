@@ -0,0 +1,90 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_SHAPE_HH_
+# define LIBOPENCIF_SHAPE_HH_
+
+# include <iostream>
+# include <vector>
+
+# include "../../command/point/point.hh"
+# include "../../layertable/layertable.hh"
+# include "../rectangle/rectangle.hh"
+
+namespace OpenCIF { class Shape; }
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Shape& shape );
+
+namespace OpenCIF
+{
+   /*
+    * This class represents a closed polygon with integer coordinates, drawn
+    * in a layer. Every primitive command (box, polygon, wire, round flash) can
+    * be expanded into one or more shapes, so the geometry algorithms of the
+    * library only need to work with this class.
+    *
+    * The last point is joined with the first one (it's not repeated). When
+    * the points are set, the bounding box is computed, and the shape is
+    * checked to know if it's Manhattan (all the edges are horizontal or
+    * vertical) and if it's a rectangle, so the algorithms can use faster
+    * paths for those shapes.
+    */
+   class Shape
+   {
+      public:
+         explicit Shape ( void );
+         explicit Shape ( const unsigned long int& new_layer_id , const std::vector< OpenCIF::Point >& new_points );
+         explicit Shape ( const unsigned long int& new_layer_id , std::vector< OpenCIF::Point >&& new_points );
+         explicit Shape ( const unsigned long int& new_layer_id , const OpenCIF::Rectangle& rectangle );
+         virtual ~Shape ( void );
+         
+         void setLayerID ( const unsigned long int& new_layer_id );
+         void setPoints ( const std::vector< OpenCIF::Point >& new_points );
+         void setPoints ( std::vector< OpenCIF::Point >&& new_points );
+         void swapPoints ( std::vector< OpenCIF::Point >& new_points );
+         void setRectangle ( const OpenCIF::Rectangle& rectangle );
+         
+         unsigned long int getLayerID ( void ) const;
+         const std::vector< OpenCIF::Point >& getPoints ( void ) const;
+         const OpenCIF::Rectangle& getBounds ( void ) const;
+         long long int getArea ( void ) const;
+         bool isManhattan ( void ) const;
+         bool isRectangle ( void ) const;
+         
+         bool contains ( const OpenCIF::Point& point ) const;
+         bool touches ( const OpenCIF::Shape& shape ) const;
+         
+         friend std::ostream& (::operator<<) ( std::ostream& output_stream , const Shape& shape );
+      
+      private:
+         void update ( void );
+      
+      private:
+         unsigned long int shape_layer_id;
+         std::vector< OpenCIF::Point > shape_points;
+         OpenCIF::Rectangle shape_bounds;
+         bool shape_manhattan;
+         bool shape_rectangle;
+   };
+}
+
+# endif
@@ -0,0 +1,98 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "binarysink.hh"
+# include "../../../layertable/layertable.hh"
+
+namespace
+{
+   const unsigned long int BufferSize = 1 << 20;
+}
+
+OpenCIF::BinarySink::BinarySink ( std::ostream& new_output )
+   : sink_output ( new_output )
+{
+   sink_buffer.reserve ( BufferSize );
+}
+
+OpenCIF::BinarySink::~BinarySink ( void )
+{
+}
+
+/*
+ * Member function to add the record of a shape. Returns false if the stream
+ * fails.
+ */
+bool OpenCIF::BinarySink::write ( const OpenCIF::Shape& shape )
+{
+   const std::vector< OpenCIF::Point >& points = shape.getPoints ();
+   
+   if ( sink_buffer.size () + 8 + 16 * points.size () > BufferSize && !flush () )
+   {
+      return ( false );
+   }
+   
+   put ( ( shape.getLayerID () == OpenCIF::LayerTable::NoLayer ) ? 0xFFFFFFFFULL : shape.getLayerID () , 4 );
+   put ( points.size () , 4 );
+   
+   for ( unsigned long int i = 0; i < points.size (); i++ )
+   {
+      put ( (unsigned long long int)points[ i ].getX () , 8 );
+      put ( (unsigned long long int)points[ i ].getY () , 8 );
+   }
+   
+   return ( true );
+}
+
+/*
+ * Member function to write the records left in the buffer.
+ */
+bool OpenCIF::BinarySink::finish ( void )
+{
+   if ( !flush () )
+   {
+      return ( false );
+   }
+   
+   sink_output.flush ();
+   
+   return ( sink_output.good () );
+}
+
+void OpenCIF::BinarySink::put ( const unsigned long long int& value , const int& bytes )
+{
+   for ( int i = 0; i < bytes; i++ )
+   {
+      sink_buffer.push_back ( (char)( ( value >> ( 8 * i ) ) & 0xFF ) );
+   }
+   
+   return;
+}
+
+bool OpenCIF::BinarySink::flush ( void )
+{
+   sink_output.write ( sink_buffer.data () , sink_buffer.size () );
+   sink_buffer.clear ();
+   
+   return ( sink_output.good () );
+}
@@ -0,0 +1,64 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_BINARYSINK_HH_
+# define LIBOPENCIF_BINARYSINK_HH_
+
+# include <iostream>
+# include <vector>
+
+# include "../shapesink.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class writes the shapes as binary records, one after the other,
+    * every number in little endian:
+    *
+    * - The ID of the layer (4 bytes, 0xFFFFFFFF for no layer).
+    * - The amount of points (4 bytes).
+    * - The X and the Y of every point (8 bytes each, signed).
+    *
+    * The records are stored in a buffer, and written to the stream when it's
+    * full and by "finish".
+    */
+   class BinarySink : public OpenCIF::ShapeSink
+   {
+      public:
+         explicit BinarySink ( std::ostream& new_output );
+         virtual ~BinarySink ( void );
+         
+         virtual bool write ( const OpenCIF::Shape& shape );
+         virtual bool finish ( void );
+      
+      private:
+         void put ( const unsigned long long int& value , const int& bytes );
+         bool flush ( void );
+      
+      private:
+         std::ostream& sink_output;
+         std::vector< char > sink_buffer;
+   };
+}
+
+# endif
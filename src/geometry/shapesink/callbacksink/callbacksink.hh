@@ -0,0 +1,50 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_CALLBACKSINK_HH_
+# define LIBOPENCIF_CALLBACKSINK_HH_
+
+# include <functional>
+
+# include "../shapesink.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class gives every shape to a function. The function returns false
+    * to stop the flattening.
+    */
+   class CallbackSink : public OpenCIF::ShapeSink
+   {
+      public:
+         explicit CallbackSink ( const std::function< bool ( const OpenCIF::Shape& ) >& new_callback );
+         virtual ~CallbackSink ( void );
+         
+         virtual bool write ( const OpenCIF::Shape& shape );
+      
+      private:
+         std::function< bool ( const OpenCIF::Shape& ) > sink_callback;
+   };
+}
+
+# endif
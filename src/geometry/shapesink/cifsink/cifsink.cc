@@ -0,0 +1,115 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <cstdio>
+
+# include "cifsink.hh"
+
+namespace
+{
+   /*
+    * Function to append a number to a text, after a space.
+    */
+   void append ( std::string& text , const long long int& value )
+   {
+      char digits[ 24 ];
+      int length = std::snprintf ( digits , sizeof ( digits ) , " %lld" , value );
+      
+      text.append ( digits , length );
+      
+      return;
+   }
+}
+
+/*
+ * Constructor. No layer is selected yet.
+ */
+OpenCIF::CIFSink::CIFSink ( std::ostream& new_output , const OpenCIF::LayerTable& new_layers )
+   : sink_output ( new_output ) ,
+     sink_layers ( new_layers ) ,
+     sink_layer ( OpenCIF::LayerTable::NoLayer )
+{
+}
+
+OpenCIF::CIFSink::~CIFSink ( void )
+{
+}
+
+/*
+ * Member function to write a shape, preceded by its layer if it changed.
+ * Returns false if the stream fails.
+ */
+bool OpenCIF::CIFSink::write ( const OpenCIF::Shape& shape )
+{
+   sink_text.clear ();
+   
+   if ( shape.getLayerID () != sink_layer && shape.getLayerID () != OpenCIF::LayerTable::NoLayer )
+   {
+      sink_text += "L";
+      sink_text += sink_layers.getName ( shape.getLayerID () );
+      sink_text += ";\n";
+      sink_layer = shape.getLayerID ();
+   }
+   
+   const OpenCIF::Rectangle& bounds = shape.getBounds ();
+   long int width = bounds.getWidth ();
+   long int height = bounds.getHeight ();
+   
+   // A box has its center as position, so the rectangles with an odd side are written as polygons.
+   if ( shape.isRectangle () && width > 0 && height > 0 && width % 2 == 0 && height % 2 == 0 )
+   {
+      sink_text += "B";
+      append ( sink_text , width );
+      append ( sink_text , height );
+      append ( sink_text , bounds.getLeft () + width / 2 );
+      append ( sink_text , bounds.getBottom () + height / 2 );
+   }
+   else
+   {
+      const std::vector< OpenCIF::Point >& points = shape.getPoints ();
+      
+      sink_text += "P";
+      
+      for ( unsigned long int i = 0; i < points.size (); i++ )
+      {
+         append ( sink_text , points[ i ].getX () );
+         append ( sink_text , points[ i ].getY () );
+      }
+   }
+   
+   sink_text += ";\n";
+   sink_output.write ( sink_text.data () , sink_text.size () );
+   
+   return ( sink_output.good () );
+}
+
+/*
+ * Member function to write the end of the file.
+ */
+bool OpenCIF::CIFSink::finish ( void )
+{
+   sink_output << "E\n";
+   sink_output.flush ();
+   
+   return ( sink_output.good () );
+}
@@ -0,0 +1,62 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_CIFSINK_HH_
+# define LIBOPENCIF_CIFSINK_HH_
+
+# include <iostream>
+# include <string>
+
+# include "../shapesink.hh"
+# include "../../../layertable/layertable.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class writes the shapes as a flat CIF file (without definitions
+    * nor calls). The layers are named using a layer table, and a "L" command
+    * is written only when the layer changes. The rectangles with an integer
+    * center are written as boxes, and the other shapes as polygons. "finish"
+    * writes the "E" command.
+    *
+    * The text of every shape is built in a buffer that is reused, so writing
+    * a shape doesn't allocate memory.
+    */
+   class CIFSink : public OpenCIF::ShapeSink
+   {
+      public:
+         explicit CIFSink ( std::ostream& new_output , const OpenCIF::LayerTable& new_layers );
+         virtual ~CIFSink ( void );
+         
+         virtual bool write ( const OpenCIF::Shape& shape );
+         virtual bool finish ( void );
+      
+      private:
+         std::ostream& sink_output;
+         const OpenCIF::LayerTable& sink_layers;
+         unsigned long int sink_layer;
+         std::string sink_text;
+   };
+}
+
+# endif
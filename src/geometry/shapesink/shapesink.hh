@@ -0,0 +1,51 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_SHAPESINK_HH_
+# define LIBOPENCIF_SHAPESINK_HH_
+
+# include "../shape/shape.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class is the destination of the shapes streamed by the Flattener:
+    * every shape is given to the sink as soon as it's placed, instead of
+    * being stored, so a design can be flattened without keeping its shapes.
+    *
+    * The shape given to "write" is only valid during the call (the flattener
+    * reuses its memory for the next one). If "write" returns false, the
+    * flattening stops. "finish" is called once, after the last shape.
+    */
+   class ShapeSink
+   {
+      public:
+         explicit ShapeSink ( void );
+         virtual ~ShapeSink ( void );
+         
+         virtual bool write ( const OpenCIF::Shape& shape ) = 0;
+         virtual bool finish ( void );
+   };
+}
+
+# endif
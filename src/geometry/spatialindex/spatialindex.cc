@@ -0,0 +1,322 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <algorithm>
+# include <cmath>
+
+# include "spatialindex.hh"
+
+/*
+ * Tile returned for points outside the index.
+ */
+const unsigned long int OpenCIF::SpatialIndex::NoTile = (unsigned long int)( -1 );
+
+/*
+ * Default constructor. An empty index, without tiles.
+ */
+OpenCIF::SpatialIndex::SpatialIndex ( void )
+   : index_tile_size ( 0 ) , index_columns ( 0 ) , index_rows ( 0 )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::SpatialIndex::~SpatialIndex ( void )
+{
+}
+
+/*
+ * Member function to build the index using the bounding boxes of a list of
+ * shapes.
+ */
+void OpenCIF::SpatialIndex::build ( const std::vector< OpenCIF::Shape >& shapes , const unsigned long int& tile_size )
+{
+   std::vector< OpenCIF::Rectangle > rectangles;
+   
+   rectangles.reserve ( shapes.size () );
+   
+   for ( unsigned long int i = 0; i < shapes.size (); i++ )
+   {
+      rectangles.push_back ( shapes[ i ].getBounds () );
+   }
+   
+   build ( rectangles , tile_size );
+   
+   return;
+}
+
+/*
+ * Member function to build the index using a list of rectangles. If the
+ * size of the tiles is 0, it's chosen to have a few items per tile, but not
+ * smaller than most of the items.
+ */
+void OpenCIF::SpatialIndex::build ( const std::vector< OpenCIF::Rectangle >& rectangles , const unsigned long int& tile_size )
+{
+   clear ();
+   
+   index_item_bounds = rectangles;
+   
+   for ( unsigned long int i = 0; i < rectangles.size (); i++ )
+   {
+      index_bounds.add ( rectangles[ i ] );
+   }
+   
+   if ( index_bounds.isEmpty () )
+   {
+      return;
+   }
+   
+   double width = (double)( index_bounds.getWidth () ) + 1;
+   double height = (double)( index_bounds.getHeight () ) + 1;
+   
+   index_tile_size = tile_size;
+   
+   if ( index_tile_size == 0 )
+   {
+      std::vector< long int > sizes;
+      
+      sizes.reserve ( rectangles.size () );
+      
+      for ( unsigned long int i = 0; i < rectangles.size (); i++ )
+      {
+         if ( !rectangles[ i ].isEmpty () )
+         {
+            sizes.push_back ( std::max ( rectangles[ i ].getWidth () , rectangles[ i ].getHeight () ) );
+         }
+      }
+      
+      std::nth_element ( sizes.begin () , sizes.begin () + sizes.size () / 2 , sizes.end () );
+      
+      double items_per_tile = 8;
+      double by_amount = std::sqrt ( width * height * items_per_tile / (double)( sizes.size () ) );
+      double by_size = (double)( sizes[ sizes.size () / 2 ] );
+      
+      index_tile_size = (unsigned long int)( std::ceil ( std::max ( std::max ( by_amount , by_size ) , 1.0 ) ) );
+   }
+   
+   index_columns = (unsigned long int)( std::ceil ( width / (double)( index_tile_size ) ) );
+   index_rows = (unsigned long int)( std::ceil ( height / (double)( index_tile_size ) ) );
+   
+   // The items are stored tile by tile: first the amount per tile, and then the items.
+   index_offsets.assign ( index_columns * index_rows + 1 , 0 );
+   
+   for ( unsigned long int i = 0; i < rectangles.size (); i++ )
+   {
+      if ( rectangles[ i ].isEmpty () )
+      {
+         continue;
+      }
+      
+      for ( unsigned long int row = findRow ( rectangles[ i ].getBottom () ); row <= findRow ( rectangles[ i ].getTop () ); row++ )
+      {
+         for ( unsigned long int column = findColumn ( rectangles[ i ].getLeft () ); column <= findColumn ( rectangles[ i ].getRight () ); column++ )
+         {
+            index_offsets[ row * index_columns + column + 1 ]++;
+         }
+      }
+   }
+   
+   for ( unsigned long int i = 1; i < index_offsets.size (); i++ )
+   {
+      index_offsets[ i ] += index_offsets[ i - 1 ];
+   }
+   
+   std::vector< unsigned long int > next ( index_offsets.begin () , index_offsets.end () - 1 );
+   
+   index_items.resize ( index_offsets.back () );
+   
+   for ( unsigned long int i = 0; i < rectangles.size (); i++ )
+   {
+      if ( rectangles[ i ].isEmpty () )
+      {
+         continue;
+      }
+      
+      for ( unsigned long int row = findRow ( rectangles[ i ].getBottom () ); row <= findRow ( rectangles[ i ].getTop () ); row++ )
+      {
+         for ( unsigned long int column = findColumn ( rectangles[ i ].getLeft () ); column <= findColumn ( rectangles[ i ].getRight () ); column++ )
+         {
+            index_items[ next[ row * index_columns + column ]++ ] = i;
+         }
+      }
+   }
+   
+   return;
+}
+
+void OpenCIF::SpatialIndex::clear ( void )
+{
+   index_bounds = OpenCIF::Rectangle ();
+   index_tile_size = index_columns = index_rows = 0;
+   index_item_bounds.clear ();
+   index_offsets.clear ();
+   index_items.clear ();
+   
+   return;
+}
+
+const OpenCIF::Rectangle& OpenCIF::SpatialIndex::getBounds ( void ) const
+{
+   return ( index_bounds );
+}
+
+unsigned long int OpenCIF::SpatialIndex::getTileSize ( void ) const
+{
+   return ( index_tile_size );
+}
+
+unsigned long int OpenCIF::SpatialIndex::getColumns ( void ) const
+{
+   return ( index_columns );
+}
+
+unsigned long int OpenCIF::SpatialIndex::getRows ( void ) const
+{
+   return ( index_rows );
+}
+
+unsigned long int OpenCIF::SpatialIndex::getTileAmount ( void ) const
+{
+   return ( index_columns * index_rows );
+}
+
+unsigned long int OpenCIF::SpatialIndex::getItemAmount ( void ) const
+{
+   return ( index_item_bounds.size () );
+}
+
+const OpenCIF::Rectangle& OpenCIF::SpatialIndex::getItemBounds ( const unsigned long int& item ) const
+{
+   return ( index_item_bounds[ item ] );
+}
+
+OpenCIF::Rectangle OpenCIF::SpatialIndex::getTileRectangle ( const unsigned long int& tile ) const
+{
+   long int left = index_bounds.getLeft () + (long int)( ( tile % index_columns ) * index_tile_size );
+   long int bottom = index_bounds.getBottom () + (long int)( ( tile / index_columns ) * index_tile_size );
+   
+   return ( OpenCIF::Rectangle ( left , bottom , left + (long int)( index_tile_size ) , bottom + (long int)( index_tile_size ) ) );
+}
+
+/*
+ * Member function to append the items kept in a tile.
+ */
+void OpenCIF::SpatialIndex::getTileItems ( const unsigned long int& tile , std::vector< unsigned long int >& items ) const
+{
+   items.insert ( items.end () , index_items.begin () + index_offsets[ tile ] , index_items.begin () + index_offsets[ tile + 1 ] );
+   
+   return;
+}
+
+/*
+ * Member function to return the tile that contains a point, or NoTile if
+ * the point is outside the bounding box of the items.
+ */
+unsigned long int OpenCIF::SpatialIndex::findTile ( const OpenCIF::Point& point ) const
+{
+   if ( !index_bounds.contains ( point ) )
+   {
+      return ( NoTile );
+   }
+   
+   return ( findRow ( point.getY () ) * index_columns + findColumn ( point.getX () ) );
+}
+
+/*
+ * Member function to append the items whose bounding box touches a window.
+ * Every item is appended once.
+ */
+void OpenCIF::SpatialIndex::query ( const OpenCIF::Rectangle& window , std::vector< unsigned long int >& items ) const
+{
+   if ( !window.intersects ( index_bounds ) )
+   {
+      return;
+   }
+   
+   OpenCIF::Rectangle inside = window.intersection ( index_bounds );
+   
+   for ( unsigned long int row = findRow ( inside.getBottom () ); row <= findRow ( inside.getTop () ); row++ )
+   {
+      for ( unsigned long int column = findColumn ( inside.getLeft () ); column <= findColumn ( inside.getRight () ); column++ )
+      {
+         unsigned long int tile = row * index_columns + column;
+         
+         for ( unsigned long int i = index_offsets[ tile ]; i < index_offsets[ tile + 1 ]; i++ )
+         {
+            const OpenCIF::Rectangle& bounds = index_item_bounds[ index_items[ i ] ];
+            
+            if ( !bounds.intersects ( window ) )
+            {
+               continue;
+            }
+            
+            // Append the item only in the first tile of the window where it is.
+            if ( findColumn ( std::max ( bounds.getLeft () , inside.getLeft () ) ) == column &&
+                 findRow ( std::max ( bounds.getBottom () , inside.getBottom () ) ) == row )
+            {
+               items.push_back ( index_items[ i ] );
+            }
+         }
+      }
+   }
+   
+   return;
+}
+
+/*
+ * Member function to append the items whose bounding box contains a point.
+ */
+void OpenCIF::SpatialIndex::query ( const OpenCIF::Point& point , std::vector< unsigned long int >& items ) const
+{
+   unsigned long int tile = findTile ( point );
+   
+   if ( tile == NoTile )
+   {
+      return;
+   }
+   
+   for ( unsigned long int i = index_offsets[ tile ]; i < index_offsets[ tile + 1 ]; i++ )
+   {
+      if ( index_item_bounds[ index_items[ i ] ].contains ( point ) )
+      {
+         items.push_back ( index_items[ i ] );
+      }
+   }
+   
+   return;
+}
+
+unsigned long int OpenCIF::SpatialIndex::findColumn ( const long int& x ) const
+{
+   long int column = ( x - index_bounds.getLeft () ) / (long int)( index_tile_size );
+   
+   return ( (unsigned long int)( std::max ( 0L , std::min ( column , (long int)( index_columns ) - 1 ) ) ) );
+}
+
+unsigned long int OpenCIF::SpatialIndex::findRow ( const long int& y ) const
+{
+   long int row = ( y - index_bounds.getBottom () ) / (long int)( index_tile_size );
+   
+   return ( (unsigned long int)( std::max ( 0L , std::min ( row , (long int)( index_rows ) - 1 ) ) ) );
+}
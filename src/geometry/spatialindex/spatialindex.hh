@@ -0,0 +1,91 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_SPATIALINDEX_HH_
+# define LIBOPENCIF_SPATIALINDEX_HH_
+
+# include <vector>
+
+# include "../../command/point/point.hh"
+# include "../rectangle/rectangle.hh"
+# include "../shape/shape.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class finds the shapes (or rectangles) near a place, using a grid of
+    * square tiles over the bounding box of every item. An item is kept in
+    * every tile it touches, so the tiles can be processed independently (by
+    * different threads, for example).
+    *
+    * An item that touches several tiles is found in all of them. To visit a
+    * pair of items only once, a tile can own the pair if it contains the
+    * lower left corner of the intersection of their bounding boxes (see
+    * findTile).
+    *
+    * The items are referred by their index in the list given to build the
+    * index, and the list is not kept.
+    */
+   class SpatialIndex
+   {
+      public:
+         static const unsigned long int NoTile;
+      
+      public:
+         explicit SpatialIndex ( void );
+         virtual ~SpatialIndex ( void );
+         
+         void build ( const std::vector< OpenCIF::Shape >& shapes , const unsigned long int& tile_size = 0 );
+         void build ( const std::vector< OpenCIF::Rectangle >& rectangles , const unsigned long int& tile_size = 0 );
+         void clear ( void );
+         
+         const OpenCIF::Rectangle& getBounds ( void ) const;
+         unsigned long int getTileSize ( void ) const;
+         unsigned long int getColumns ( void ) const;
+         unsigned long int getRows ( void ) const;
+         unsigned long int getTileAmount ( void ) const;
+         unsigned long int getItemAmount ( void ) const;
+         const OpenCIF::Rectangle& getItemBounds ( const unsigned long int& item ) const;
+         OpenCIF::Rectangle getTileRectangle ( const unsigned long int& tile ) const;
+         
+         void getTileItems ( const unsigned long int& tile , std::vector< unsigned long int >& items ) const;
+         unsigned long int findTile ( const OpenCIF::Point& point ) const;
+         void query ( const OpenCIF::Rectangle& window , std::vector< unsigned long int >& items ) const;
+         void query ( const OpenCIF::Point& point , std::vector< unsigned long int >& items ) const;
+      
+      private:
+         unsigned long int findColumn ( const long int& x ) const;
+         unsigned long int findRow ( const long int& y ) const;
+      
+      private:
+         OpenCIF::Rectangle index_bounds;
+         unsigned long int index_tile_size;
+         unsigned long int index_columns;
+         unsigned long int index_rows;
+         std::vector< OpenCIF::Rectangle > index_item_bounds;
+         std::vector< unsigned long int > index_offsets;
+         std::vector< unsigned long int > index_items;
+   };
+}
+
+# endif
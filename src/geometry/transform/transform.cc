@@ -0,0 +1,356 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <cmath>
+# include <limits>
+# include <utility>
+
+# include "transform.hh"
+
+namespace
+{
+   bool isInteger ( const double& value )
+   {
+      return ( std::floor ( value ) == value );
+   }
+   
+   /*
+    * Largest integer whose neighbours can be represented as doubles. The
+    * integer coefficients larger than it are not exact.
+    */
+   const double ExactLimit = 9007199254740992.0; // 2^53
+   
+   /*
+    * Largest value that std::lround can convert to a long int.
+    */
+   const double RoundLimit = (double)( std::numeric_limits< long int >::max () / 2 ) * 2 - 1024;
+   
+   /*
+    * Function to round a coordinate, saturated to the range of a long int
+    * (the Point class saturates it to the range it can store).
+    */
+   long int roundCoordinate ( const double& value )
+   {
+      if ( value > RoundLimit )
+      {
+         return ( std::numeric_limits< long int >::max () );
+      }
+      
+      if ( value < -RoundLimit )
+      {
+         return ( std::numeric_limits< long int >::min () );
+      }
+      
+      return ( std::lround ( value ) );
+   }
+   
+   /*
+    * Function to know if a coefficient of a composition is usable: finite,
+    * and exact if the coefficients composed were integers.
+    */
+   bool isExact ( const double& value , const bool& integer )
+   {
+      return ( std::isfinite ( value ) && ( !integer || std::fabs ( value ) <= ExactLimit ) );
+   }
+}
+
+/*
+ * Default constructor. The identity transformation.
+ */
+OpenCIF::Transform::Transform ( void )
+   : transform_a ( 1 ) , transform_b ( 0 ) , transform_c ( 0 ) , transform_d ( 1 ) , transform_dx ( 0 ) , transform_dy ( 0 )
+{
+}
+
+/*
+ * Non-default constructor. Initialize the coefficients of the
+ * transformation.
+ */
+OpenCIF::Transform::Transform ( const double& new_a , const double& new_b , const double& new_c , const double& new_d ,
+                                const double& new_dx , const double& new_dy )
+   : transform_a ( new_a ) , transform_b ( new_b ) , transform_c ( new_c ) , transform_d ( new_d ) , transform_dx ( new_dx ) , transform_dy ( new_dy )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Transform::~Transform ( void )
+{
+}
+
+double OpenCIF::Transform::getA ( void ) const
+{
+   return ( transform_a );
+}
+
+double OpenCIF::Transform::getB ( void ) const
+{
+   return ( transform_b );
+}
+
+double OpenCIF::Transform::getC ( void ) const
+{
+   return ( transform_c );
+}
+
+double OpenCIF::Transform::getD ( void ) const
+{
+   return ( transform_d );
+}
+
+double OpenCIF::Transform::getDX ( void ) const
+{
+   return ( transform_dx );
+}
+
+double OpenCIF::Transform::getDY ( void ) const
+{
+   return ( transform_dy );
+}
+
+bool OpenCIF::Transform::isIdentity ( void ) const
+{
+   return ( transform_a == 1 && transform_b == 0 && transform_c == 0 && transform_d == 1 && transform_dx == 0 && transform_dy == 0 );
+}
+
+/*
+ * Member function to know if horizontal and vertical lines stay horizontal
+ * or vertical after the transformation.
+ */
+bool OpenCIF::Transform::isOrthogonal ( void ) const
+{
+   return ( ( transform_b == 0 && transform_c == 0 ) || ( transform_a == 0 && transform_d == 0 ) );
+}
+
+/*
+ * Member function to know if integer points are transformed into integer
+ * points, without rounding.
+ */
+bool OpenCIF::Transform::isInteger ( void ) const
+{
+   return ( ::isInteger ( transform_a ) && ::isInteger ( transform_b ) && ::isInteger ( transform_c ) && ::isInteger ( transform_d ) &&
+            ::isInteger ( transform_dx ) && ::isInteger ( transform_dy ) );
+}
+
+/*
+ * Operator to compose two transformations. The result applies the given
+ * transformation first, and then this one.
+ */
+OpenCIF::Transform OpenCIF::Transform::operator* ( const OpenCIF::Transform& transform ) const
+{
+   return ( OpenCIF::Transform ( transform_a * transform.transform_a + transform_b * transform.transform_c ,
+                                 transform_a * transform.transform_b + transform_b * transform.transform_d ,
+                                 transform_c * transform.transform_a + transform_d * transform.transform_c ,
+                                 transform_c * transform.transform_b + transform_d * transform.transform_d ,
+                                 transform_a * transform.transform_dx + transform_b * transform.transform_dy + transform_dx ,
+                                 transform_c * transform.transform_dx + transform_d * transform.transform_dy + transform_dy ) );
+}
+
+/*
+ * Member function to compose two transformations, like the operator does,
+ * checking the result. Returns false if a coefficient of the result is not
+ * finite, or if both transformations have integer coefficients and the
+ * result has coefficients too large to be exact. The result is set anyway.
+ */
+bool OpenCIF::Transform::compose ( const OpenCIF::Transform& transform , OpenCIF::Transform& result ) const
+{
+   bool integer = isInteger () && transform.isInteger ();
+   
+   result = *this * transform;
+   
+   return ( ::isExact ( result.transform_a , integer ) && ::isExact ( result.transform_b , integer ) &&
+            ::isExact ( result.transform_c , integer ) && ::isExact ( result.transform_d , integer ) &&
+            ::isExact ( result.transform_dx , integer ) && ::isExact ( result.transform_dy , integer ) );
+}
+
+/*
+ * Member function to know if the corners of a rectangle are transformed into
+ * coordinates that the Point class can store, without saturating them.
+ */
+bool OpenCIF::Transform::fits ( const OpenCIF::Rectangle& rectangle ) const
+{
+   if ( rectangle.isEmpty () )
+   {
+      return ( true );
+   }
+   
+   double xs[ 2 ] = { (double)( rectangle.getLeft () ) , (double)( rectangle.getRight () ) };
+   double ys[ 2 ] = { (double)( rectangle.getBottom () ) , (double)( rectangle.getTop () ) };
+   double minimum = (double)( OpenCIF::Point::Minimum ) - 0.5;
+   double maximum = (double)( OpenCIF::Point::Maximum ) + 0.5;
+   
+   for ( unsigned int i = 0; i < 2; i++ )
+   {
+      for ( unsigned int j = 0; j < 2; j++ )
+      {
+         double x = transform_a * xs[ i ] + transform_b * ys[ j ] + transform_dx;
+         double y = transform_c * xs[ i ] + transform_d * ys[ j ] + transform_dy;
+         
+         if ( !( x > minimum && x < maximum && y > minimum && y < maximum ) )
+         {
+            return ( false );
+         }
+      }
+   }
+   
+   return ( true );
+}
+
+OpenCIF::Point OpenCIF::Transform::apply ( const OpenCIF::Point& point ) const
+{
+   double x = point.getX ();
+   double y = point.getY ();
+   
+   return ( OpenCIF::Point ( ::roundCoordinate ( transform_a * x + transform_b * y + transform_dx ) ,
+                             ::roundCoordinate ( transform_c * x + transform_d * y + transform_dy ) ) );
+}
+
+/*
+ * Member function to return the bounding box of a transformed rectangle.
+ */
+OpenCIF::Rectangle OpenCIF::Transform::apply ( const OpenCIF::Rectangle& rectangle ) const
+{
+   OpenCIF::Rectangle result;
+   
+   if ( rectangle.isEmpty () )
+   {
+      return ( result );
+   }
+   
+   result.add ( apply ( OpenCIF::Point ( rectangle.getLeft () , rectangle.getBottom () ) ) );
+   result.add ( apply ( OpenCIF::Point ( rectangle.getRight () , rectangle.getBottom () ) ) );
+   result.add ( apply ( OpenCIF::Point ( rectangle.getRight () , rectangle.getTop () ) ) );
+   result.add ( apply ( OpenCIF::Point ( rectangle.getLeft () , rectangle.getTop () ) ) );
+   
+   return ( result );
+}
+
+OpenCIF::Shape OpenCIF::Transform::apply ( const OpenCIF::Shape& shape ) const
+{
+   if ( shape.isRectangle () && isOrthogonal () )
+   {
+      return ( OpenCIF::Shape ( shape.getLayerID () , apply ( shape.getBounds () ) ) );
+   }
+   
+   const std::vector< OpenCIF::Point >& points = shape.getPoints ();
+   std::vector< OpenCIF::Point > transformed;
+   
+   transformed.reserve ( points.size () );
+   
+   for ( unsigned long int i = 0; i < points.size (); i++ )
+   {
+      transformed.push_back ( apply ( points[ i ] ) );
+   }
+   
+   return ( OpenCIF::Shape ( shape.getLayerID () , std::move ( transformed ) ) );
+}
+
+/*
+ * Static member function to convert a single transformation of a call.
+ * The mirroring in X changes the sign of the X coordinates, and the rotation
+ * turns the X axis to the direction given.
+ */
+OpenCIF::Transform OpenCIF::Transform::fromTransformation ( const OpenCIF::Transformation& transformation )
+{
+   switch ( transformation.getType () )
+   {
+      case OpenCIF::Transformation::Displacement:
+         return ( OpenCIF::Transform ( 1 , 0 , 0 , 1 , transformation.getDisplacement ().getX () , transformation.getDisplacement ().getY () ) );
+      
+      case OpenCIF::Transformation::HorizontalMirroring:
+         return ( OpenCIF::Transform ( -1 , 0 , 0 , 1 , 0 , 0 ) );
+      
+      case OpenCIF::Transformation::VerticalMirroring:
+         return ( OpenCIF::Transform ( 1 , 0 , 0 , -1 , 0 , 0 ) );
+      
+      case OpenCIF::Transformation::Rotation:
+      {
+         double x = transformation.getRotation ().getX ();
+         double y = transformation.getRotation ().getY ();
+         
+         // Keep the rotations by multiples of 90 degrees exact.
+         if ( x == 0 && y == 0 )
+         {
+            return ( OpenCIF::Transform () );
+         }
+         
+         if ( x == 0 || y == 0 )
+         {
+            x = ( x > 0 ) - ( x < 0 );
+            y = ( y > 0 ) - ( y < 0 );
+         }
+         else
+         {
+            double norm = std::sqrt ( x * x + y * y );
+            
+            x /= norm;
+            y /= norm;
+         }
+         
+         return ( OpenCIF::Transform ( x , -y , y , x , 0 , 0 ) );
+      }
+   }
+   
+   return ( OpenCIF::Transform () );
+}
+
+/*
+ * Static member function to compose the list of transformations of a call.
+ * The transformations are applied in the order of the list.
+ */
+OpenCIF::Transform OpenCIF::Transform::fromTransformations ( const std::vector< OpenCIF::Transformation >& transformations )
+{
+   OpenCIF::Transform transform;
+   
+   for ( unsigned long int i = 0; i < transformations.size (); i++ )
+   {
+      transform = fromTransformation ( transformations[ i ] ) * transform;
+   }
+   
+   return ( transform );
+}
+
+/*
+ * Static member function to convert the scale of a definition (A/B). A
+ * fraction with denominator 0 is ignored.
+ */
+OpenCIF::Transform OpenCIF::Transform::fromScale ( const OpenCIF::Fraction& scale )
+{
+   if ( scale.getDenominator () == 0 || scale.getNumerator () == scale.getDenominator () )
+   {
+      return ( OpenCIF::Transform () );
+   }
+   
+   double factor = (double)( scale.getNumerator () ) / (double)( scale.getDenominator () );
+   
+   return ( OpenCIF::Transform ( factor , 0 , 0 , factor , 0 , 0 ) );
+}
+
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Transform& transform )
+{
+   output_stream << transform.transform_a << " " << transform.transform_b << " " << transform.transform_c << " " << transform.transform_d << " "
+                 << transform.transform_dx << " " << transform.transform_dy;
+   
+   return ( output_stream );
+}
@@ -0,0 +1,105 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_TRANSFORM_HH_
+# define LIBOPENCIF_TRANSFORM_HH_
+
+# include <iostream>
+# include <vector>
+
+# include "../../command/point/point.hh"
+# include "../../command/fraction/fraction.hh"
+# include "../../command/transformation/transformation.hh"
+# include "../rectangle/rectangle.hh"
+# include "../shape/shape.hh"
+
+namespace OpenCIF { class Transform; }
+std::ostream& operator<< ( std::ostream& output_stream , const OpenCIF::Transform& transform );
+
+namespace OpenCIF
+{
+   /*
+    * This class represents an affine transformation of the plane:
+    *
+    *    x' = a * x + b * y + dx
+    *    y' = c * x + d * y + dy
+    *
+    * It's used to place the contents of a symbol where it's called: the list
+    * of transformations of a call (displacements, rotations and mirrorings)
+    * and the scale of a definition (A/B) are composed into a single instance.
+    *
+    * The results are rounded to the nearest integer. When the transformation
+    * only rotates by multiples of 90 degrees, mirrors and displaces using
+    * integers, it's exact, and Manhattan shapes stay Manhattan.
+    *
+    * The coefficients are doubles, so composing many transformations can't
+    * overflow, but integer coefficients larger than 2^53 are not exact any
+    * more: compose reports it. The points transformed are saturated to the
+    * range of the coordinates of the Point class; fits tells if a rectangle
+    * can be transformed without saturating.
+    */
+   class Transform
+   {
+      public:
+         explicit Transform ( void );
+         explicit Transform ( const double& new_a , const double& new_b , const double& new_c , const double& new_d ,
+                              const double& new_dx , const double& new_dy );
+         virtual ~Transform ( void );
+         
+         double getA ( void ) const;
+         double getB ( void ) const;
+         double getC ( void ) const;
+         double getD ( void ) const;
+         double getDX ( void ) const;
+         double getDY ( void ) const;
+         
+         bool isIdentity ( void ) const;
+         bool isOrthogonal ( void ) const;
+         bool isInteger ( void ) const;
+         
+         OpenCIF::Transform operator* ( const OpenCIF::Transform& transform ) const;
+         bool compose ( const OpenCIF::Transform& transform , OpenCIF::Transform& result ) const;
+         bool fits ( const OpenCIF::Rectangle& rectangle ) const;
+         
+         OpenCIF::Point apply ( const OpenCIF::Point& point ) const;
+         OpenCIF::Rectangle apply ( const OpenCIF::Rectangle& rectangle ) const;
+         OpenCIF::Shape apply ( const OpenCIF::Shape& shape ) const;
+         
+         friend std::ostream& (::operator<<) ( std::ostream& output_stream , const Transform& transform );
+      
+      public:
+         static OpenCIF::Transform fromTransformation ( const OpenCIF::Transformation& transformation );
+         static OpenCIF::Transform fromTransformations ( const std::vector< OpenCIF::Transformation >& transformations );
+         static OpenCIF::Transform fromScale ( const OpenCIF::Fraction& scale );
+      
+      private:
+         double transform_a;
+         double transform_b;
+         double transform_c;
+         double transform_d;
+         double transform_dx;
+         double transform_dy;
+   };
+}
+
+# endif
@@ -0,0 +1,629 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <algorithm>
+# include <cstdlib>
+# include <cstring>
+# include <map>
+# include <memory>
+# include <string>
+# include <unordered_map>
+
+# include "deduplicator.hh"
+# include "../../command/controlcommand/callcommand/callcommand.hh"
+# include "../../command/primitivecommand/positionbasedcommand/boxcommand/boxcommand.hh"
+# include "../../command/primitivecommand/positionbasedcommand/roundflashcommand/roundflashcommand.hh"
+# include "../../command/primitivecommand/pathbasedcommand/polygoncommand/polygoncommand.hh"
+# include "../../command/primitivecommand/pathbasedcommand/wirecommand/wirecommand.hh"
+# include "../../command/rawcontentcommand/userextensioncommand/userextensioncommand.hh"
+# include "../../threadpool/threadpool.hh"
+
+namespace
+{
+   /*
+    * Contents of a symbol: the keys of its primitives and user extensions
+    * (sorted and joined), and their hash.
+    */
+   struct DeduplicatorSymbol
+   {
+      std::string contents;
+      unsigned long long int hash;
+   };
+   
+   /*
+    * Function to add a number to a key, byte by byte.
+    */
+   void add ( std::string& key , const long long int& value )
+   {
+      char bytes[ sizeof ( value ) ];
+      
+      std::memcpy ( bytes , &value , sizeof ( value ) );
+      key.append ( bytes , sizeof ( value ) );
+      
+      return;
+   }
+   
+   void add ( std::string& key , const double& value )
+   {
+      char bytes[ sizeof ( value ) ];
+      
+      // Both zeros are the same.
+      double number = ( value == 0 ) ? 0.0 : value;
+      
+      std::memcpy ( bytes , &number , sizeof ( number ) );
+      key.append ( bytes , sizeof ( number ) );
+      
+      return;
+   }
+   
+   /*
+    * Function to add a list of points to a key, starting at a point and
+    * going forward or backward.
+    */
+   void add ( std::string& key , const std::vector< OpenCIF::Point >& points , const unsigned long int& first , const bool& forward )
+   {
+      for ( unsigned long int i = 0; i < points.size (); i++ )
+      {
+         const OpenCIF::Point& point = points[ forward ? ( first + i ) % points.size () : ( first + points.size () - i ) % points.size () ];
+         
+         add ( key , (long long int)( point.getX () ) );
+         add ( key , (long long int)( point.getY () ) );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to compare two lists of points, both starting at a point, and
+    * going forward or backward.
+    */
+   bool isBefore ( const std::vector< OpenCIF::Point >& points , const unsigned long int& first , const bool& first_forward ,
+                   const unsigned long int& second , const bool& second_forward )
+   {
+      unsigned long int amount = points.size ();
+      
+      for ( unsigned long int i = 0; i < amount; i++ )
+      {
+         const OpenCIF::Point& a = points[ first_forward ? ( first + i ) % amount : ( first + amount - i ) % amount ];
+         const OpenCIF::Point& b = points[ second_forward ? ( second + i ) % amount : ( second + amount - i ) % amount ];
+         
+         if ( a.getX () != b.getX () || a.getY () != b.getY () )
+         {
+            return ( a.getX () < b.getX () || ( a.getX () == b.getX () && a.getY () < b.getY () ) );
+         }
+      }
+      
+      return ( false );
+   }
+   
+   /*
+    * Function to find the key of a primitive. A polygon is the same if it
+    * starts at any point, or goes the other way, and a wire is the same if
+    * it's reversed, so they start at their first point (and go the way)
+    * that gives the smallest list.
+    */
+   std::string primitiveKey ( OpenCIF::Command* command )
+   {
+      std::string key;
+      
+      add ( key , (long long int)( command->type () ) );
+      
+      switch ( command->type () )
+      {
+         case OpenCIF::Command::Box:
+         {
+            OpenCIF::BoxCommand* box = static_cast< OpenCIF::BoxCommand* > ( command );
+            long long int x = box->getRotation ().getX ();
+            long long int y = box->getRotation ().getY ();
+            long long int width = box->getSize ().getWidth ();
+            long long int height = box->getSize ().getHeight ();
+            long long int divisor = 0;
+            
+            // The direction is kept as the smallest vector, pointing to the right (or up).
+            for ( long long int a = std::llabs ( x ) , b = std::llabs ( y ); ; )
+            {
+               if ( b == 0 )
+               {
+                  divisor = a;
+                  break;
+               }
+               
+               long long int rest = a % b;
+               
+               a = b;
+               b = rest;
+            }
+            
+            if ( divisor > 0 )
+            {
+               x /= divisor;
+               y /= divisor;
+            }
+            
+            if ( x < 0 || ( x == 0 && y < 0 ) )
+            {
+               x = -x;
+               y = -y;
+            }
+            
+            // A vertical box is a horizontal box, with the sides swapped.
+            if ( x == 0 && y == 1 )
+            {
+               std::swap ( width , height );
+               x = 1;
+               y = 0;
+            }
+            
+            add ( key , (long long int)( box->getLayerID () ) );
+            add ( key , width );
+            add ( key , height );
+            add ( key , (long long int)( box->getPosition ().getX () ) );
+            add ( key , (long long int)( box->getPosition ().getY () ) );
+            add ( key , x );
+            add ( key , y );
+            break;
+         }
+         
+         case OpenCIF::Command::RoundFlash:
+         {
+            OpenCIF::RoundFlashCommand* flash = static_cast< OpenCIF::RoundFlashCommand* > ( command );
+            
+            add ( key , (long long int)( flash->getLayerID () ) );
+            add ( key , (long long int)( flash->getDiameter () ) );
+            add ( key , (long long int)( flash->getPosition ().getX () ) );
+            add ( key , (long long int)( flash->getPosition ().getY () ) );
+            break;
+         }
+         
+         case OpenCIF::Command::Polygon:
+         {
+            OpenCIF::PolygonCommand* polygon = static_cast< OpenCIF::PolygonCommand* > ( command );
+            const std::vector< OpenCIF::Point >& points = polygon->getPoints ();
+            unsigned long int best = 0;
+            bool forward = true;
+            
+            for ( unsigned long int i = 0; i < points.size (); i++ )
+            {
+               if ( isBefore ( points , i , true , best , forward ) )
+               {
+                  best = i;
+                  forward = true;
+               }
+               
+               if ( isBefore ( points , i , false , best , forward ) )
+               {
+                  best = i;
+                  forward = false;
+               }
+            }
+            
+            add ( key , (long long int)( polygon->getLayerID () ) );
+            add ( key , points , best , forward );
+            break;
+         }
+         
+         case OpenCIF::Command::Wire:
+         {
+            OpenCIF::WireCommand* wire = static_cast< OpenCIF::WireCommand* > ( command );
+            const std::vector< OpenCIF::Point >& points = wire->getPoints ();
+            bool forward = true;
+            
+            for ( unsigned long int i = 0 , j = points.size (); i + 1 < j; i++ , j-- )
+            {
+               const OpenCIF::Point& a = points[ i ];
+               const OpenCIF::Point& b = points[ j - 1 ];
+               
+               if ( a.getX () != b.getX () || a.getY () != b.getY () )
+               {
+                  forward = ( a.getX () < b.getX () || ( a.getX () == b.getX () && a.getY () < b.getY () ) );
+                  break;
+               }
+            }
+            
+            add ( key , (long long int)( wire->getLayerID () ) );
+            add ( key , (long long int)( wire->getWidth () ) );
+            add ( key , points , forward ? 0 : points.size () - 1 , forward );
+            break;
+         }
+         
+         case OpenCIF::Command::UserExtension:
+            key += static_cast< OpenCIF::UserExtensionCommand* > ( command )->getContent ();
+            break;
+         
+         default:
+            break;
+      }
+      
+      return ( key );
+   }
+   
+   /*
+    * Function to know if a user extension gives the name of the symbol.
+    */
+   bool isName ( OpenCIF::Command* command )
+   {
+      const std::string& content = static_cast< OpenCIF::UserExtensionCommand* > ( command )->getContent ();
+      
+      return ( content.size () >= 2 && content[ 0 ] == '9' && ( content[ 1 ] == ' ' || content[ 1 ] == '\t' ) );
+   }
+   
+   /*
+    * Function to join a list of keys, sorted, adding the size of every key
+    * so two lists can't give the same result.
+    */
+   std::string join ( std::vector< std::string >& keys )
+   {
+      std::string joined;
+      
+      std::sort ( keys.begin () , keys.end () );
+      
+      for ( unsigned long int i = 0; i < keys.size (); i++ )
+      {
+         add ( joined , (long long int)( keys[ i ].size () ) );
+         joined += keys[ i ];
+      }
+      
+      return ( joined );
+   }
+   
+   /*
+    * Function to compute the FNV-1a hash of a key, starting from a previous
+    * hash.
+    */
+   unsigned long long int hash ( const std::string& key , unsigned long long int value = 14695981039346656037ULL )
+   {
+      for ( unsigned long int i = 0; i < key.size (); i++ )
+      {
+         value ^= (unsigned char)( key[ i ] );
+         value *= 1099511628211ULL;
+      }
+      
+      return ( value );
+   }
+   
+   /*
+    * Function to find the symbol that every symbol is the same as (itself,
+    * if it's unique). The symbols are classified bottom-up, since two calls
+    * are the same if they call the same class.
+    */
+   std::vector< unsigned long int > classify ( const OpenCIF::Hierarchy& hierarchy , const std::vector< DeduplicatorSymbol >& symbols ,
+                                               const std::vector< bool >& allowed , std::vector< unsigned long long int >& hashes )
+   {
+      std::vector< unsigned long int > classes ( hierarchy.getSymbolAmount () );
+      std::vector< unsigned long int > order = hierarchy.getOrder ();
+      std::vector< std::string > keys ( hierarchy.getSymbolAmount () );
+      std::unordered_map< unsigned long long int , std::vector< unsigned long int > > found;
+      std::vector< std::string > calls;
+      std::vector< std::string > hashed_calls;
+      
+      hashes.resize ( hierarchy.getSymbolAmount () );
+      
+      for ( unsigned long int i = 0; i < order.size (); i++ )
+      {
+         const OpenCIF::Symbol& symbol = hierarchy.getSymbol ( order[ i ] );
+         const std::vector< OpenCIF::Instance >& instances = symbol.getInstances ();
+         std::string& key = keys[ order[ i ] ];
+         std::string scale;
+         
+         calls.clear ();
+         hashed_calls.clear ();
+         
+         // The calls are compared using the class of the symbol called, and hashed using its hash.
+         for ( unsigned long int j = 0; j < instances.size (); j++ )
+         {
+            const OpenCIF::Transform& transform = instances[ j ].getTransform ();
+            std::string placement;
+            
+            add ( placement , transform.getA () );
+            add ( placement , transform.getB () );
+            add ( placement , transform.getC () );
+            add ( placement , transform.getD () );
+            add ( placement , transform.getDX () );
+            add ( placement , transform.getDY () );
+            calls.push_back ( std::string () );
+            add ( calls.back () , (long long int)( classes[ instances[ j ].getSymbol () ] ) );
+            calls.back () += placement;
+            hashed_calls.push_back ( std::string () );
+            add ( hashed_calls.back () , (long long int)( hashes[ instances[ j ].getSymbol () ] ) );
+            hashed_calls.back () += placement;
+         }
+         
+         add ( scale , symbol.getScale ().getA () );
+         key = scale;
+         add ( key , (long long int)( symbols[ order[ i ] ].contents.size () ) );
+         key += symbols[ order[ i ] ].contents;
+         key += join ( calls );
+         
+         hashes[ order[ i ] ] = hash ( join ( hashed_calls ) , hash ( scale , symbols[ order[ i ] ].hash ) );
+         classes[ order[ i ] ] = order[ i ];
+         
+         if ( !allowed[ order[ i ] ] )
+         {
+            continue;
+         }
+         
+         std::vector< unsigned long int >& candidates = found[ hashes[ order[ i ] ] ];
+         
+         for ( unsigned long int j = 0; j < candidates.size (); j++ )
+         {
+            if ( keys[ candidates[ j ] ] == key )
+            {
+               classes[ order[ i ] ] = candidates[ j ];
+               break;
+            }
+         }
+         
+         if ( classes[ order[ i ] ] == order[ i ] )
+         {
+            candidates.push_back ( order[ i ] );
+         }
+      }
+      
+      // The symbol kept in every class is the one defined first.
+      std::vector< unsigned long int > first ( hierarchy.getSymbolAmount () , hierarchy.getSymbolAmount () );
+      
+      for ( unsigned long int i = 0; i < classes.size (); i++ )
+      {
+         first[ classes[ i ] ] = std::min ( first[ classes[ i ] ] , i );
+      }
+      
+      for ( unsigned long int i = 0; i < classes.size (); i++ )
+      {
+         classes[ i ] = first[ classes[ i ] ];
+      }
+      
+      return ( classes );
+   }
+   
+   /*
+    * Function to compute the contents of every symbol, in parallel.
+    */
+   std::vector< DeduplicatorSymbol > describe ( const std::vector< OpenCIF::Command* >& commands , const OpenCIF::Hierarchy& hierarchy ,
+                                                const unsigned long int& thread_amount )
+   {
+      std::vector< DeduplicatorSymbol > symbols ( hierarchy.getSymbolAmount () );
+      OpenCIF::ThreadPool pool ( thread_amount );
+      
+      pool.parallelFor ( symbols.size () , [ & ] ( unsigned long int first , unsigned long int last )
+      {
+         std::vector< std::string > keys;
+         
+         for ( unsigned long int i = first; i < last; i++ )
+         {
+            const OpenCIF::Symbol& symbol = hierarchy.getSymbol ( i );
+            unsigned long int end = std::min ( symbol.getEnd () , (unsigned long int)( commands.size () ) );
+            
+            keys.clear ();
+            
+            for ( unsigned long int j = symbol.getBegin () + 1; j < end; j++ )
+            {
+               switch ( commands[ j ]->type () )
+               {
+                  case OpenCIF::Command::Box:
+                  case OpenCIF::Command::RoundFlash:
+                  case OpenCIF::Command::Polygon:
+                  case OpenCIF::Command::Wire:
+                     keys.push_back ( primitiveKey ( commands[ j ] ) );
+                     break;
+                  
+                  case OpenCIF::Command::UserExtension:
+                     if ( !isName ( commands[ j ] ) )
+                     {
+                        keys.push_back ( primitiveKey ( commands[ j ] ) );
+                     }
+                     break;
+                  
+                  default:
+                     break;
+               }
+            }
+            
+            symbols[ i ].contents = join ( keys );
+            symbols[ i ].hash = hash ( symbols[ i ].contents );
+         }
+      } );
+      
+      return ( symbols );
+   }
+}
+
+/*
+ * Default constructor. The amount of threads is chosen using the hardware.
+ */
+OpenCIF::Deduplicator::Deduplicator ( void )
+   : deduplicator_thread_amount ( 0 ) , deduplicator_removed_symbols ( 0 ) , deduplicator_removed_commands ( 0 ) ,
+     deduplicator_reclaimed_memory ( 0 )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Deduplicator::~Deduplicator ( void )
+{
+}
+
+/*
+ * Member function to set the amount of threads used. With 0, the amount of
+ * threads is chosen using the hardware.
+ */
+void OpenCIF::Deduplicator::setThreadAmount ( const unsigned long int& new_thread_amount )
+{
+   deduplicator_thread_amount = new_thread_amount;
+   
+   return;
+}
+
+unsigned long int OpenCIF::Deduplicator::getThreadAmount ( void ) const
+{
+   return ( deduplicator_thread_amount );
+}
+
+/*
+ * Member function to compute the hash of the contents of every symbol of a
+ * hierarchy. Two symbols that are the same have the same hash.
+ */
+std::vector< unsigned long long int > OpenCIF::Deduplicator::computeHashes ( const std::vector< OpenCIF::Command* >& commands ,
+                                                                            const OpenCIF::Hierarchy& hierarchy ) const
+{
+   std::vector< unsigned long long int > hashes;
+   
+   classify ( hierarchy , describe ( commands , hierarchy , deduplicator_thread_amount ) , std::vector< bool > ( hierarchy.getSymbolAmount () , false ) ,
+              hashes );
+   
+   return ( hashes );
+}
+
+/*
+ * Member function to remove the symbols that are the same as another one.
+ * The commands removed are deleted. Returns the amount of symbols removed.
+ */
+unsigned long int OpenCIF::Deduplicator::deduplicate ( std::vector< OpenCIF::Command* >& commands )
+{
+   OpenCIF::Hierarchy hierarchy ( commands );
+   std::map< unsigned long int , unsigned long int > definitions;
+   std::vector< bool > allowed ( hierarchy.getSymbolAmount () , true );
+   std::vector< unsigned long long int > hashes;
+   
+   deduplicator_removed_symbols = 0;
+   deduplicator_removed_commands = 0;
+   deduplicator_reclaimed_memory = 0;
+   
+   for ( unsigned long int i = 0; i < commands.size (); i++ )
+   {
+      if ( commands[ i ]->type () == OpenCIF::Command::DefinitionDelete )
+      {
+         return ( 0 );
+      }
+   }
+   
+   for ( unsigned long int i = 0; i < hierarchy.getSymbolAmount (); i++ )
+   {
+      definitions[ hierarchy.getSymbol ( i ).getID () ]++;
+   }
+   
+   for ( unsigned long int i = 0; i < hierarchy.getSymbolAmount (); i++ )
+   {
+      const OpenCIF::Symbol& symbol = hierarchy.getSymbol ( i );
+      
+      allowed[ i ] = ( definitions[ symbol.getID () ] == 1 && symbol.getEnd () != OpenCIF::Symbol::NoCommand );
+   }
+   
+   std::vector< unsigned long int > classes = classify ( hierarchy , describe ( commands , hierarchy , deduplicator_thread_amount ) , allowed , hashes );
+   std::vector< bool > removed ( commands.size () , false );
+   
+   // The calls to a removed symbol call the symbol kept.
+   for ( unsigned long int i = 0; i <= hierarchy.getSymbolAmount (); i++ )
+   {
+      const OpenCIF::Symbol& symbol = ( i < hierarchy.getSymbolAmount () ) ? hierarchy.getSymbol ( i ) : hierarchy.getTop ();
+      const std::vector< OpenCIF::Instance >& instances = symbol.getInstances ();
+      
+      for ( unsigned long int j = 0; j < instances.size (); j++ )
+      {
+         unsigned long int kept = classes[ instances[ j ].getSymbol () ];
+         
+         if ( kept != instances[ j ].getSymbol () )
+         {
+            static_cast< OpenCIF::CallCommand* > ( commands[ instances[ j ].getCommand () ] )->setID ( hierarchy.getSymbol ( kept ).getID () );
+         }
+      }
+   }
+   
+   for ( unsigned long int i = 0; i < hierarchy.getSymbolAmount (); i++ )
+   {
+      if ( classes[ i ] == i )
+      {
+         continue;
+      }
+      
+      const OpenCIF::Symbol& symbol = hierarchy.getSymbol ( i );
+      
+      for ( unsigned long int j = symbol.getBegin (); j <= symbol.getEnd (); j++ )
+      {
+         removed[ j ] = true;
+      }
+      
+      deduplicator_removed_symbols++;
+   }
+   
+   unsigned long int kept = 0;
+   
+   for ( unsigned long int i = 0; i < commands.size (); i++ )
+   {
+      if ( removed[ i ] )
+      {
+         deduplicator_removed_commands++;
+         deduplicator_reclaimed_memory += OpenCIF::File::commandMemory ( commands[ i ] ) + sizeof ( OpenCIF::Command* );
+         delete commands[ i ];
+      }
+      else
+      {
+         commands[ kept++ ] = commands[ i ];
+      }
+   }
+   
+   commands.resize ( kept );
+   
+   return ( deduplicator_removed_symbols );
+}
+
+/*
+ * Member function to remove the symbols of a file that are the same as
+ * another one.
+ */
+unsigned long int OpenCIF::Deduplicator::deduplicate ( OpenCIF::File& file )
+{
+   std::vector< std::unique_ptr< OpenCIF::Command > > released = file.releaseCommands ();
+   std::vector< OpenCIF::Command* > commands;
+   
+   commands.reserve ( released.size () );
+   
+   for ( unsigned long int i = 0; i < released.size (); i++ )
+   {
+      commands.push_back ( released[ i ].release () );
+   }
+   
+   deduplicate ( commands );
+   file.setCommands ( std::move ( commands ) );
+   
+   return ( deduplicator_removed_symbols );
+}
+
+unsigned long int OpenCIF::Deduplicator::getRemovedSymbols ( void ) const
+{
+   return ( deduplicator_removed_symbols );
+}
+
+unsigned long int OpenCIF::Deduplicator::getRemovedCommands ( void ) const
+{
+   return ( deduplicator_removed_commands );
+}
+
+/*
+ * Member function to get an estimation of the memory released by the last
+ * deduplication, in bytes: the commands removed and the lists they owned.
+ */
+unsigned long int OpenCIF::Deduplicator::getReclaimedMemory ( void ) const
+{
+   return ( deduplicator_reclaimed_memory );
+}
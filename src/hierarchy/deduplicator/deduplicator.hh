@@ -0,0 +1,80 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_DEDUPLICATOR_HH_
+# define LIBOPENCIF_DEDUPLICATOR_HH_
+
+# include <vector>
+
+# include "../hierarchy/hierarchy.hh"
+# include "../../command/command.hh"
+# include "../../file/file.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class finds the symbols with the same contents (but different IDs)
+    * and keeps only one of them: the calls to the others are changed to call
+    * the one kept, and their definitions are removed.
+    *
+    * Every symbol gets a hash of its contents, that doesn't depend on the
+    * order of its primitives, user extensions and calls, nor on the ID and
+    * the name of the symbol: two symbols are the same if they have the same
+    * scale, primitives (in the same layers), user extensions (other than the
+    * name) and calls to symbols that are the same, with the same
+    * transformations. The symbols with the same hash are compared to be sure.
+    * The hashes of the primitives are computed in parallel, using a thread
+    * per group of symbols.
+    *
+    * The symbol kept is the one defined first, so it's known wherever the
+    * others are called. Symbols whose ID is defined more than once are never
+    * removed, and a list with "DD" commands is not changed, since the calls
+    * would find other symbols.
+    */
+   class Deduplicator
+   {
+      public:
+         explicit Deduplicator ( void );
+         virtual ~Deduplicator ( void );
+         
+         void setThreadAmount ( const unsigned long int& new_thread_amount );
+         unsigned long int getThreadAmount ( void ) const;
+         
+         std::vector< unsigned long long int > computeHashes ( const std::vector< OpenCIF::Command* >& commands ,
+                                                              const OpenCIF::Hierarchy& hierarchy ) const;
+         unsigned long int deduplicate ( std::vector< OpenCIF::Command* >& commands );
+         unsigned long int deduplicate ( OpenCIF::File& file );
+         
+         unsigned long int getRemovedSymbols ( void ) const;
+         unsigned long int getRemovedCommands ( void ) const;
+         unsigned long int getReclaimedMemory ( void ) const;
+      
+      private:
+         unsigned long int deduplicator_thread_amount;
+         unsigned long int deduplicator_removed_symbols;
+         unsigned long int deduplicator_removed_commands;
+         unsigned long int deduplicator_reclaimed_memory;
+   };
+}
+
+# endif
@@ -0,0 +1,374 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "hierarchy.hh"
+# include "../../command/controlcommand/controlcommand.hh"
+# include "../../command/controlcommand/callcommand/callcommand.hh"
+# include "../../command/controlcommand/definitionstartcommand/definitionstartcommand.hh"
+# include "../../command/rawcontentcommand/userextensioncommand/userextensioncommand.hh"
+
+namespace
+{
+   /*
+    * Call found inside a definition, waiting for the end of the block of
+    * definitions to be resolved.
+    */
+   struct HierarchyCall
+   {
+      unsigned long int symbol;
+      unsigned long int id;
+      OpenCIF::Transform transform;
+      unsigned long int command;
+   };
+   
+   /*
+    * Function to get the name given by a "9" user extension, or an empty
+    * string if the extension is another one.
+    */
+   std::string symbolName ( const std::string& content )
+   {
+      if ( content.size () < 2 || content[ 0 ] != '9' || ( content[ 1 ] != ' ' && content[ 1 ] != '\t' ) )
+      {
+         return ( std::string () );
+      }
+      
+      std::string::size_type first = content.find_first_not_of ( " \t" , 1 );
+      std::string::size_type last = content.find_last_not_of ( " \t" );
+      
+      return ( ( first == std::string::npos ) ? std::string () : content.substr ( first , last - first + 1 ) );
+   }
+   
+   /*
+    * Function to resolve the calls waiting inside the definitions, using the
+    * table of definitions as it is now.
+    */
+   void resolve ( std::vector< HierarchyCall >& calls , std::vector< OpenCIF::Symbol >& symbols ,
+                  const std::map< unsigned long int , unsigned long int >& table )
+   {
+      for ( unsigned long int i = 0; i < calls.size (); i++ )
+      {
+         std::map< unsigned long int , unsigned long int >::const_iterator found = table.find ( calls[ i ].id );
+         
+         if ( found != table.end () )
+         {
+            symbols[ calls[ i ].symbol ].addInstance ( OpenCIF::Instance ( found->second , calls[ i ].transform * symbols[ found->second ].getScale () ,
+                                                                           calls[ i ].command ) );
+         }
+      }
+      
+      calls.clear ();
+      
+      return;
+   }
+}
+
+/*
+ * Index returned when a symbol is not found.
+ */
+const unsigned long int OpenCIF::Hierarchy::NoSymbol = (unsigned long int)( -1 );
+
+/*
+ * Default constructor. An empty hierarchy.
+ */
+OpenCIF::Hierarchy::Hierarchy ( void )
+{
+}
+
+/*
+ * Non-default constructor. Build the hierarchy of a list of commands.
+ */
+OpenCIF::Hierarchy::Hierarchy ( const std::vector< OpenCIF::Command* >& commands )
+{
+   build ( commands );
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Hierarchy::~Hierarchy ( void )
+{
+}
+
+/*
+ * Member function to find the symbols of a list of commands, and to resolve
+ * the calls. The commands are not copied, and the hierarchy keeps only their
+ * indexes, so the list must not change while the hierarchy is used.
+ */
+void OpenCIF::Hierarchy::build ( const std::vector< OpenCIF::Command* >& commands )
+{
+   std::vector< HierarchyCall > waiting_calls;
+   unsigned long int current = NoSymbol;
+   
+   hierarchy_symbols.clear ();
+   hierarchy_top = OpenCIF::Symbol ();
+   hierarchy_table.clear ();
+   hierarchy_names.clear ();
+   
+   for ( unsigned long int i = 0; i < commands.size (); i++ )
+   {
+      OpenCIF::Command* command = commands[ i ];
+      
+      switch ( command->type () )
+      {
+         case OpenCIF::Command::DefinitionStart:
+         {
+            OpenCIF::DefinitionStartCommand* start = static_cast< OpenCIF::DefinitionStartCommand* > ( command );
+            OpenCIF::Symbol symbol;
+            
+            symbol.setID ( start->getID () );
+            symbol.setScale ( OpenCIF::Transform::fromScale ( start->getAB () ) );
+            symbol.setBegin ( i );
+            current = hierarchy_symbols.size ();
+            hierarchy_symbols.push_back ( symbol );
+            break;
+         }
+         
+         case OpenCIF::Command::DefinitionEnd:
+            if ( current != NoSymbol )
+            {
+               hierarchy_symbols[ current ].setEnd ( i );
+               hierarchy_table[ hierarchy_symbols[ current ].getID () ] = current;
+               
+               if ( !hierarchy_symbols[ current ].getName ().empty () )
+               {
+                  hierarchy_names[ hierarchy_symbols[ current ].getName () ] = current;
+               }
+               
+               current = NoSymbol;
+            }
+            break;
+         
+         case OpenCIF::Command::DefinitionDelete:
+         {
+            resolve ( waiting_calls , hierarchy_symbols , hierarchy_table );
+            hierarchy_table.erase ( hierarchy_table.lower_bound ( static_cast< OpenCIF::ControlCommand* > ( command )->getID () ) ,
+                                    hierarchy_table.end () );
+            break;
+         }
+         
+         case OpenCIF::Command::Call:
+         {
+            OpenCIF::CallCommand* call = static_cast< OpenCIF::CallCommand* > ( command );
+            HierarchyCall waiting;
+            
+            waiting.symbol = current;
+            waiting.id = call->getID ();
+            waiting.transform = call->getTransform ();
+            waiting.command = i;
+            
+            if ( current != NoSymbol )
+            {
+               waiting_calls.push_back ( waiting );
+            }
+            else
+            {
+               unsigned long int called = findID ( waiting.id );
+               
+               if ( called != NoSymbol )
+               {
+                  hierarchy_top.addInstance ( OpenCIF::Instance ( called , waiting.transform * hierarchy_symbols[ called ].getScale () , i ) );
+               }
+            }
+            break;
+         }
+         
+         case OpenCIF::Command::Box:
+         case OpenCIF::Command::Polygon:
+         case OpenCIF::Command::Wire:
+         case OpenCIF::Command::RoundFlash:
+            if ( current != NoSymbol )
+            {
+               hierarchy_symbols[ current ].addPrimitive ( i );
+            }
+            else
+            {
+               hierarchy_top.addPrimitive ( i );
+            }
+            break;
+         
+         case OpenCIF::Command::UserExtension:
+            if ( current != NoSymbol && hierarchy_symbols[ current ].getName ().empty () )
+            {
+               hierarchy_symbols[ current ].setName ( symbolName ( static_cast< OpenCIF::UserExtensionCommand* > ( command )->getContent () ) );
+            }
+            break;
+         
+         default:
+            break;
+      }
+   }
+   
+   resolve ( waiting_calls , hierarchy_symbols , hierarchy_table );
+   dropRecursiveCalls ();
+   
+   for ( unsigned long int i = 0; i < hierarchy_symbols.size (); i++ )
+   {
+      hierarchy_symbols[ i ].setArrays ( OpenCIF::InstanceArray::detect ( hierarchy_symbols[ i ].getInstances () ) );
+   }
+   
+   hierarchy_top.setArrays ( OpenCIF::InstanceArray::detect ( hierarchy_top.getInstances () ) );
+   
+   return;
+}
+
+unsigned long int OpenCIF::Hierarchy::getSymbolAmount ( void ) const
+{
+   return ( hierarchy_symbols.size () );
+}
+
+const std::vector< OpenCIF::Symbol >& OpenCIF::Hierarchy::getSymbols ( void ) const
+{
+   return ( hierarchy_symbols );
+}
+
+const OpenCIF::Symbol& OpenCIF::Hierarchy::getSymbol ( const unsigned long int& index ) const
+{
+   return ( hierarchy_symbols[ index ] );
+}
+
+const OpenCIF::Symbol& OpenCIF::Hierarchy::getTop ( void ) const
+{
+   return ( hierarchy_top );
+}
+
+/*
+ * Member function to find the symbol defined with an ID, after the last
+ * command. Returns NoSymbol if it was never defined, or it was deleted.
+ */
+unsigned long int OpenCIF::Hierarchy::findID ( const unsigned long int& id ) const
+{
+   std::map< unsigned long int , unsigned long int >::const_iterator found = hierarchy_table.find ( id );
+   
+   return ( ( found != hierarchy_table.end () ) ? found->second : NoSymbol );
+}
+
+/*
+ * Member function to find the last symbol defined with a name.
+ */
+unsigned long int OpenCIF::Hierarchy::findName ( const std::string& name ) const
+{
+   std::map< std::string , unsigned long int >::const_iterator found = hierarchy_names.find ( name );
+   
+   return ( ( found != hierarchy_names.end () ) ? found->second : NoSymbol );
+}
+
+/*
+ * Member function to return the indexes of the symbols ordered so every
+ * symbol comes after the symbols it calls.
+ */
+std::vector< unsigned long int > OpenCIF::Hierarchy::getOrder ( void ) const
+{
+   std::vector< unsigned long int > order;
+   std::vector< bool > visited ( hierarchy_symbols.size () , false );
+   std::vector< std::pair< unsigned long int , unsigned long int > > stack;
+   
+   order.reserve ( hierarchy_symbols.size () );
+   
+   for ( unsigned long int i = 0; i < hierarchy_symbols.size (); i++ )
+   {
+      if ( visited[ i ] )
+      {
+         continue;
+      }
+      
+      visited[ i ] = true;
+      stack.push_back ( std::make_pair ( i , 0 ) );
+      
+      while ( !stack.empty () )
+      {
+         const std::vector< OpenCIF::Instance >& instances = hierarchy_symbols[ stack.back ().first ].getInstances ();
+         
+         if ( stack.back ().second < instances.size () )
+         {
+            unsigned long int called = instances[ stack.back ().second++ ].getSymbol ();
+            
+            if ( !visited[ called ] )
+            {
+               visited[ called ] = true;
+               stack.push_back ( std::make_pair ( called , 0 ) );
+            }
+         }
+         else
+         {
+            order.push_back ( stack.back ().first );
+            stack.pop_back ();
+         }
+      }
+   }
+   
+   return ( order );
+}
+
+/*
+ * Member function to remove the calls that close a cycle, found with a
+ * depth-first search. A symbol that calls itself can't be drawn.
+ */
+void OpenCIF::Hierarchy::dropRecursiveCalls ( void )
+{
+   enum { Unvisited = 0 , Visiting , Done };
+   std::vector< int > state ( hierarchy_symbols.size () , Unvisited );
+   std::vector< std::pair< unsigned long int , unsigned long int > > stack;
+   
+   for ( unsigned long int i = 0; i < hierarchy_symbols.size (); i++ )
+   {
+      if ( state[ i ] != Unvisited )
+      {
+         continue;
+      }
+      
+      state[ i ] = Visiting;
+      stack.push_back ( std::make_pair ( i , 0 ) );
+      
+      while ( !stack.empty () )
+      {
+         std::vector< OpenCIF::Instance >& instances = hierarchy_symbols[ stack.back ().first ].getInstances ();
+         
+         if ( stack.back ().second < instances.size () )
+         {
+            unsigned long int called = instances[ stack.back ().second ].getSymbol ();
+            
+            if ( state[ called ] == Visiting )
+            {
+               instances.erase ( instances.begin () + stack.back ().second );
+            }
+            else
+            {
+               stack.back ().second++;
+               
+               if ( state[ called ] == Unvisited )
+               {
+                  state[ called ] = Visiting;
+                  stack.push_back ( std::make_pair ( called , 0 ) );
+               }
+            }
+         }
+         else
+         {
+            state[ stack.back ().first ] = Done;
+            stack.pop_back ();
+         }
+      }
+   }
+   
+   return;
+}
@@ -0,0 +1,82 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_HIERARCHY_HH_
+# define LIBOPENCIF_HIERARCHY_HH_
+
+# include <map>
+# include <string>
+# include <vector>
+
+# include "../symbol/symbol.hh"
+# include "../instance/instance.hh"
+# include "../../command/command.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class finds the symbols defined in a list of commands, and resolves
+    * the calls between them, so the algorithms that follow the calls don't
+    * need to read the definitions again.
+    *
+    * A call outside the definitions is resolved using the definitions found
+    * before it. A call inside a definition is resolved using the definitions
+    * found until the next "DD" command (or until the end of the list), so a
+    * symbol can call symbols defined after it. Calls to unknown symbols, and
+    * calls that would make a symbol call itself (directly or not), are
+    * dropped. Then the regular arrays of calls of every symbol are found
+    * (see InstanceArray).
+    */
+   class Hierarchy
+   {
+      public:
+         static const unsigned long int NoSymbol;
+      
+      public:
+         explicit Hierarchy ( void );
+         explicit Hierarchy ( const std::vector< OpenCIF::Command* >& commands );
+         virtual ~Hierarchy ( void );
+         
+         void build ( const std::vector< OpenCIF::Command* >& commands );
+         
+         unsigned long int getSymbolAmount ( void ) const;
+         const std::vector< OpenCIF::Symbol >& getSymbols ( void ) const;
+         const OpenCIF::Symbol& getSymbol ( const unsigned long int& index ) const;
+         const OpenCIF::Symbol& getTop ( void ) const;
+         
+         unsigned long int findID ( const unsigned long int& id ) const;
+         unsigned long int findName ( const std::string& name ) const;
+         std::vector< unsigned long int > getOrder ( void ) const;
+      
+      private:
+         void dropRecursiveCalls ( void );
+      
+      private:
+         std::vector< OpenCIF::Symbol > hierarchy_symbols;
+         OpenCIF::Symbol hierarchy_top;
+         std::map< unsigned long int , unsigned long int > hierarchy_table;
+         std::map< std::string , unsigned long int > hierarchy_names;
+   };
+}
+
+# endif
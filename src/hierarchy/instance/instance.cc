@@ -0,0 +1,84 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "instance.hh"
+
+/*
+ * Default constructor. Calls the symbol 0, with the identity.
+ */
+OpenCIF::Instance::Instance ( void )
+   : instance_symbol ( 0 ) , instance_command ( 0 )
+{
+}
+
+/*
+ * Non-default constructor. Initialize the symbol called (its index in the
+ * hierarchy), the transformation and the index of the call command.
+ */
+OpenCIF::Instance::Instance ( const unsigned long int& new_symbol , const OpenCIF::Transform& new_transform , const unsigned long int& new_command )
+   : instance_symbol ( new_symbol ) , instance_transform ( new_transform ) , instance_command ( new_command )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Instance::~Instance ( void )
+{
+}
+
+void OpenCIF::Instance::setSymbol ( const unsigned long int& new_symbol )
+{
+   instance_symbol = new_symbol;
+   
+   return;
+}
+
+void OpenCIF::Instance::setTransform ( const OpenCIF::Transform& new_transform )
+{
+   instance_transform = new_transform;
+   
+   return;
+}
+
+void OpenCIF::Instance::setCommand ( const unsigned long int& new_command )
+{
+   instance_command = new_command;
+   
+   return;
+}
+
+unsigned long int OpenCIF::Instance::getSymbol ( void ) const
+{
+   return ( instance_symbol );
+}
+
+const OpenCIF::Transform& OpenCIF::Instance::getTransform ( void ) const
+{
+   return ( instance_transform );
+}
+
+unsigned long int OpenCIF::Instance::getCommand ( void ) const
+{
+   return ( instance_command );
+}
@@ -0,0 +1,58 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_INSTANCE_HH_
+# define LIBOPENCIF_INSTANCE_HH_
+
+# include "../../geometry/transform/transform.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class represents a call found in the list of commands, with the
+    * symbol called already resolved. The transformation includes the scale
+    * of the definition called, so it converts directly the coordinates of
+    * the definition into the coordinates of the caller.
+    */
+   class Instance
+   {
+      public:
+         explicit Instance ( void );
+         explicit Instance ( const unsigned long int& new_symbol , const OpenCIF::Transform& new_transform , const unsigned long int& new_command );
+         virtual ~Instance ( void );
+         
+         void setSymbol ( const unsigned long int& new_symbol );
+         void setTransform ( const OpenCIF::Transform& new_transform );
+         void setCommand ( const unsigned long int& new_command );
+         unsigned long int getSymbol ( void ) const;
+         const OpenCIF::Transform& getTransform ( void ) const;
+         unsigned long int getCommand ( void ) const;
+      
+      private:
+         unsigned long int instance_symbol;
+         OpenCIF::Transform instance_transform;
+         unsigned long int instance_command;
+   };
+}
+
+# endif
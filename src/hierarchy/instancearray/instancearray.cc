@@ -0,0 +1,377 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <algorithm>
+# include <cmath>
+
+# include "instancearray.hh"
+
+namespace
+{
+   /*
+    * Function to tell if two instances call the same symbol with the same
+    * transformation, except for the displacement.
+    */
+   bool similar ( const OpenCIF::Instance& first , const OpenCIF::Instance& second )
+   {
+      const OpenCIF::Transform& a = first.getTransform ();
+      const OpenCIF::Transform& b = second.getTransform ();
+      
+      return ( first.getSymbol () == second.getSymbol () &&
+               a.getA () == b.getA () && a.getB () == b.getB () && a.getC () == b.getC () && a.getD () == b.getD () );
+   }
+   
+   /*
+    * Function to tell if the displacement of an instance is made of integers
+    * (that can be subtracted exactly).
+    */
+   bool integral ( const OpenCIF::Instance& instance )
+   {
+      const double limit = 9007199254740992.0; // 2^53
+      double dx = instance.getTransform ().getDX ();
+      double dy = instance.getTransform ().getDY ();
+      
+      return ( dx == std::floor ( dx ) && dy == std::floor ( dy ) && std::fabs ( dx ) < limit && std::fabs ( dy ) < limit );
+   }
+   
+   long int displacementX ( const OpenCIF::Instance& instance )
+   {
+      return ( (long int)instance.getTransform ().getDX () );
+   }
+   
+   long int displacementY ( const OpenCIF::Instance& instance )
+   {
+      return ( (long int)instance.getTransform ().getDY () );
+   }
+   
+   /*
+    * Function to tell if the instance "index" is like the instance "first",
+    * displaced by the given amounts.
+    */
+   bool matches ( const std::vector< OpenCIF::Instance >& instances , const unsigned long int& first , const unsigned long int& index ,
+                  const long int& x , const long int& y )
+   {
+      return ( index < instances.size () && similar ( instances[ first ] , instances[ index ] ) && integral ( instances[ index ] ) &&
+               displacementX ( instances[ index ] ) - displacementX ( instances[ first ] ) == x &&
+               displacementY ( instances[ index ] ) - displacementY ( instances[ first ] ) == y );
+   }
+   
+   long long int floorDivision ( const long long int& a , const long long int& b )
+   {
+      long long int result = a / b;
+      
+      return ( ( ( a % b ) != 0 && ( ( a < 0 ) != ( b < 0 ) ) ) ? result - 1 : result );
+   }
+   
+   long long int ceilDivision ( const long long int& a , const long long int& b )
+   {
+      return ( -floorDivision ( -a , b ) );
+   }
+   
+   /*
+    * Function to limit the range [first, last) of the steps "k" of an array
+    * so the interval [low + k * step, high + k * step] can touch the interval
+    * [window_low, window_high].
+    */
+   void limit ( const long long int& low , const long long int& high , const long long int& step ,
+                const long long int& window_low , const long long int& window_high , long long int& first , long long int& last )
+   {
+      if ( step > 0 )
+      {
+         first = std::max ( first , ceilDivision ( window_low - high , step ) );
+         last = std::min ( last , floorDivision ( window_high - low , step ) + 1 );
+      }
+      else if ( step < 0 )
+      {
+         first = std::max ( first , ceilDivision ( window_high - low , step ) );
+         last = std::min ( last , floorDivision ( window_low - high , step ) + 1 );
+      }
+      else if ( high < window_low || low > window_high )
+      {
+         last = first;
+      }
+      
+      return;
+   }
+}
+
+const unsigned long int OpenCIF::InstanceArray::MinimumSize = 4;
+
+/*
+ * Default constructor. An array of a single element, the instance 0.
+ */
+OpenCIF::InstanceArray::InstanceArray ( void )
+   : array_first ( 0 ) , array_columns ( 1 ) , array_rows ( 1 ) ,
+     array_column_step_x ( 0 ) , array_column_step_y ( 0 ) , array_row_step_x ( 0 ) , array_row_step_y ( 0 )
+{
+}
+
+OpenCIF::InstanceArray::InstanceArray ( const unsigned long int& new_first , const unsigned long int& new_columns , const unsigned long int& new_rows ,
+                                        const long int& new_column_step_x , const long int& new_column_step_y ,
+                                        const long int& new_row_step_x , const long int& new_row_step_y )
+   : array_first ( new_first ) , array_columns ( new_columns ) , array_rows ( new_rows ) ,
+     array_column_step_x ( new_column_step_x ) , array_column_step_y ( new_column_step_y ) ,
+     array_row_step_x ( new_row_step_x ) , array_row_step_y ( new_row_step_y )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::InstanceArray::~InstanceArray ( void )
+{
+}
+
+unsigned long int OpenCIF::InstanceArray::getFirst ( void ) const
+{
+   return ( array_first );
+}
+
+unsigned long int OpenCIF::InstanceArray::getColumns ( void ) const
+{
+   return ( array_columns );
+}
+
+unsigned long int OpenCIF::InstanceArray::getRows ( void ) const
+{
+   return ( array_rows );
+}
+
+/*
+ * Member function to return the amount of elements (and of instances).
+ */
+unsigned long int OpenCIF::InstanceArray::getSize ( void ) const
+{
+   return ( array_columns * array_rows );
+}
+
+long int OpenCIF::InstanceArray::getColumnStepX ( void ) const
+{
+   return ( array_column_step_x );
+}
+
+long int OpenCIF::InstanceArray::getColumnStepY ( void ) const
+{
+   return ( array_column_step_y );
+}
+
+long int OpenCIF::InstanceArray::getRowStepX ( void ) const
+{
+   return ( array_row_step_x );
+}
+
+long int OpenCIF::InstanceArray::getRowStepY ( void ) const
+{
+   return ( array_row_step_y );
+}
+
+/*
+ * Member function to return the displacement in X of an element from the
+ * first one.
+ */
+long int OpenCIF::InstanceArray::getOffsetX ( const unsigned long int& element ) const
+{
+   return ( (long int)( element % array_columns ) * array_column_step_x + (long int)( element / array_columns ) * array_row_step_x );
+}
+
+/*
+ * Member function to return the displacement in Y of an element from the
+ * first one.
+ */
+long int OpenCIF::InstanceArray::getOffsetY ( const unsigned long int& element ) const
+{
+   return ( (long int)( element % array_columns ) * array_column_step_y + (long int)( element / array_columns ) * array_row_step_y );
+}
+
+/*
+ * Member function to return the transformation of an element, given the
+ * transformation of the first one.
+ */
+OpenCIF::Transform OpenCIF::InstanceArray::place ( const OpenCIF::Transform& first_transform , const unsigned long int& element ) const
+{
+   return ( OpenCIF::Transform ( first_transform.getA () , first_transform.getB () , first_transform.getC () , first_transform.getD () ,
+                                 first_transform.getDX () + getOffsetX ( element ) , first_transform.getDY () + getOffsetY ( element ) ) );
+}
+
+/*
+ * Member function to return the bounding box of every element, given the
+ * bounding box of the first one. Only the four corners of the grid are
+ * needed.
+ */
+OpenCIF::Rectangle OpenCIF::InstanceArray::getBounds ( const OpenCIF::Rectangle& first_bounds ) const
+{
+   OpenCIF::Rectangle bounds;
+   
+   if ( first_bounds.isEmpty () )
+   {
+      return ( bounds );
+   }
+   
+   const unsigned long int corners[] = { 0 , array_columns - 1 , getSize () - array_columns , getSize () - 1 };
+   
+   for ( unsigned long int i = 0; i < 4; i++ )
+   {
+      long int x = getOffsetX ( corners[ i ] );
+      long int y = getOffsetY ( corners[ i ] );
+      
+      bounds.add ( OpenCIF::Rectangle ( first_bounds.getLeft () + x , first_bounds.getBottom () + y ,
+                                        first_bounds.getRight () + x , first_bounds.getTop () + y ) );
+   }
+   
+   return ( bounds );
+}
+
+/*
+ * Member function to append the instances (first + element) of the elements
+ * whose bounding boxes intersect a window, given the bounding box of the
+ * first one. When the steps are horizontal or vertical, the columns and the
+ * rows that can touch the window are computed directly.
+ */
+void OpenCIF::InstanceArray::query ( const OpenCIF::Rectangle& first_bounds , const OpenCIF::Rectangle& window ,
+                                     std::vector< unsigned long int >& elements ) const
+{
+   if ( first_bounds.isEmpty () || window.isEmpty () )
+   {
+      return;
+   }
+   
+   long long int first_row = 0;
+   long long int last_row = array_rows;
+   
+   if ( array_column_step_y == 0 && array_row_step_x == 0 )
+   {
+      limit ( first_bounds.getBottom () , first_bounds.getTop () , array_row_step_y , window.getBottom () , window.getTop () , first_row , last_row );
+   }
+   else if ( array_column_step_x == 0 && array_row_step_y == 0 )
+   {
+      limit ( first_bounds.getLeft () , first_bounds.getRight () , array_row_step_x , window.getLeft () , window.getRight () , first_row , last_row );
+   }
+   
+   for ( long long int row = first_row; row < last_row; row++ )
+   {
+      long long int row_x = row * array_row_step_x;
+      long long int row_y = row * array_row_step_y;
+      long long int first_column = 0;
+      long long int last_column = array_columns;
+      
+      if ( array_column_step_y == 0 )
+      {
+         limit ( first_bounds.getLeft () + row_x , first_bounds.getRight () + row_x , array_column_step_x ,
+                 window.getLeft () , window.getRight () , first_column , last_column );
+      }
+      else if ( array_column_step_x == 0 )
+      {
+         limit ( first_bounds.getBottom () + row_y , first_bounds.getTop () + row_y , array_column_step_y ,
+                 window.getBottom () , window.getTop () , first_column , last_column );
+      }
+      
+      for ( long long int column = first_column; column < last_column; column++ )
+      {
+         long int x = row_x + column * array_column_step_x;
+         long int y = row_y + column * array_column_step_y;
+         
+         if ( window.intersects ( OpenCIF::Rectangle ( first_bounds.getLeft () + x , first_bounds.getBottom () + y ,
+                                                       first_bounds.getRight () + x , first_bounds.getTop () + y ) ) )
+         {
+            elements.push_back ( array_first + row * array_columns + column );
+         }
+      }
+   }
+   
+   return;
+}
+
+/*
+ * Static member function to find the arrays in a list of instances. A run
+ * of consecutive similar instances with the same step between them makes
+ * the first row (the columns), and the following runs with the same amount
+ * of columns, each one displaced by the same step from the previous one,
+ * make the other rows. Only the arrays with at least "minimum_size"
+ * elements are returned, in the order of the instances; the instances
+ * outside them are single.
+ */
+std::vector< OpenCIF::InstanceArray > OpenCIF::InstanceArray::detect ( const std::vector< OpenCIF::Instance >& instances ,
+                                                                       const unsigned long int& minimum_size )
+{
+   std::vector< OpenCIF::InstanceArray > arrays;
+   unsigned long int i = 0;
+   
+   while ( i < instances.size () )
+   {
+      unsigned long int columns = 1;
+      unsigned long int rows = 1;
+      long int column_x = 0;
+      long int column_y = 0;
+      long int row_x = 0;
+      long int row_y = 0;
+      
+      if ( integral ( instances[ i ] ) && i + 1 < instances.size () && similar ( instances[ i ] , instances[ i + 1 ] ) &&
+           integral ( instances[ i + 1 ] ) )
+      {
+         column_x = displacementX ( instances[ i + 1 ] ) - displacementX ( instances[ i ] );
+         column_y = displacementY ( instances[ i + 1 ] ) - displacementY ( instances[ i ] );
+         
+         if ( column_x != 0 || column_y != 0 )
+         {
+            while ( matches ( instances , i , i + columns , columns * column_x , columns * column_y ) )
+            {
+               columns++;
+            }
+         }
+      }
+      
+      if ( columns > 1 && i + columns < instances.size () && similar ( instances[ i ] , instances[ i + columns ] ) &&
+           integral ( instances[ i + columns ] ) )
+      {
+         row_x = displacementX ( instances[ i + columns ] ) - displacementX ( instances[ i ] );
+         row_y = displacementY ( instances[ i + columns ] ) - displacementY ( instances[ i ] );
+         
+         bool complete = ( row_x != 0 || row_y != 0 );
+         
+         while ( complete )
+         {
+            for ( unsigned long int k = 0; k < columns && complete; k++ )
+            {
+               complete = matches ( instances , i , i + rows * columns + k , rows * row_x + k * column_x , rows * row_y + k * column_y );
+            }
+            
+            if ( complete )
+            {
+               rows++;
+            }
+         }
+      }
+      
+      if ( columns * rows > 1 && columns * rows >= minimum_size )
+      {
+         arrays.push_back ( OpenCIF::InstanceArray ( i , columns , rows , column_x , column_y , row_x , row_y ) );
+         i += columns * rows;
+      }
+      else
+      {
+         i++;
+      }
+   }
+   
+   return ( arrays );
+}
@@ -0,0 +1,94 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_INSTANCEARRAY_HH_
+# define LIBOPENCIF_INSTANCEARRAY_HH_
+
+# include <vector>
+
+# include "../instance/instance.hh"
+# include "../../geometry/rectangle/rectangle.hh"
+# include "../../geometry/transform/transform.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class represents a run of consecutive instances (of a list of
+    * instances) that form a regular array: they call the same symbol, with
+    * the same transformation except for the displacement, and the
+    * displacements form a grid of columns and rows. The element "k" of the
+    * array is the instance "first + k", in the column "k % columns" and the
+    * row "k / columns", displaced from the first one by "column * column
+    * step + row * row step".
+    *
+    * Generators write memory arrays and fill patterns as thousands of calls
+    * at a regular pitch. Knowing the array, the bounding box of all its
+    * elements and the elements inside a window are computed arithmetically,
+    * without visiting every element. The bounding boxes of the elements are
+    * the one of the first element displaced, so they keep its rounding (when
+    * the scale puts coordinates on halves, they can differ by a unit from
+    * transforming every element).
+    */
+   class InstanceArray
+   {
+      public:
+         static const unsigned long int MinimumSize; // Smallest amount of elements of an array found by detect.
+      
+      public:
+         explicit InstanceArray ( void );
+         explicit InstanceArray ( const unsigned long int& new_first , const unsigned long int& new_columns , const unsigned long int& new_rows ,
+                                  const long int& new_column_step_x , const long int& new_column_step_y ,
+                                  const long int& new_row_step_x , const long int& new_row_step_y );
+         virtual ~InstanceArray ( void );
+         
+         unsigned long int getFirst ( void ) const;
+         unsigned long int getColumns ( void ) const;
+         unsigned long int getRows ( void ) const;
+         unsigned long int getSize ( void ) const;
+         long int getColumnStepX ( void ) const;
+         long int getColumnStepY ( void ) const;
+         long int getRowStepX ( void ) const;
+         long int getRowStepY ( void ) const;
+         
+         long int getOffsetX ( const unsigned long int& element ) const;
+         long int getOffsetY ( const unsigned long int& element ) const;
+         OpenCIF::Transform place ( const OpenCIF::Transform& first_transform , const unsigned long int& element ) const;
+         OpenCIF::Rectangle getBounds ( const OpenCIF::Rectangle& first_bounds ) const;
+         void query ( const OpenCIF::Rectangle& first_bounds , const OpenCIF::Rectangle& window , std::vector< unsigned long int >& elements ) const;
+      
+      public:
+         static std::vector< OpenCIF::InstanceArray > detect ( const std::vector< OpenCIF::Instance >& instances ,
+                                                               const unsigned long int& minimum_size = MinimumSize );
+      
+      private:
+         unsigned long int array_first;
+         unsigned long int array_columns;
+         unsigned long int array_rows;
+         long int array_column_step_x;
+         long int array_column_step_y;
+         long int array_row_step_x;
+         long int array_row_step_y;
+   };
+}
+
+# endif
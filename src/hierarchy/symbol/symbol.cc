@@ -0,0 +1,182 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "symbol.hh"
+
+/*
+ * Index used for the first and last commands of the top symbol.
+ */
+const unsigned long int OpenCIF::Symbol::NoCommand = (unsigned long int)( -1 );
+const unsigned long int OpenCIF::Symbol::NoArray = (unsigned long int)( -1 );
+
+/*
+ * Default constructor. An empty symbol, with ID 0 and without commands.
+ */
+OpenCIF::Symbol::Symbol ( void )
+   : symbol_id ( 0 ) , symbol_begin ( NoCommand ) , symbol_end ( NoCommand )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Symbol::~Symbol ( void )
+{
+}
+
+void OpenCIF::Symbol::setID ( const unsigned long int& new_id )
+{
+   symbol_id = new_id;
+   
+   return;
+}
+
+void OpenCIF::Symbol::setName ( const std::string& new_name )
+{
+   symbol_name = new_name;
+   
+   return;
+}
+
+void OpenCIF::Symbol::setScale ( const OpenCIF::Transform& new_scale )
+{
+   symbol_scale = new_scale;
+   
+   return;
+}
+
+void OpenCIF::Symbol::setBegin ( const unsigned long int& new_begin )
+{
+   symbol_begin = new_begin;
+   
+   return;
+}
+
+void OpenCIF::Symbol::setEnd ( const unsigned long int& new_end )
+{
+   symbol_end = new_end;
+   
+   return;
+}
+
+void OpenCIF::Symbol::addPrimitive ( const unsigned long int& command )
+{
+   symbol_primitives.push_back ( command );
+   
+   return;
+}
+
+void OpenCIF::Symbol::addInstance ( const OpenCIF::Instance& instance )
+{
+   symbol_instances.push_back ( instance );
+   
+   return;
+}
+
+/*
+ * Member function to set the arrays formed by the instances, in the order of
+ * the instances.
+ */
+void OpenCIF::Symbol::setArrays ( const std::vector< OpenCIF::InstanceArray >& new_arrays )
+{
+   symbol_arrays = new_arrays;
+   
+   return;
+}
+
+unsigned long int OpenCIF::Symbol::getID ( void ) const
+{
+   return ( symbol_id );
+}
+
+const std::string& OpenCIF::Symbol::getName ( void ) const
+{
+   return ( symbol_name );
+}
+
+const OpenCIF::Transform& OpenCIF::Symbol::getScale ( void ) const
+{
+   return ( symbol_scale );
+}
+
+unsigned long int OpenCIF::Symbol::getBegin ( void ) const
+{
+   return ( symbol_begin );
+}
+
+unsigned long int OpenCIF::Symbol::getEnd ( void ) const
+{
+   return ( symbol_end );
+}
+
+const std::vector< unsigned long int >& OpenCIF::Symbol::getPrimitives ( void ) const
+{
+   return ( symbol_primitives );
+}
+
+const std::vector< OpenCIF::Instance >& OpenCIF::Symbol::getInstances ( void ) const
+{
+   return ( symbol_instances );
+}
+
+std::vector< OpenCIF::Instance >& OpenCIF::Symbol::getInstances ( void )
+{
+   return ( symbol_instances );
+}
+
+const std::vector< OpenCIF::InstanceArray >& OpenCIF::Symbol::getArrays ( void ) const
+{
+   return ( symbol_arrays );
+}
+
+/*
+ * Member function to find the array an instance belongs to. Returns the
+ * index of the array, or NoArray if the instance is single.
+ */
+unsigned long int OpenCIF::Symbol::findArray ( const unsigned long int& instance ) const
+{
+   unsigned long int low = 0;
+   unsigned long int high = symbol_arrays.size ();
+   
+   // The last array that starts at the instance or before it.
+   while ( low < high )
+   {
+      unsigned long int middle = ( low + high ) / 2;
+      
+      if ( symbol_arrays[ middle ].getFirst () <= instance )
+      {
+         low = middle + 1;
+      }
+      else
+      {
+         high = middle;
+      }
+   }
+   
+   if ( low > 0 && instance < symbol_arrays[ low - 1 ].getFirst () + symbol_arrays[ low - 1 ].getSize () )
+   {
+      return ( low - 1 );
+   }
+   
+   return ( NoArray );
+}
@@ -0,0 +1,91 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_SYMBOL_HH_
+# define LIBOPENCIF_SYMBOL_HH_
+
+# include <string>
+# include <vector>
+
+# include "../instance/instance.hh"
+# include "../instancearray/instancearray.hh"
+# include "../../geometry/transform/transform.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class represents a definition (DS ... DF) found in the list of
+    * commands: the indexes of its first and last commands, the indexes of
+    * its primitives, and the calls it makes. The name is taken from a "9"
+    * user extension inside the definition, if there is one.
+    *
+    * The commands outside the definitions are kept as a symbol too (the top
+    * symbol), without ID and without the commands DS and DF.
+    *
+    * The instances that form regular arrays are described by the arrays
+    * (see InstanceArray), in the order of the instances. The arrays are
+    * found by the Hierarchy class, and describe the instances as they were
+    * then.
+    */
+   class Symbol
+   {
+      public:
+         static const unsigned long int NoCommand;
+         static const unsigned long int NoArray;
+      
+      public:
+         explicit Symbol ( void );
+         virtual ~Symbol ( void );
+         
+         void setID ( const unsigned long int& new_id );
+         void setName ( const std::string& new_name );
+         void setScale ( const OpenCIF::Transform& new_scale );
+         void setBegin ( const unsigned long int& new_begin );
+         void setEnd ( const unsigned long int& new_end );
+         void addPrimitive ( const unsigned long int& command );
+         void addInstance ( const OpenCIF::Instance& instance );
+         void setArrays ( const std::vector< OpenCIF::InstanceArray >& new_arrays );
+         unsigned long int getID ( void ) const;
+         const std::string& getName ( void ) const;
+         const OpenCIF::Transform& getScale ( void ) const;
+         unsigned long int getBegin ( void ) const;
+         unsigned long int getEnd ( void ) const;
+         const std::vector< unsigned long int >& getPrimitives ( void ) const;
+         const std::vector< OpenCIF::Instance >& getInstances ( void ) const;
+         std::vector< OpenCIF::Instance >& getInstances ( void );
+         const std::vector< OpenCIF::InstanceArray >& getArrays ( void ) const;
+         unsigned long int findArray ( const unsigned long int& instance ) const;
+      
+      private:
+         unsigned long int symbol_id;
+         std::string symbol_name;
+         OpenCIF::Transform symbol_scale;
+         unsigned long int symbol_begin;
+         unsigned long int symbol_end;
+         std::vector< unsigned long int > symbol_primitives;
+         std::vector< OpenCIF::Instance > symbol_instances;
+         std::vector< OpenCIF::InstanceArray > symbol_arrays;
+   };
+}
+
+# endif
@@ -0,0 +1,127 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include "layertable.hh"
+
+/*
+ * The biggest value is used to represent "no layer", since the IDs are
+ * assigned starting from 0.
+ */
+const unsigned long int OpenCIF::LayerTable::NoLayer = (unsigned long int)( -1 );
+
+/*
+ * Default constructor. Nothing to do.
+ */
+OpenCIF::LayerTable::LayerTable ( void )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::LayerTable::~LayerTable ( void )
+{
+}
+
+/*
+ * Member function to get the ID of a layer name. If the name is not stored
+ * yet, it is stored and receives the next free ID.
+ */
+unsigned long int OpenCIF::LayerTable::intern ( const std::string& layer_name )
+{
+   std::map< std::string , unsigned long int >::const_iterator found = table_ids.find ( layer_name );
+   
+   if ( found != table_ids.end () )
+   {
+      return ( found->second );
+   }
+   
+   unsigned long int new_id = table_names.size ();
+   
+   table_names.push_back ( layer_name );
+   table_ids[ layer_name ] = new_id;
+   
+   return ( new_id );
+}
+
+/*
+ * Member function to get the ID of a layer name, without storing it. If the
+ * name is not stored, NoLayer is returned.
+ */
+unsigned long int OpenCIF::LayerTable::find ( const std::string& layer_name ) const
+{
+   std::map< std::string , unsigned long int >::const_iterator found = table_ids.find ( layer_name );
+   
+   return ( ( found != table_ids.end () ) ? found->second : NoLayer );
+}
+
+/*
+ * Member function to return the name of a layer ID. If the ID is unknown,
+ * an empty string is returned.
+ */
+const std::string& OpenCIF::LayerTable::getName ( const unsigned long int& layer_id ) const
+{
+   static const std::string unknown_name;
+   
+   if ( layer_id >= table_names.size () )
+   {
+      return ( unknown_name );
+   }
+   
+   return ( table_names[ layer_id ] );
+}
+
+/*
+ * Member function to return the amount of layers stored.
+ */
+unsigned long int OpenCIF::LayerTable::size ( void ) const
+{
+   return ( table_names.size () );
+}
+
+/*
+ * Member function to estimate the memory used by the table: the names (twice,
+ * in the vector and in the map) and the nodes of the map.
+ */
+unsigned long int OpenCIF::LayerTable::memoryUsage ( void ) const
+{
+   unsigned long int total = sizeof ( *this ) + table_names.capacity () * sizeof ( std::string );
+   
+   for ( unsigned long int i = 0; i < table_names.size (); i++ )
+   {
+      total += 2 * table_names[ i ].capacity ();
+   }
+   
+   return ( total + table_ids.size () * ( sizeof ( std::map< std::string , unsigned long int >::value_type ) + 4 * sizeof ( void* ) ) );
+}
+
+/*
+ * Member function to remove every layer stored.
+ */
+void OpenCIF::LayerTable::clear ( void )
+{
+   table_names.clear ();
+   table_ids.clear ();
+   
+   return;
+}
@@ -0,0 +1,64 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_LAYERTABLE_HH_
+# define LIBOPENCIF_LAYERTABLE_HH_
+
+# include <string>
+# include <vector>
+# include <map>
+
+namespace OpenCIF
+{
+   /*
+    * This class stores the names of the layers found in a CIF file. Every
+    * distinct name is stored only once, and receives a dense integer ID
+    * (0, 1, 2, ...), in the order the layers are found.
+    * 
+    * The primitive commands carry the ID of their layer, so grouping or
+    * filtering the primitives by layer can be done comparing integers, and
+    * the IDs can be used directly as indexes of a vector.
+    */
+   class LayerTable
+   {
+      public:
+         static const unsigned long int NoLayer; // ID used when there is no layer selected.
+         
+      public:
+         explicit LayerTable ( void );
+         virtual ~LayerTable ( void );
+         
+         unsigned long int intern ( const std::string& layer_name );
+         unsigned long int find ( const std::string& layer_name ) const;
+         const std::string& getName ( const unsigned long int& layer_id ) const;
+         unsigned long int size ( void ) const;
+         unsigned long int memoryUsage ( void ) const;
+         void clear ( void );
+         
+      private:
+         std::vector< std::string > table_names;
+         std::map< std::string , unsigned long int > table_ids;
+   };
+}
+
+# endif
@@ -0,0 +1,388 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <cstdlib>
+# include <fstream>
+# include <unordered_set>
+
+# include "minifier.hh"
+# include "../command/controlcommand/callcommand/callcommand.hh"
+# include "../command/controlcommand/definitiondeletecommand/definitiondeletecommand.hh"
+# include "../command/controlcommand/definitionstartcommand/definitionstartcommand.hh"
+# include "../command/layercommand/layercommand.hh"
+# include "../command/primitivecommand/pathbasedcommand/pathbasedcommand.hh"
+# include "../command/primitivecommand/pathbasedcommand/wirecommand/wirecommand.hh"
+# include "../command/primitivecommand/positionbasedcommand/boxcommand/boxcommand.hh"
+# include "../command/primitivecommand/positionbasedcommand/roundflashcommand/roundflashcommand.hh"
+# include "../command/rawcontentcommand/rawcontentcommand.hh"
+
+namespace
+{
+   /*
+    * Layers of a scope (the top, or a definition): the current layer of the
+    * commands read, and the last layer written.
+    */
+   struct MinifierScope
+   {
+      std::string input_layer;
+      std::string output_layer;
+   };
+   
+   /*
+    * Function to append a number to a text, separated from the previous one.
+    */
+   void append ( std::string& text , const long long int& value )
+   {
+      if ( !text.empty () && text[ text.size () - 1 ] >= '0' && text[ text.size () - 1 ] <= '9' )
+      {
+         text += ' ';
+      }
+      
+      text += std::to_string ( value );
+      
+      return;
+   }
+   
+   /*
+    * Function to append the points of a path.
+    */
+   void append ( std::string& text , const std::vector< OpenCIF::Point >& points )
+   {
+      for ( unsigned long int i = 0; i < points.size (); i++ )
+      {
+         append ( text , points[ i ].getX () );
+         append ( text , points[ i ].getY () );
+      }
+      
+      return;
+   }
+   
+   unsigned long long int gcd ( unsigned long long int a , unsigned long long int b )
+   {
+      while ( b != 0 )
+      {
+         unsigned long long int rest = a % b;
+         
+         a = b;
+         b = rest;
+      }
+      
+      return ( a );
+   }
+   
+   /*
+    * Function to append a direction (of a box, or a rotation of a call),
+    * reduced to its smallest integer multiple.
+    */
+   void appendDirection ( std::string& text , long long int x , long long int y )
+   {
+      long long int divisor = gcd ( std::llabs ( x ) , std::llabs ( y ) );
+      
+      if ( divisor > 1 )
+      {
+         x /= divisor;
+         y /= divisor;
+      }
+      
+      append ( text , x );
+      append ( text , y );
+      
+      return;
+   }
+   
+   /*
+    * Function to write the canonical text of a command (without the
+    * semicolon). Returns false if the command has nothing to write.
+    */
+   bool canonical ( const OpenCIF::Command* command , std::string& text )
+   {
+      text.clear ();
+      
+      switch ( command->type () )
+      {
+         case OpenCIF::Command::Box:
+            {
+               const OpenCIF::BoxCommand* box = static_cast< const OpenCIF::BoxCommand* > ( command );
+               const OpenCIF::Point& rotation = box->getRotation ();
+               
+               text = "B";
+               append ( text , box->getSize ().getWidth () );
+               append ( text , box->getSize ().getHeight () );
+               append ( text , box->getPosition ().getX () );
+               append ( text , box->getPosition ().getY () );
+               
+               if ( !( rotation.getX () > 0 && rotation.getY () == 0 ) )
+               {
+                  appendDirection ( text , rotation.getX () , rotation.getY () );
+               }
+            }
+            break;
+         
+         case OpenCIF::Command::Polygon:
+            text = "P";
+            append ( text , static_cast< const OpenCIF::PathBasedCommand* > ( command )->getPoints () );
+            break;
+         
+         case OpenCIF::Command::Wire:
+            {
+               const OpenCIF::WireCommand* wire = static_cast< const OpenCIF::WireCommand* > ( command );
+               
+               text = "W";
+               append ( text , wire->getWidth () );
+               append ( text , wire->getPoints () );
+            }
+            break;
+         
+         case OpenCIF::Command::RoundFlash:
+            {
+               const OpenCIF::RoundFlashCommand* round_flash = static_cast< const OpenCIF::RoundFlashCommand* > ( command );
+               
+               text = "R";
+               append ( text , round_flash->getDiameter () );
+               append ( text , round_flash->getPosition ().getX () );
+               append ( text , round_flash->getPosition ().getY () );
+            }
+            break;
+         
+         case OpenCIF::Command::Call:
+            {
+               const OpenCIF::CallCommand* call = static_cast< const OpenCIF::CallCommand* > ( command );
+               const std::vector< OpenCIF::Transformation >& transformations = call->getTransformations ();
+               
+               text = "C";
+               append ( text , call->getID () );
+               
+               for ( unsigned long int i = 0; i < transformations.size (); i++ )
+               {
+                  switch ( transformations[ i ].getType () )
+                  {
+                     case OpenCIF::Transformation::Displacement:
+                        text += " T";
+                        append ( text , transformations[ i ].getDisplacement ().getX () );
+                        append ( text , transformations[ i ].getDisplacement ().getY () );
+                        break;
+                     
+                     case OpenCIF::Transformation::Rotation:
+                        text += " R";
+                        appendDirection ( text , transformations[ i ].getRotation ().getX () , transformations[ i ].getRotation ().getY () );
+                        break;
+                     
+                     case OpenCIF::Transformation::HorizontalMirroring:
+                        text += " MX";
+                        break;
+                     
+                     case OpenCIF::Transformation::VerticalMirroring:
+                        text += " MY";
+                        break;
+                  }
+               }
+            }
+            break;
+         
+         case OpenCIF::Command::DefinitionStart:
+            {
+               const OpenCIF::DefinitionStartCommand* start = static_cast< const OpenCIF::DefinitionStartCommand* > ( command );
+               unsigned long long int a = start->getAB ().getNumerator ();
+               unsigned long long int b = start->getAB ().getDenominator ();
+               unsigned long long int divisor = gcd ( a , b );
+               
+               if ( divisor > 1 )
+               {
+                  a /= divisor;
+                  b /= divisor;
+               }
+               
+               text = "DS";
+               append ( text , start->getID () );
+               
+               if ( a != b )
+               {
+                  append ( text , a );
+                  append ( text , b );
+               }
+            }
+            break;
+         
+         case OpenCIF::Command::DefinitionDelete:
+            text = "DD";
+            append ( text , static_cast< const OpenCIF::DefinitionDeleteCommand* > ( command )->getID () );
+            break;
+         
+         case OpenCIF::Command::DefinitionEnd:
+            text = "DF";
+            break;
+         
+         case OpenCIF::Command::Comment:
+         case OpenCIF::Command::UserExtension:
+            text = static_cast< const OpenCIF::RawContentCommand* > ( command )->getContent ();
+            break;
+         
+         case OpenCIF::Command::End:
+            text = "E";
+            break;
+         
+         default:
+            return ( false );
+      }
+      
+      return ( true );
+   }
+}
+
+/*
+ * Default constructor. Keep the comments, and remove the duplicated
+ * primitives.
+ */
+OpenCIF::Minifier::Minifier ( void )
+   : minifier_strip_comments ( false ) ,
+     minifier_remove_duplicates ( true )
+{
+}
+
+OpenCIF::Minifier::~Minifier ( void )
+{
+}
+
+/*
+ * Member function to set if the comments are dropped.
+ */
+void OpenCIF::Minifier::setStripComments ( const bool& new_strip_comments )
+{
+   minifier_strip_comments = new_strip_comments;
+   
+   return;
+}
+
+/*
+ * Member function to set if the primitives already written in the same
+ * definition are dropped.
+ */
+void OpenCIF::Minifier::setRemoveDuplicates ( const bool& new_remove_duplicates )
+{
+   minifier_remove_duplicates = new_remove_duplicates;
+   
+   return;
+}
+
+bool OpenCIF::Minifier::getStripComments ( void ) const
+{
+   return ( minifier_strip_comments );
+}
+
+bool OpenCIF::Minifier::getRemoveDuplicates ( void ) const
+{
+   return ( minifier_remove_duplicates );
+}
+
+/*
+ * Member function to write a list of commands to a file.
+ */
+bool OpenCIF::Minifier::write ( const std::vector< OpenCIF::Command* >& commands , const std::string& path ) const
+{
+   std::ofstream output ( path.c_str () , std::ios::binary );
+   
+   if ( !output.is_open () )
+   {
+      return ( false );
+   }
+   
+   return ( write ( commands , output ) );
+}
+
+/*
+ * Member function to write a list of commands to a stream. Returns false if
+ * the stream fails.
+ */
+bool OpenCIF::Minifier::write ( const std::vector< OpenCIF::Command* >& commands , std::ostream& output ) const
+{
+   MinifierScope top;
+   MinifierScope definition;
+   MinifierScope* scope = &top;
+   std::unordered_set< std::string > top_primitives;
+   std::unordered_set< std::string > definition_primitives;
+   std::unordered_set< std::string >* primitives = &top_primitives;
+   std::string text;
+   
+   for ( unsigned long int i = 0; i < commands.size () && output.good (); i++ )
+   {
+      const OpenCIF::Command* command = commands[ i ];
+      
+      switch ( command->type () )
+      {
+         case OpenCIF::Command::Layer:
+            scope->input_layer = static_cast< const OpenCIF::LayerCommand* > ( command )->getName ();
+            continue;
+         
+         case OpenCIF::Command::Box:
+         case OpenCIF::Command::Polygon:
+         case OpenCIF::Command::Wire:
+         case OpenCIF::Command::RoundFlash:
+            canonical ( command , text );
+            
+            // The layer is part of the key, so the same primitive on other
+            // layer isn't a duplicate.
+            if ( minifier_remove_duplicates && !primitives->insert ( scope->input_layer + '\n' + text ).second )
+            {
+               continue;
+            }
+            
+            if ( scope->input_layer != scope->output_layer )
+            {
+               output << "L" << scope->input_layer << ";\n";
+               scope->output_layer = scope->input_layer;
+            }
+            
+            output << text << ";\n";
+            continue;
+         
+         case OpenCIF::Command::DefinitionStart:
+            definition = MinifierScope ();
+            definition_primitives.clear ();
+            scope = &definition;
+            primitives = &definition_primitives;
+            break;
+         
+         case OpenCIF::Command::DefinitionEnd:
+            scope = &top;
+            primitives = &top_primitives;
+            break;
+         
+         case OpenCIF::Command::Comment:
+            if ( minifier_strip_comments )
+            {
+               continue;
+            }
+            break;
+         
+         default:
+            break;
+      }
+      
+      if ( canonical ( command , text ) )
+      {
+         output << text << ( ( command->type () == OpenCIF::Command::End ) ? "\n" : ";\n" );
+      }
+   }
+   
+   return ( output.good () );
+}
@@ -0,0 +1,76 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_MINIFIER_HH_
+# define LIBOPENCIF_MINIFIER_HH_
+
+# include <iostream>
+# include <string>
+# include <vector>
+
+# include "../command/command.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class writes a list of commands as a CIF file, as small as it can
+    * without changing what the file draws, in a single pass:
+    *
+    * - A layer command is written only before a primitive drawn on a layer
+    *   different from the last one written, so the layer commands that are
+    *   repeated or not followed by any primitive are dropped. The current
+    *   layer is local to every definition (like File::loadFile reads it).
+    * - A primitive equal to one already written in the same definition (or
+    *   outside the definitions), on the same layer, is dropped. The written
+    *   primitives are kept in a hash set, by their canonical text.
+    * - Every command is written in a canonical form: the letters of the
+    *   command together, a single space between numbers, no neutral values
+    *   (the rotation "1 0" of a box, the scale "1 1" of a definition), the
+    *   directions and scales reduced, and a command per line.
+    * - Optionally, the comments are dropped. The user extensions are always
+    *   kept, since they can name the symbols.
+    *
+    * Nothing else is merged or reordered, so the commands written are still
+    * in the order of the list.
+    */
+   class Minifier
+   {
+      public:
+         explicit Minifier ( void );
+         virtual ~Minifier ( void );
+         
+         void setStripComments ( const bool& new_strip_comments );
+         void setRemoveDuplicates ( const bool& new_remove_duplicates );
+         bool getStripComments ( void ) const;
+         bool getRemoveDuplicates ( void ) const;
+         
+         bool write ( const std::vector< OpenCIF::Command* >& commands , const std::string& path ) const;
+         bool write ( const std::vector< OpenCIF::Command* >& commands , std::ostream& output ) const;
+      
+      private:
+         bool minifier_strip_comments;
+         bool minifier_remove_duplicates;
+   };
+}
+
+# endif
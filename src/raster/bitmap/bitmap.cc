@@ -0,0 +1,369 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <fstream>
+# include <algorithm>
+
+# include "bitmap.hh"
+
+namespace
+{
+   /*
+    * Functions used to write PNG files. The image data is stored in a zlib
+    * stream without compression, so no external library is needed.
+    */
+   struct CRCTable
+   {
+      unsigned long int values[ 256 ];
+      
+      CRCTable ( void )
+      {
+         for ( unsigned long int i = 0; i < 256; i++ )
+         {
+            unsigned long int value = i;
+            
+            for ( int bit = 0; bit < 8; bit++ )
+            {
+               value = ( value & 1 ) ? ( 0xEDB88320UL ^ ( value >> 1 ) ) : ( value >> 1 );
+            }
+            
+            values[ i ] = value;
+         }
+      }
+   };
+   
+   unsigned long int crc32 ( const std::string& data )
+   {
+      static const CRCTable table;
+      unsigned long int crc = 0xFFFFFFFFUL;
+      
+      for ( unsigned long int i = 0; i < data.size (); i++ )
+      {
+         crc = table.values[ ( crc ^ (unsigned char)( data[ i ] ) ) & 0xFF ] ^ ( crc >> 8 );
+      }
+      
+      return ( crc ^ 0xFFFFFFFFUL );
+   }
+   
+   void appendBigEndian ( std::string& data , const unsigned long int& value )
+   {
+      data += (char)( ( value >> 24 ) & 0xFF );
+      data += (char)( ( value >> 16 ) & 0xFF );
+      data += (char)( ( value >> 8 ) & 0xFF );
+      data += (char)( value & 0xFF );
+      
+      return;
+   }
+   
+   void writeChunk ( std::ofstream& output , const std::string& type , const std::string& data )
+   {
+      std::string length;
+      std::string checksum;
+      
+      appendBigEndian ( length , data.size () );
+      appendBigEndian ( checksum , crc32 ( type + data ) );
+      
+      output << length << type << data << checksum;
+      
+      return;
+   }
+}
+
+/*
+ * Default constructor. The bitmap is empty.
+ */
+OpenCIF::Bitmap::Bitmap ( void )
+   : bitmap_width ( 0 ) , bitmap_height ( 0 ) , bitmap_maximum ( 1 ) , bitmap_row_size ( 0 )
+{
+}
+
+/*
+ * Non-default constructor. Creates an image with every pixel empty.
+ */
+OpenCIF::Bitmap::Bitmap ( const unsigned long int& new_width , const unsigned long int& new_height , const unsigned char& new_maximum )
+{
+   resize ( new_width , new_height , new_maximum );
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Bitmap::~Bitmap ( void )
+{
+}
+
+/*
+ * Member function to change the size of the image. Every pixel is emptied.
+ */
+void OpenCIF::Bitmap::resize ( const unsigned long int& new_width , const unsigned long int& new_height , const unsigned char& new_maximum )
+{
+   bitmap_width = new_width;
+   bitmap_height = new_height;
+   bitmap_maximum = ( new_maximum == 0 ) ? 1 : new_maximum;
+   bitmap_row_size = ( bitmap_maximum == 1 ) ? ( bitmap_width + 7 ) / 8 : bitmap_width;
+   bitmap_pixels.assign ( bitmap_row_size * bitmap_height , 0 );
+   
+   return;
+}
+
+unsigned long int OpenCIF::Bitmap::getWidth ( void ) const
+{
+   return ( bitmap_width );
+}
+
+unsigned long int OpenCIF::Bitmap::getHeight ( void ) const
+{
+   return ( bitmap_height );
+}
+
+unsigned char OpenCIF::Bitmap::getMaximum ( void ) const
+{
+   return ( bitmap_maximum );
+}
+
+/*
+ * Member function to return the amount of bytes used by every row.
+ */
+unsigned long int OpenCIF::Bitmap::getRowSize ( void ) const
+{
+   return ( bitmap_row_size );
+}
+
+unsigned char OpenCIF::Bitmap::get ( const unsigned long int& x , const unsigned long int& y ) const
+{
+   if ( bitmap_maximum == 1 )
+   {
+      return ( ( bitmap_pixels[ y * bitmap_row_size + x / 8 ] >> ( 7 - x % 8 ) ) & 1 );
+   }
+   
+   return ( bitmap_pixels[ y * bitmap_row_size + x ] );
+}
+
+/*
+ * Member function to set a pixel. In bilevel images, any value that is not 0
+ * sets the pixel.
+ */
+void OpenCIF::Bitmap::set ( const unsigned long int& x , const unsigned long int& y , const unsigned char& value )
+{
+   if ( bitmap_maximum == 1 )
+   {
+      unsigned char& pixels = bitmap_pixels[ y * bitmap_row_size + x / 8 ];
+      unsigned char mask = (unsigned char)( 0x80 >> ( x % 8 ) );
+      
+      pixels = ( value != 0 ) ? ( pixels | mask ) : ( pixels & ~mask );
+      
+      return;
+   }
+   
+   bitmap_pixels[ y * bitmap_row_size + x ] = value;
+   
+   return;
+}
+
+unsigned char* OpenCIF::Bitmap::getRow ( const unsigned long int& y )
+{
+   return ( &bitmap_pixels[ y * bitmap_row_size ] );
+}
+
+const unsigned char* OpenCIF::Bitmap::getRow ( const unsigned long int& y ) const
+{
+   return ( &bitmap_pixels[ y * bitmap_row_size ] );
+}
+
+const std::vector< unsigned char >& OpenCIF::Bitmap::getPixels ( void ) const
+{
+   return ( bitmap_pixels );
+}
+
+/*
+ * Member function to return the amount of pixels that are not empty.
+ */
+unsigned long int OpenCIF::Bitmap::countPixels ( void ) const
+{
+   unsigned long int amount = 0;
+   
+   if ( bitmap_maximum == 1 )
+   {
+      // The bits after the last pixel of a row are never set.
+      for ( unsigned long int i = 0; i < bitmap_pixels.size (); i++ )
+      {
+         for ( unsigned char bits = bitmap_pixels[ i ]; bits != 0; bits &= (unsigned char)( bits - 1 ) )
+         {
+            amount++;
+         }
+      }
+      
+      return ( amount );
+   }
+   
+   for ( unsigned long int i = 0; i < bitmap_pixels.size (); i++ )
+   {
+      amount += ( bitmap_pixels[ i ] != 0 );
+   }
+   
+   return ( amount );
+}
+
+/*
+ * Member function to write the image as a binary PBM file. Every pixel that
+ * is not empty is black.
+ */
+bool OpenCIF::Bitmap::writePBM ( const std::string& path ) const
+{
+   std::ofstream output ( path.c_str () , std::ios::binary );
+   std::string row ( ( bitmap_width + 7 ) / 8 , '\0' );
+   
+   if ( !output.is_open () )
+   {
+      return ( false );
+   }
+   
+   output << "P4\n" << bitmap_width << " " << bitmap_height << "\n";
+   
+   // The rows of a bilevel image are already stored as in the file.
+   if ( bitmap_maximum == 1 )
+   {
+      output.write ( (const char*)( bitmap_pixels.data () ) , bitmap_pixels.size () );
+      
+      return ( output.good () );
+   }
+   
+   for ( unsigned long int y = 0; y < bitmap_height; y++ )
+   {
+      const unsigned char* pixels = getRow ( y );
+      
+      row.assign ( row.size () , '\0' );
+      
+      for ( unsigned long int x = 0; x < bitmap_width; x++ )
+      {
+         if ( pixels[ x ] != 0 )
+         {
+            row[ x / 8 ] |= (char)( 0x80 >> ( x % 8 ) );
+         }
+      }
+      
+      output.write ( row.data () , row.size () );
+   }
+   
+   return ( output.good () );
+}
+
+/*
+ * Member function to write the image as a binary PGM file.
+ */
+bool OpenCIF::Bitmap::writePGM ( const std::string& path ) const
+{
+   std::ofstream output ( path.c_str () , std::ios::binary );
+   std::string row ( bitmap_width , '\0' );
+   
+   if ( !output.is_open () )
+   {
+      return ( false );
+   }
+   
+   output << "P5\n" << bitmap_width << " " << bitmap_height << "\n255\n";
+   
+   for ( unsigned long int y = 0; y < bitmap_height; y++ )
+   {
+      for ( unsigned long int x = 0; x < bitmap_width; x++ )
+      {
+         row[ x ] = (char)( 255 - get ( x , y ) * 255 / bitmap_maximum );
+      }
+      
+      output.write ( row.data () , row.size () );
+   }
+   
+   return ( output.good () );
+}
+
+/*
+ * Member function to write the image as a gray PNG file. The image data is
+ * stored without compression.
+ */
+bool OpenCIF::Bitmap::writePNG ( const std::string& path ) const
+{
+   std::ofstream output ( path.c_str () , std::ios::binary );
+   std::string header;
+   std::string data;
+   std::string block;
+   unsigned long int adler_a = 1 , adler_b = 0;
+   
+   if ( !output.is_open () )
+   {
+      return ( false );
+   }
+   
+   output << "\x89PNG\r\n\x1A\n";
+   
+   // Width, height, 8 bits per pixel, gray, and the default compression, filter and interlace methods.
+   appendBigEndian ( header , bitmap_width );
+   appendBigEndian ( header , bitmap_height );
+   header += std::string ( "\x08\x00\x00\x00\x00" , 5 );
+   writeChunk ( output , "IHDR" , header );
+   
+   // Every row starts with its filter (none).
+   block.reserve ( ( bitmap_width + 1 ) * bitmap_height );
+   
+   for ( unsigned long int y = 0; y < bitmap_height; y++ )
+   {
+      block += '\0';
+      
+      for ( unsigned long int x = 0; x < bitmap_width; x++ )
+      {
+         block += (char)( 255 - get ( x , y ) * 255 / bitmap_maximum );
+      }
+   }
+   
+   // The zlib stream: header, blocks without compression (65535 bytes at most), and the Adler-32 checksum.
+   data += std::string ( "\x78\x01" , 2 );
+   
+   for ( unsigned long int position = 0; position < block.size () || position == 0; position += 65535 )
+   {
+      unsigned long int length = std::min ( block.size () - position , 65535UL );
+      bool last = ( position + length >= block.size () );
+      
+      data += (char)( last ? 1 : 0 );
+      data += (char)( length & 0xFF );
+      data += (char)( ( length >> 8 ) & 0xFF );
+      data += (char)( ~length & 0xFF );
+      data += (char)( ( ~length >> 8 ) & 0xFF );
+      data.append ( block , position , length );
+      
+      if ( last )
+      {
+         break;
+      }
+   }
+   
+   for ( unsigned long int i = 0; i < block.size (); i++ )
+   {
+      adler_a = ( adler_a + (unsigned char)( block[ i ] ) ) % 65521;
+      adler_b = ( adler_b + adler_a ) % 65521;
+   }
+   
+   appendBigEndian ( data , ( adler_b << 16 ) | adler_a );
+   writeChunk ( output , "IDAT" , data );
+   writeChunk ( output , "IEND" , "" );
+   
+   return ( output.good () );
+}
@@ -0,0 +1,80 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_BITMAP_HH_
+# define LIBOPENCIF_BITMAP_HH_
+
+# include <string>
+# include <vector>
+
+namespace OpenCIF
+{
+   /*
+    * This class stores an image. The rows are stored from top to bottom.
+    * Every pixel has a value from 0 (empty) to the maximum value of the
+    * bitmap: 1 for bilevel images, and 255 for images where the value is the
+    * fraction of the pixel covered.
+    *
+    * Bilevel images use a bit per pixel: every row starts in a new byte, and
+    * the first pixel of a byte is its most significant bit (the layout of
+    * PBM files, so they are written as they are). Other images use a byte per
+    * pixel. The rows given by getRow (and the pixels given by getPixels) are
+    * stored that way, with getRowSize bytes per row.
+    *
+    * The image can be written to PBM (bilevel), PGM or PNG (gray) files. The
+    * covered pixels are drawn in black, over a white background.
+    */
+   class Bitmap
+   {
+      public:
+         explicit Bitmap ( void );
+         explicit Bitmap ( const unsigned long int& new_width , const unsigned long int& new_height , const unsigned char& new_maximum = 1 );
+         virtual ~Bitmap ( void );
+         
+         void resize ( const unsigned long int& new_width , const unsigned long int& new_height , const unsigned char& new_maximum = 1 );
+         
+         unsigned long int getWidth ( void ) const;
+         unsigned long int getHeight ( void ) const;
+         unsigned char getMaximum ( void ) const;
+         unsigned long int getRowSize ( void ) const;
+         unsigned char get ( const unsigned long int& x , const unsigned long int& y ) const;
+         void set ( const unsigned long int& x , const unsigned long int& y , const unsigned char& value );
+         unsigned char* getRow ( const unsigned long int& y );
+         const unsigned char* getRow ( const unsigned long int& y ) const;
+         const std::vector< unsigned char >& getPixels ( void ) const;
+         unsigned long int countPixels ( void ) const;
+         
+         bool writePBM ( const std::string& path ) const;
+         bool writePGM ( const std::string& path ) const;
+         bool writePNG ( const std::string& path ) const;
+      
+      private:
+         unsigned long int bitmap_width;
+         unsigned long int bitmap_height;
+         unsigned char bitmap_maximum;
+         unsigned long int bitmap_row_size;
+         std::vector< unsigned char > bitmap_pixels;
+   };
+}
+
+# endif
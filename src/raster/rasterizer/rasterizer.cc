@@ -0,0 +1,429 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <cmath>
+# include <cstring>
+# include <algorithm>
+
+# include "rasterizer.hh"
+
+namespace
+{
+   /*
+    * Grid of samples of a tile. The samples are stored by rows, from top to
+    * bottom. The center of the sample (column, row) is at
+    * (left + ( column + 0.5 ) * size, top - ( row + 0.5 ) * size).
+    */
+   struct RasterizerGrid
+   {
+      double left;
+      double top;
+      double size;
+      long int width;
+      long int height;
+      std::vector< unsigned char > samples;
+   };
+   
+   /*
+    * Function to set the samples of a row whose centers are inside [left, right).
+    */
+   void fillSpan ( RasterizerGrid& grid , const long int& row , const double& left , const double& right )
+   {
+      long int first = std::max ( (long int)( std::ceil ( ( left - grid.left ) / grid.size - 0.5 ) ) , 0L );
+      long int last = std::min ( (long int)( std::ceil ( ( right - grid.left ) / grid.size - 0.5 ) ) , grid.width );
+      
+      if ( first < last )
+      {
+         std::memset ( &grid.samples[ row * grid.width + first ] , 1 , last - first );
+      }
+      
+      return;
+   }
+   
+   /*
+    * Function to return the rows whose centers are inside [bottom, top).
+    */
+   void rowRange ( const RasterizerGrid& grid , const double& bottom , const double& top , long int& first , long int& last )
+   {
+      first = std::max ( (long int)( std::floor ( ( grid.top - top ) / grid.size - 0.5 ) ) + 1 , 0L );
+      last = std::min ( (long int)( std::floor ( ( grid.top - bottom ) / grid.size - 0.5 ) ) + 1 , grid.height );
+      
+      return;
+   }
+   
+   void drawShape ( RasterizerGrid& grid , const OpenCIF::Shape& shape , std::vector< std::pair< double , int > >& crossings )
+   {
+      const OpenCIF::Rectangle& bounds = shape.getBounds ();
+      long int first_row , last_row;
+      
+      rowRange ( grid , bounds.getBottom () , bounds.getTop () , first_row , last_row );
+      
+      if ( shape.isRectangle () )
+      {
+         for ( long int row = first_row; row < last_row; row++ )
+         {
+            fillSpan ( grid , row , bounds.getLeft () , bounds.getRight () );
+         }
+         
+         return;
+      }
+      
+      const std::vector< OpenCIF::Point >& points = shape.getPoints ();
+      
+      for ( long int row = first_row; row < last_row; row++ )
+      {
+         double y = grid.top - ( row + 0.5 ) * grid.size;
+         int winding = 0;
+         
+         crossings.clear ();
+         
+         for ( unsigned long int i = 0; i < points.size (); i++ )
+         {
+            const OpenCIF::Point& start = points[ i ];
+            const OpenCIF::Point& end = points[ ( i + 1 ) % points.size () ];
+            double y0 = start.getY () , y1 = end.getY ();
+            
+            if ( ( y0 <= y && y < y1 ) || ( y1 <= y && y < y0 ) )
+            {
+               double x = start.getX () + ( end.getX () - start.getX () ) * ( y - y0 ) / ( y1 - y0 );
+               
+               crossings.push_back ( std::make_pair ( x , ( y1 > y0 ) ? 1 : -1 ) );
+            }
+         }
+         
+         std::sort ( crossings.begin () , crossings.end () );
+         
+         for ( unsigned long int i = 0; i + 1 < crossings.size (); i++ )
+         {
+            winding += crossings[ i ].second;
+            
+            if ( winding != 0 )
+            {
+               fillSpan ( grid , row , crossings[ i ].first , crossings[ i + 1 ].first );
+            }
+         }
+      }
+      
+      return;
+   }
+}
+
+/*
+ * Default constructor. Bilevel mode, pixels of 1 unit, tiles of 256 pixels,
+ * and one thread per core.
+ */
+OpenCIF::Rasterizer::Rasterizer ( void )
+   : rasterizer_pixel_size ( 1 ) , rasterizer_mode ( Bilevel ) , rasterizer_samples ( 4 ) , rasterizer_tile_size ( 256 ) , rasterizer_thread_amount ( 0 )
+{
+}
+
+/*
+ * Destructor. Nothing to do.
+ */
+OpenCIF::Rasterizer::~Rasterizer ( void )
+{
+}
+
+/*
+ * Member function to set the window to draw. If it's empty, the bounding box
+ * of the shapes is used.
+ */
+void OpenCIF::Rasterizer::setWindow ( const OpenCIF::Rectangle& new_window )
+{
+   rasterizer_window = new_window;
+   
+   return;
+}
+
+/*
+ * Member function to set the size of a pixel, in units of the file. Sizes
+ * that are not positive are ignored.
+ */
+void OpenCIF::Rasterizer::setPixelSize ( const double& new_pixel_size )
+{
+   if ( new_pixel_size > 0 )
+   {
+      rasterizer_pixel_size = new_pixel_size;
+   }
+   
+   return;
+}
+
+void OpenCIF::Rasterizer::setMode ( const Mode& new_mode )
+{
+   rasterizer_mode = new_mode;
+   
+   return;
+}
+
+/*
+ * Member function to set the amount of samples per side of a pixel, used in
+ * coverage mode (from 1 to 16).
+ */
+void OpenCIF::Rasterizer::setSamples ( const unsigned long int& new_samples )
+{
+   rasterizer_samples = std::min ( std::max ( new_samples , 1UL ) , 16UL );
+   
+   return;
+}
+
+/*
+ * Member function to set the IDs of the layers to draw. If the list is
+ * empty, every layer is drawn.
+ */
+void OpenCIF::Rasterizer::setLayers ( const std::vector< unsigned long int >& new_layers )
+{
+   rasterizer_layers = new_layers;
+   
+   return;
+}
+
+void OpenCIF::Rasterizer::setTileSize ( const unsigned long int& new_tile_size )
+{
+   rasterizer_tile_size = std::max ( new_tile_size , 1UL );
+   
+   return;
+}
+
+/*
+ * Member function to set the amount of threads used. If it's 0, one thread
+ * per core is used.
+ */
+void OpenCIF::Rasterizer::setThreadAmount ( const unsigned long int& new_thread_amount )
+{
+   rasterizer_thread_amount = new_thread_amount;
+   
+   return;
+}
+
+/*
+ * Member function to set the flattener used to draw commands (the window of
+ * the flattener is replaced by the window of the rasterizer).
+ */
+void OpenCIF::Rasterizer::setFlattener ( const OpenCIF::Flattener& new_flattener )
+{
+   rasterizer_flattener = new_flattener;
+   
+   return;
+}
+
+const OpenCIF::Rectangle& OpenCIF::Rasterizer::getWindow ( void ) const
+{
+   return ( rasterizer_window );
+}
+
+double OpenCIF::Rasterizer::getPixelSize ( void ) const
+{
+   return ( rasterizer_pixel_size );
+}
+
+OpenCIF::Rasterizer::Mode OpenCIF::Rasterizer::getMode ( void ) const
+{
+   return ( rasterizer_mode );
+}
+
+unsigned long int OpenCIF::Rasterizer::getSamples ( void ) const
+{
+   return ( rasterizer_samples );
+}
+
+const std::vector< unsigned long int >& OpenCIF::Rasterizer::getLayers ( void ) const
+{
+   return ( rasterizer_layers );
+}
+
+unsigned long int OpenCIF::Rasterizer::getTileSize ( void ) const
+{
+   return ( rasterizer_tile_size );
+}
+
+unsigned long int OpenCIF::Rasterizer::getThreadAmount ( void ) const
+{
+   return ( rasterizer_thread_amount );
+}
+
+const OpenCIF::Flattener& OpenCIF::Rasterizer::getFlattener ( void ) const
+{
+   return ( rasterizer_flattener );
+}
+
+/*
+ * Member function to draw shapes, using a new pool of threads.
+ */
+OpenCIF::Bitmap OpenCIF::Rasterizer::render ( const std::vector< OpenCIF::Shape >& shapes ) const
+{
+   OpenCIF::ThreadPool pool ( rasterizer_thread_amount );
+   
+   return ( render ( shapes , pool ) );
+}
+
+/*
+ * Member function to draw shapes, using the given pool of threads.
+ */
+OpenCIF::Bitmap OpenCIF::Rasterizer::render ( const std::vector< OpenCIF::Shape >& shapes , OpenCIF::ThreadPool& pool ) const
+{
+   OpenCIF::Rectangle window = rasterizer_window;
+   std::vector< unsigned long int > drawn;
+   
+   for ( unsigned long int i = 0; i < shapes.size (); i++ )
+   {
+      if ( isLayerDrawn ( shapes[ i ].getLayerID () ) )
+      {
+         drawn.push_back ( i );
+         
+         if ( rasterizer_window.isEmpty () )
+         {
+            window.add ( shapes[ i ].getBounds () );
+         }
+      }
+   }
+   
+   if ( window.isEmpty () )
+   {
+      return ( OpenCIF::Bitmap () );
+   }
+   
+   const double pixel = rasterizer_pixel_size;
+   // A bilevel bitmap stores 8 pixels per byte, so the tiles start at a byte and the threads don't share bytes.
+   const unsigned long int tile = ( rasterizer_mode == Coverage ) ? rasterizer_tile_size : ( rasterizer_tile_size + 7 ) / 8 * 8;
+   const unsigned long int width = std::max ( (unsigned long int)( std::ceil ( window.getWidth () / pixel ) ) , 1UL );
+   const unsigned long int height = std::max ( (unsigned long int)( std::ceil ( window.getHeight () / pixel ) ) , 1UL );
+   const unsigned long int columns = ( width + tile - 1 ) / tile;
+   const unsigned long int rows = ( height + tile - 1 ) / tile;
+   const unsigned long int samples = ( rasterizer_mode == Coverage ) ? rasterizer_samples : 1;
+   std::vector< std::vector< unsigned long int > > tiles ( columns * rows );
+   OpenCIF::Bitmap bitmap ( width , height , ( rasterizer_mode == Coverage ) ? 255 : 1 );
+   
+   // Every shape is given to the tiles touched by its bounding box.
+   for ( unsigned long int i = 0; i < drawn.size (); i++ )
+   {
+      const OpenCIF::Rectangle& bounds = shapes[ drawn[ i ] ].getBounds ();
+      double first_column = std::floor ( ( bounds.getLeft () - window.getLeft () ) / pixel / tile );
+      double last_column = std::floor ( ( bounds.getRight () - window.getLeft () ) / pixel / tile );
+      double first_row = std::floor ( ( window.getTop () - bounds.getTop () ) / pixel / tile );
+      double last_row = std::floor ( ( window.getTop () - bounds.getBottom () ) / pixel / tile );
+      
+      if ( last_column < 0 || last_row < 0 || first_column >= columns || first_row >= rows )
+      {
+         continue;
+      }
+      
+      for ( unsigned long int row = std::max ( first_row , 0.0 ); row <= std::min ( last_row , rows - 1.0 ); row++ )
+      {
+         for ( unsigned long int column = std::max ( first_column , 0.0 ); column <= std::min ( last_column , columns - 1.0 ); column++ )
+         {
+            tiles[ row * columns + column ].push_back ( drawn[ i ] );
+         }
+      }
+   }
+   
+   pool.parallelFor ( tiles.size () , [ & ] ( unsigned long int first_tile , unsigned long int last_tile )
+   {
+      RasterizerGrid grid;
+      std::vector< std::pair< double , int > > crossings;
+      
+      for ( unsigned long int index = first_tile; index < last_tile; index++ )
+      {
+         if ( tiles[ index ].empty () )
+         {
+            continue;
+         }
+         
+         unsigned long int column = index % columns;
+         unsigned long int row = index / columns;
+         unsigned long int tile_width = std::min ( tile , width - column * tile );
+         unsigned long int tile_height = std::min ( tile , height - row * tile );
+         
+         grid.left = window.getLeft () + (double)( column * tile ) * pixel;
+         grid.top = window.getTop () - (double)( row * tile ) * pixel;
+         grid.size = pixel / samples;
+         grid.width = tile_width * samples;
+         grid.height = tile_height * samples;
+         grid.samples.assign ( grid.width * grid.height , 0 );
+         
+         for ( unsigned long int i = 0; i < tiles[ index ].size (); i++ )
+         {
+            drawShape ( grid , shapes[ tiles[ index ][ i ] ] , crossings );
+         }
+         
+         // Copy the samples into the bitmap (packing them in bilevel mode, and adding them in coverage mode).
+         for ( unsigned long int y = 0; y < tile_height; y++ )
+         {
+            if ( rasterizer_mode == Bilevel )
+            {
+               unsigned char* pixels = bitmap.getRow ( row * tile + y ) + column * tile / 8;
+               const unsigned char* sample = &grid.samples[ y * grid.width ];
+               
+               for ( unsigned long int x = 0; x < tile_width; x++ )
+               {
+                  pixels[ x / 8 ] |= (unsigned char)( sample[ x ] << ( 7 - x % 8 ) );
+               }
+               
+               continue;
+            }
+            
+            unsigned char* pixels = bitmap.getRow ( row * tile + y ) + column * tile;
+            
+            for ( unsigned long int x = 0; x < tile_width; x++ )
+            {
+               unsigned long int covered = 0;
+               
+               for ( unsigned long int sample_y = 0; sample_y < samples; sample_y++ )
+               {
+                  const unsigned char* sample = &grid.samples[ ( y * samples + sample_y ) * grid.width + x * samples ];
+                  
+                  for ( unsigned long int sample_x = 0; sample_x < samples; sample_x++ )
+                  {
+                     covered += sample[ sample_x ];
+                  }
+               }
+               
+               pixels[ x ] = ( covered * 255 + samples * samples / 2 ) / ( samples * samples );
+            }
+         }
+      }
+   } );
+   
+   return ( bitmap );
+}
+
+/*
+ * Member function to draw the shapes drawn by a list of commands. Only the
+ * shapes inside the window are flattened.
+ */
+OpenCIF::Bitmap OpenCIF::Rasterizer::render ( const std::vector< OpenCIF::Command* >& commands ) const
+{
+   OpenCIF::Flattener flattener = rasterizer_flattener;
+   
+   flattener.setWindow ( rasterizer_window );
+   
+   return ( render ( flattener.flatten ( commands ) ) );
+}
+
+/*
+ * Member function to know if a layer is in the list of layers to draw.
+ */
+bool OpenCIF::Rasterizer::isLayerDrawn ( const unsigned long int& layer_id ) const
+{
+   return ( rasterizer_layers.empty () || std::find ( rasterizer_layers.begin () , rasterizer_layers.end () , layer_id ) != rasterizer_layers.end () );
+}
@@ -0,0 +1,109 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_RASTERIZER_HH_
+# define LIBOPENCIF_RASTERIZER_HH_
+
+# include <vector>
+
+# include "../bitmap/bitmap.hh"
+# include "../../geometry/shape/shape.hh"
+# include "../../geometry/rectangle/rectangle.hh"
+# include "../../geometry/flattener/flattener.hh"
+# include "../../command/command.hh"
+# include "../../threadpool/threadpool.hh"
+
+namespace OpenCIF
+{
+   /*
+    * This class draws shapes into a bitmap. The user gives the window (the
+    * part of the plane to draw), the size of a pixel (in units of the CIF
+    * file) and the layers to draw (all of them if none is given).
+    *
+    * - In bilevel mode, a pixel is set if its center is inside a shape. The
+    *   bitmap stores 8 pixels per byte, so the size of the tiles is rounded
+    *   up to a multiple of 8.
+    * - In coverage mode, every pixel is sampled several times (4 x 4 by
+    *   default), and its value is the fraction of samples inside the shapes,
+    *   from 0 to 255.
+    *
+    * The bitmap is split into tiles, and every tile is drawn by a thread of a
+    * pool, using only the shapes that touch it. Rectangles are drawn filling
+    * whole spans; other shapes are drawn using a scanline with the nonzero
+    * winding rule.
+    *
+    * When drawing commands, the flattener is used with the window, so the
+    * symbols are expanded only once and the placements outside the window are
+    * skipped.
+    */
+   class Rasterizer
+   {
+      public:
+         enum Mode
+         {
+            Bilevel = 0 ,
+            Coverage
+         };
+      
+      public:
+         explicit Rasterizer ( void );
+         virtual ~Rasterizer ( void );
+         
+         void setWindow ( const OpenCIF::Rectangle& new_window );
+         void setPixelSize ( const double& new_pixel_size );
+         void setMode ( const Mode& new_mode );
+         void setSamples ( const unsigned long int& new_samples );
+         void setLayers ( const std::vector< unsigned long int >& new_layers );
+         void setTileSize ( const unsigned long int& new_tile_size );
+         void setThreadAmount ( const unsigned long int& new_thread_amount );
+         void setFlattener ( const OpenCIF::Flattener& new_flattener );
+         
+         const OpenCIF::Rectangle& getWindow ( void ) const;
+         double getPixelSize ( void ) const;
+         Mode getMode ( void ) const;
+         unsigned long int getSamples ( void ) const;
+         const std::vector< unsigned long int >& getLayers ( void ) const;
+         unsigned long int getTileSize ( void ) const;
+         unsigned long int getThreadAmount ( void ) const;
+         const OpenCIF::Flattener& getFlattener ( void ) const;
+         
+         OpenCIF::Bitmap render ( const std::vector< OpenCIF::Shape >& shapes ) const;
+         OpenCIF::Bitmap render ( const std::vector< OpenCIF::Shape >& shapes , OpenCIF::ThreadPool& pool ) const;
+         OpenCIF::Bitmap render ( const std::vector< OpenCIF::Command* >& commands ) const;
+      
+      private:
+         bool isLayerDrawn ( const unsigned long int& layer_id ) const;
+      
+      private:
+         OpenCIF::Rectangle rasterizer_window;
+         double rasterizer_pixel_size;
+         Mode rasterizer_mode;
+         unsigned long int rasterizer_samples;
+         std::vector< unsigned long int > rasterizer_layers;
+         unsigned long int rasterizer_tile_size;
+         unsigned long int rasterizer_thread_amount;
+         OpenCIF::Flattener rasterizer_flattener;
+   };
+}
+
+# endif
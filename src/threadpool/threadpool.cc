@@ -0,0 +1,301 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# include <utility>
+
+# include "threadpool.hh"
+
+/*
+ * Constructor. Starts the threads of the pool. If the amount is 0, one thread
+ * per core is used.
+ */
+OpenCIF::ThreadPool::ThreadPool ( const unsigned long int& thread_amount )
+   : pool_pending_tasks ( 0 ) , pool_stopping ( false )
+{
+   unsigned long int amount = ( thread_amount == 0 ) ? defaultThreadAmount () : thread_amount;
+   
+   pool_threads.reserve ( amount );
+   
+   for ( unsigned long int i = 0; i < amount; i++ )
+   {
+      pool_threads.push_back ( std::thread ( &OpenCIF::ThreadPool::work , this ) );
+   }
+}
+
+/*
+ * Destructor. The tasks already submitted are completed, then the threads are
+ * stopped.
+ */
+OpenCIF::ThreadPool::~ThreadPool ( void )
+{
+   {
+      std::unique_lock< std::mutex > lock ( pool_mutex );
+      
+      pool_stopping = true;
+   }
+   
+   pool_task_available.notify_all ();
+   
+   for ( unsigned long int i = 0; i < pool_threads.size (); i++ )
+   {
+      pool_threads[ i ].join ();
+   }
+}
+
+unsigned long int OpenCIF::ThreadPool::getThreadAmount ( void ) const
+{
+   return ( pool_threads.size () );
+}
+
+/*
+ * Static member function to return the amount of threads to use when the user
+ * doesn't give one: the amount of cores, or 1 if it can't be known.
+ */
+unsigned long int OpenCIF::ThreadPool::defaultThreadAmount ( void )
+{
+   unsigned long int amount = std::thread::hardware_concurrency ();
+   
+   return ( ( amount == 0 ) ? 1 : amount );
+}
+
+/*
+ * Member function to add a task to the queue of the pool.
+ */
+void OpenCIF::ThreadPool::submit ( const std::function< void ( void ) >& task )
+{
+   {
+      std::unique_lock< std::mutex > lock ( pool_mutex );
+      
+      pool_tasks.push_back ( task );
+      pool_pending_tasks++;
+   }
+   
+   pool_task_available.notify_one ();
+   
+   return;
+}
+
+/*
+ * Member function to add a task to the queue of the pool, that counts down a
+ * latch when it's done. An exception thrown by the task is given to the latch,
+ * and not kept by the pool.
+ */
+void OpenCIF::ThreadPool::submit ( const std::function< void ( void ) >& task , OpenCIF::ThreadPool::Latch& latch )
+{
+   submit ( [ task , &latch ] ()
+   {
+      std::exception_ptr exception;
+      
+      try
+      {
+         task ();
+      }
+      catch ( ... )
+      {
+         exception = std::current_exception ();
+      }
+      
+      latch.countDown ( exception );
+   } );
+   
+   return;
+}
+
+/*
+ * Member function to wait until every task submitted is completed. If a task
+ * threw an exception, the first one is thrown again here (and forgotten by
+ * the pool).
+ */
+void OpenCIF::ThreadPool::wait ( void )
+{
+   std::exception_ptr exception;
+   
+   {
+      std::unique_lock< std::mutex > lock ( pool_mutex );
+      
+      while ( pool_pending_tasks > 0 )
+      {
+         pool_tasks_done.wait ( lock );
+      }
+      
+      std::swap ( exception , pool_exception );
+   }
+   
+   if ( exception )
+   {
+      std::rethrow_exception ( exception );
+   }
+   
+   return;
+}
+
+/*
+ * Member function to run a task over the range [0, amount). The range is split
+ * into blocks (a few per thread, so a slow block doesn't stall the others),
+ * and the task is called once per block with its first and last (excluded)
+ * indexes. The function returns when every block is done, and throws the
+ * first exception thrown by a block, if any. Other tasks of the pool aren't
+ * waited for, but the function can't be called from a task of the pool.
+ */
+void OpenCIF::ThreadPool::parallelFor ( const unsigned long int& amount , const std::function< void ( unsigned long int , unsigned long int ) >& task )
+{
+   if ( amount == 0 )
+   {
+      return;
+   }
+   
+   unsigned long int blocks = pool_threads.size () * 4;
+   unsigned long int block_size = ( amount + blocks - 1 ) / blocks;
+   
+   // No need to wake up the threads for a single block.
+   if ( pool_threads.size () <= 1 || block_size >= amount )
+   {
+      task ( 0 , amount );
+      
+      return;
+   }
+   
+   OpenCIF::ThreadPool::Latch latch ( ( amount + block_size - 1 ) / block_size );
+   
+   for ( unsigned long int begin = 0; begin < amount; begin += block_size )
+   {
+      unsigned long int end = ( begin + block_size < amount ) ? begin + block_size : amount;
+      
+      submit ( [ &task , begin , end ] () { task ( begin , end ); } , latch );
+   }
+   
+   latch.wait ();
+   
+   return;
+}
+
+/*
+ * Member function run by every thread of the pool: take a task from the queue
+ * and run it, until the pool is destroyed.
+ */
+void OpenCIF::ThreadPool::work ( void )
+{
+   while ( true )
+   {
+      std::function< void ( void ) > task;
+      
+      {
+         std::unique_lock< std::mutex > lock ( pool_mutex );
+         
+         while ( !pool_stopping && pool_tasks.empty () )
+         {
+            pool_task_available.wait ( lock );
+         }
+         
+         if ( pool_tasks.empty () )
+         {
+            return;
+         }
+         
+         task = pool_tasks.front ();
+         pool_tasks.pop_front ();
+      }
+      
+      // The exception is kept for wait, and the task is counted as done anyway.
+      std::exception_ptr exception;
+      
+      try
+      {
+         task ();
+      }
+      catch ( ... )
+      {
+         exception = std::current_exception ();
+      }
+      
+      {
+         std::unique_lock< std::mutex > lock ( pool_mutex );
+         
+         if ( exception && !pool_exception )
+         {
+            pool_exception = exception;
+         }
+         
+         pool_pending_tasks--;
+         
+         if ( pool_pending_tasks == 0 )
+         {
+            pool_tasks_done.notify_all ();
+         }
+      }
+   }
+}
+
+/*
+ * Constructor of the latch, for the given amount of tasks.
+ */
+OpenCIF::ThreadPool::Latch::Latch ( const unsigned long int& amount )
+   : latch_pending ( amount )
+{
+}
+
+/*
+ * Member function to count a task as done, keeping its exception (if any) when
+ * it's the first one.
+ */
+void OpenCIF::ThreadPool::Latch::countDown ( const std::exception_ptr& exception )
+{
+   std::unique_lock< std::mutex > lock ( latch_mutex );
+   
+   if ( exception && !latch_exception )
+   {
+      latch_exception = exception;
+   }
+   
+   latch_pending--;
+   
+   // Notified with the mutex held, since the latch can be destroyed as soon
+   // as wait sees the last task done.
+   if ( latch_pending == 0 )
+   {
+      latch_done.notify_all ();
+   }
+   
+   return;
+}
+
+/*
+ * Member function to wait until every task of the latch is done. The first
+ * exception thrown by them is thrown again here.
+ */
+void OpenCIF::ThreadPool::Latch::wait ( void )
+{
+   std::unique_lock< std::mutex > lock ( latch_mutex );
+   
+   while ( latch_pending > 0 )
+   {
+      latch_done.wait ( lock );
+   }
+   
+   if ( latch_exception )
+   {
+      std::rethrow_exception ( latch_exception );
+   }
+   
+   return;
+}
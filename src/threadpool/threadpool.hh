@@ -0,0 +1,103 @@
+/*
+ * LibOpenCIF, a library to read the contents of a CIF (Caltech Intermediate
+ * Form) file. The library also includes a finite state machine to validate
+ * the contents, acording to the specifications found in the technical
+ * report 2686, from february 11, 1980.
+ * 
+ * Copyright (C) 2014, Moises Chavez Martinez
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */ 
+
+
+# ifndef LIBOPENCIF_THREADPOOL_HH_
+# define LIBOPENCIF_THREADPOOL_HH_
+
+# include <functional>
+# include <deque>
+# include <vector>
+# include <thread>
+# include <mutex>
+# include <condition_variable>
+# include <exception>
+
+namespace OpenCIF
+{
+   /*
+    * This class keeps a set of threads waiting for tasks. It's used by the
+    * geometry algorithms of the library to split their work, so the threads
+    * are created once and not every time a job is done.
+    *
+    * A task can't wait for other tasks of the same pool (the worker would be
+    * blocked, and with a single thread nobody would run the other tasks), so
+    * a task must not call wait or parallelFor of its own pool.
+    *
+    * An exception thrown by a task submitted alone is caught by its thread,
+    * and the first one is thrown again by wait, once every task is done. The
+    * tasks submitted with a latch (like the blocks of parallelFor) report to
+    * the latch instead, so every caller only waits for (and gets the errors
+    * of) its own tasks, even if other threads share the pool.
+    */
+   class ThreadPool
+   {
+      public:
+         /*
+          * Counter of the tasks of a single job. Waiting on it returns when
+          * they are done, and throws the first exception they threw.
+          */
+         class Latch
+         {
+            public:
+               explicit Latch ( const unsigned long int& amount );
+               
+               void countDown ( const std::exception_ptr& exception = std::exception_ptr () );
+               void wait ( void );
+            
+            private:
+               std::mutex latch_mutex;
+               std::condition_variable latch_done;
+               unsigned long int latch_pending;
+               std::exception_ptr latch_exception;
+         };
+      
+      public:
+         explicit ThreadPool ( const unsigned long int& thread_amount = 0 );
+         virtual ~ThreadPool ( void );
+         
+         unsigned long int getThreadAmount ( void ) const;
+         
+         void submit ( const std::function< void ( void ) >& task );
+         void submit ( const std::function< void ( void ) >& task , Latch& latch );
+         void wait ( void );
+         void parallelFor ( const unsigned long int& amount , const std::function< void ( unsigned long int , unsigned long int ) >& task );
+      
+      public:
+         static unsigned long int defaultThreadAmount ( void );
+      
+      private:
+         void work ( void );
+      
+      private:
+         std::vector< std::thread > pool_threads;
+         std::deque< std::function< void ( void ) > > pool_tasks;
+         std::mutex pool_mutex;
+         std::condition_variable pool_task_available;
+         std::condition_variable pool_tasks_done;
+         unsigned long int pool_pending_tasks;
+         std::exception_ptr pool_exception;
+         bool pool_stopping;
+   };
+}
+
+# endif